@@ -1,8 +1,21 @@
-/* machine generated, don't edit! */
-/* set 16-bit address in 64-bit pin mask*/
+/* machine generated by codegen/m6502_exec_gen.py from m6502_tick() in m6502.h, don't edit! */
+/*
+    Instruction-stepped 6502/6510 decoder, included by m6502.h in the
+    CHIPS_IMPL section.
+
+    Each instruction is decoded once into straight-line code, registers
+    live in a local copy of the CPU state for the whole instruction, and
+    the tick callback is invoked once per clock cycle with the same pin
+    mask as m6502_tick() would produce, so the bus behaviour is identical
+    to the cycle-stepped decoder (including RDY stalls and the IRQ/NMI
+    pipelines).
+*/
+/* set 16-bit address in 64-bit pin mask */
 #define _SA(addr) pins=(pins&~0xFFFF)|((addr)&0xFFFFULL)
 /* set 16-bit address and 8-bit data in 64-bit pin mask */
 #define _SAD(addr,data) pins=(pins&~0xFFFFFF)|((((data)&0xFF)<<16)&0xFF0000ULL)|((addr)&0xFFFFULL)
+/* fetch next opcode byte */
+#define _FETCH() _SA(c.PC);_ON(M6502_SYNC);
 /* set 8-bit data in 64-bit pin mask */
 #define _SD(data) pins=((pins&~0xFF0000ULL)|(((data&0xFF)<<16)&0xFF0000ULL))
 /* extract 8-bit data from 64-bit pin mask */
@@ -11,368 +24,1723 @@
 #define _ON(m) pins|=(m)
 /* disable control pins */
 #define _OFF(m) pins&=~(m)
-/* execute a tick */
-#define _T() pins=tick(pins,ud);ticks++;
 /* a memory read tick */
-#define _RD() _ON(M6502_RW);do{_OFF(M6502_RDY);_T();}while(pins&M6502_RDY);
+#define _RD() _ON(M6502_RW);
 /* a memory write tick */
-#define _WR() _OFF(M6502_RW);_T()
-/* implied addressing mode, this still puts the PC on the address bus */
-#define _A_IMP() _SA(c.PC)
-/* immediate addressing mode */
-#define _A_IMM() _SA(c.PC++)
-/* zero-page addressing mode */
-#define _A_ZER() _SA(c.PC++);_RD();a=_GD();_SA(a)
-/* zero page + X addressing mode */
-#define _A_ZPX() _SA(c.PC++);_RD();a=_GD();_SA(a);_RD();a=(a+c.X)&0x00FF;_SA(a)
-/* zero page + Y addressing mode */
-#define _A_ZPY() _SA(c.PC++);_RD();a=_GD();_SA(a);_RD();a=(a+c.Y)&0x00FF;_SA(a)
-/* absolute addressing mode */
-#define _A_ABS() _SA(c.PC++);_RD();l=_GD();_SA(c.PC++);_RD();h=_GD();a=(h<<8)|l;_SA(a)
-/* absolute+X addressing mode for read-only instructions, early out if no page boundary is crossed */
-#define _A_ABX_R() _SA(c.PC++);_RD();t=_GD()+c.X;_SA(c.PC++);_RD();a=(_GD()<<8)|(t&0xFF);_SA(a);if((t&0xFF00)!=0){_RD();a=(a&0xFF00)+t;_SA(a);}
-/* absolute+X addressing mode for read/write instructions */
-#define _A_ABX_W() _SA(c.PC++);_RD();t=_GD()+c.X;_SA(c.PC++);_RD();a=(_GD()<<8)|(t&0xFF);_SA(a);_RD();a=(a&0xFF00)+t;_SA(a)
-/* absolute+Y addressing mode for read-only instructions, early out if no page boundary is crossed */
-#define _A_ABY_R() _SA(c.PC++);_RD();t=_GD()+c.Y;_SA(c.PC++);_RD();a=(_GD()<<8)|(t&0xFF);_SA(a);if((t&0xFF00)!=0){_RD();a=(a&0xFF00)+t;_SA(a);}
-/* absolute+Y addressing mode for read/write instructions */
-#define _A_ABY_W() _SA(c.PC++);_RD();t=_GD()+c.Y;_SA(c.PC++);_RD();a=(_GD()<<8)|(t&0xFF);_SA(a);_RD();a=(a&0xFF00)+t;_SA(a)
-/* (zp,X) indexed indirect addressing mode */
-#define _A_IDX() _SA(c.PC++);_RD();a=_GD();_SA(a);_RD();a=(a+c.X)&0xFF;_SA(a);_RD();t=_GD();a=(a+1)&0xFF;_SA(a);_RD();a=(_GD()<<8)|t;_SA(a);
-/* (zp),Y indirect indexed addressing mode for read-only instructions, early out if no page boundary crossed */
-#define _A_IDY_R() _SA(c.PC++);_RD();a=_GD();_SA(a);_RD();t=_GD()+c.Y;a=(a+1)&0xFF;_SA(a);_RD();a=(_GD()<<8)|(t&0xFF);_SA(a);if((t&0xFF00)!=0){_RD();a=(a&0xFF00)+t;_SA(a);}
-/* (zp),Y indirect indexed addressing mode for read/write instructions */
-#define _A_IDY_W() _SA(c.PC++);_RD();a=_GD();_SA(a);_RD();t=_GD()+c.Y;a=(a+1)&0xFF;_SA(a);_RD();a=(_GD()<<8)|(t&0xFF);_SA(a);_RD();a=(a&0xFF00)+t;_SA(a)
+#define _WR() _OFF(M6502_RW);
 /* set N and Z flags depending on value */
 #define _NZ(v) c.P=((c.P&~(M6502_NF|M6502_ZF))|((v&0xFF)?(v&M6502_NF):M6502_ZF))
+/* interrupt detection and RDY stall at the start of a cycle (same as m6502_tick), a stalled
+   opcode fetch is an instruction boundary where m6502_exec() returns when the tick budget is used up
+*/
+#define _P() for(;;){if(pins&(M6502_IRQ|M6502_NMI|M6502_RDY|M6502_RES)){if(0!=((pins&(pins^c.PINS))&M6502_NMI)){c.nmi_pip|=0x100;}if((pins&M6502_IRQ)&&(0==(c.P&M6502_IF))){c.irq_pip|=0x100;}if((pins&(M6502_RW|M6502_RDY))==(M6502_RW|M6502_RDY)){if((pins&M6502_SYNC)&&(ticks>=num_ticks)){break;}M6510_SET_PORT(pins,cpu->io_pins);c.PINS=pins;c.irq_pip<<=1;pins=tick(pins,ud);ticks++;continue;}}break;}
+/* finish the current cycle, tick the system, and start the next cycle */
+#define _T() M6510_SET_PORT(pins,cpu->io_pins);c.PINS=pins;c.irq_pip<<=1;c.nmi_pip<<=1;pins=tick(pins,ud);ticks++;_P();_RD();
 
-uint32_t m6502_exec(m6502_t* cpu, uint32_t num_ticks) {
-  m6502_state_t c = cpu->state;
-  int trap_id = -1;
-  uint8_t l, h;
-  uint16_t a, t;
-  uint32_t ticks = 0;
-  uint64_t pins = c.PINS;
-  const m6502_tick_t tick = cpu->tick;
-  void* ud = cpu->user_data;
-  do {
-    uint64_t pre_pins = pins;
-    _OFF(M6502_IRQ|M6502_NMI);
-    /* fetch opcode */
-    _SA(c.PC++);_ON(M6502_SYNC);_RD();_OFF(M6502_SYNC);
-    /* store 'delayed IRQ response' flag state */
-    c.pi = c.P;
-    const uint8_t opcode = _GD();
-    switch (opcode) {
-      case 0x0:/*BRK */_A_IMP();_RD();c.PC++;_SAD(0x0100|c.S--,c.PC>>8);_WR();_SAD(0x0100|c.S--,c.PC);_WR();_SAD(0x0100|c.S--,c.P|M6502_BF);_WR();_SA(0xFFFE);_RD();l=_GD();_SA(0xFFFF);_RD();h=_GD();c.PC=(h<<8)|l;c.P|=M6502_IF;break;
-      case 0x1:/*ORA (zp,X)*/_A_IDX();_RD();c.A|=_GD();_NZ(c.A);break;
-      case 0x2:/*INVALID*/break;
-      case 0x3:/*SLO (zp,X) (undoc)*/_A_IDX();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x80)?M6502_CF:0);l<<=1;_NZ(l);_SD(l);_WR();c.A|=l;_NZ(c.A);break;
-      case 0x4:/*NOP zp (undoc)*/_A_ZER();_RD();break;
-      case 0x5:/*ORA zp*/_A_ZER();_RD();c.A|=_GD();_NZ(c.A);break;
-      case 0x6:/*ASL zp*/_A_ZER();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x80)?M6502_CF:0);l<<=1;_NZ(l);_SD(l);_WR();break;
-      case 0x7:/*SLO zp (undoc)*/_A_ZER();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x80)?M6502_CF:0);l<<=1;_NZ(l);_SD(l);_WR();c.A|=l;_NZ(c.A);break;
-      case 0x8:/*PHP */_A_IMP();_RD();_SAD(0x0100|c.S--,c.P|M6502_BF);_WR();break;
-      case 0x9:/*ORA #*/_A_IMM();_RD();c.A|=_GD();_NZ(c.A);break;
-      case 0xa:/*ASLA */_A_IMP();_RD();c.P=(c.P&~M6502_CF)|((c.A&0x80)?M6502_CF:0);c.A<<=1;_NZ(c.A);break;
-      case 0xb:/*ANC # (undoc)*/_A_IMM();_RD();c.A&=_GD();_NZ(c.A);if(c.A&0x80){c.P|=M6502_CF;}else{c.P&=~M6502_CF;}break;
-      case 0xc:/*NOP abs (undoc)*/_A_ABS();_RD();break;
-      case 0xd:/*ORA abs*/_A_ABS();_RD();c.A|=_GD();_NZ(c.A);break;
-      case 0xe:/*ASL abs*/_A_ABS();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x80)?M6502_CF:0);l<<=1;_NZ(l);_SD(l);_WR();break;
-      case 0xf:/*SLO abs (undoc)*/_A_ABS();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x80)?M6502_CF:0);l<<=1;_NZ(l);_SD(l);_WR();c.A|=l;_NZ(c.A);break;
-      case 0x10:/*BPL #*/_A_IMM();_RD();if((c.P&0x80)==0x0){_RD();t=c.PC+(int8_t)_GD();if((t&0xFF00)!=(c.PC&0xFF00)){_RD();}c.PC=t;}break;
-      case 0x11:/*ORA (zp),Y*/_A_IDY_R();_RD();c.A|=_GD();_NZ(c.A);break;
-      case 0x12:/*INVALID*/break;
-      case 0x13:/*SLO (zp),Y (undoc)*/_A_IDY_W();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x80)?M6502_CF:0);l<<=1;_NZ(l);_SD(l);_WR();c.A|=l;_NZ(c.A);break;
-      case 0x14:/*NOP zp,X (undoc)*/_A_ZPX();_RD();break;
-      case 0x15:/*ORA zp,X*/_A_ZPX();_RD();c.A|=_GD();_NZ(c.A);break;
-      case 0x16:/*ASL zp,X*/_A_ZPX();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x80)?M6502_CF:0);l<<=1;_NZ(l);_SD(l);_WR();break;
-      case 0x17:/*SLO zp,X (undoc)*/_A_ZPX();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x80)?M6502_CF:0);l<<=1;_NZ(l);_SD(l);_WR();c.A|=l;_NZ(c.A);break;
-      case 0x18:/*CLC */_A_IMP();_RD();c.P&=~0x1;break;
-      case 0x19:/*ORA abs,Y*/_A_ABY_R();_RD();c.A|=_GD();_NZ(c.A);break;
-      case 0x1a:/*NOP  (undoc)*/_A_IMP();_RD();break;
-      case 0x1b:/*SLO abs,Y (undoc)*/_A_ABY_W();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x80)?M6502_CF:0);l<<=1;_NZ(l);_SD(l);_WR();c.A|=l;_NZ(c.A);break;
-      case 0x1c:/*NOP abs,X (undoc)*/_A_ABX_R();_RD();break;
-      case 0x1d:/*ORA abs,X*/_A_ABX_R();_RD();c.A|=_GD();_NZ(c.A);break;
-      case 0x1e:/*ASL abs,X*/_A_ABX_W();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x80)?M6502_CF:0);l<<=1;_NZ(l);_SD(l);_WR();break;
-      case 0x1f:/*SLO abs,X (undoc)*/_A_ABX_W();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x80)?M6502_CF:0);l<<=1;_NZ(l);_SD(l);_WR();c.A|=l;_NZ(c.A);break;
-      case 0x20:/*JSR */_SA(c.PC++);_RD();l=_GD();_SA(0x0100|c.S);_RD();_SAD(0x0100|c.S--,c.PC>>8);_WR();_SAD(0x0100|c.S--,c.PC);_WR();_SA(c.PC);_RD();h=_GD();c.PC=(h<<8)|l;break;
-      case 0x21:/*AND (zp,X)*/_A_IDX();_RD();c.A&=_GD();_NZ(c.A);break;
-      case 0x22:/*INVALID*/break;
-      case 0x23:/*RLA (zp,X) (undoc)*/_A_IDX();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x80){c.P|=M6502_CF;}l<<=1;if(carry){l|=0x01;}_NZ(l);}_SD(l);_WR();c.A&=l;_NZ(c.A);break;
-      case 0x24:/*BIT zp*/_A_ZER();_RD();l=_GD();h=c.A&l;c.P&=~(M6502_NF|M6502_VF|M6502_ZF);if(!h){c.P|=M6502_ZF;}c.P|=l&(M6502_NF|M6502_VF);break;
-      case 0x25:/*AND zp*/_A_ZER();_RD();c.A&=_GD();_NZ(c.A);break;
-      case 0x26:/*ROL zp*/_A_ZER();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x80){c.P|=M6502_CF;}l<<=1;if(carry){l|=0x01;}_NZ(l);}_SD(l);_WR();break;
-      case 0x27:/*RLA zp (undoc)*/_A_ZER();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x80){c.P|=M6502_CF;}l<<=1;if(carry){l|=0x01;}_NZ(l);}_SD(l);_WR();c.A&=l;_NZ(c.A);break;
-      case 0x28:/*PLP */_A_IMP();_RD();_SA(0x0100|c.S++);_RD();_SA(0x0100|c.S);_RD();c.P=(_GD()&~M6502_BF)|M6502_XF;break;
-      case 0x29:/*AND #*/_A_IMM();_RD();c.A&=_GD();_NZ(c.A);break;
-      case 0x2a:/*ROLA */_A_IMP();_RD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(c.A&0x80){c.P|=M6502_CF;}c.A<<=1;if(carry){c.A|=0x01;}_NZ(c.A);}break;
-      case 0x2b:/*ANC # (undoc)*/_A_IMM();_RD();c.A&=_GD();_NZ(c.A);if(c.A&0x80){c.P|=M6502_CF;}else{c.P&=~M6502_CF;}break;
-      case 0x2c:/*BIT abs*/_A_ABS();_RD();l=_GD();h=c.A&l;c.P&=~(M6502_NF|M6502_VF|M6502_ZF);if(!h){c.P|=M6502_ZF;}c.P|=l&(M6502_NF|M6502_VF);break;
-      case 0x2d:/*AND abs*/_A_ABS();_RD();c.A&=_GD();_NZ(c.A);break;
-      case 0x2e:/*ROL abs*/_A_ABS();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x80){c.P|=M6502_CF;}l<<=1;if(carry){l|=0x01;}_NZ(l);}_SD(l);_WR();break;
-      case 0x2f:/*RLA abs (undoc)*/_A_ABS();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x80){c.P|=M6502_CF;}l<<=1;if(carry){l|=0x01;}_NZ(l);}_SD(l);_WR();c.A&=l;_NZ(c.A);break;
-      case 0x30:/*BMI #*/_A_IMM();_RD();if((c.P&0x80)==0x80){_RD();t=c.PC+(int8_t)_GD();if((t&0xFF00)!=(c.PC&0xFF00)){_RD();}c.PC=t;}break;
-      case 0x31:/*AND (zp),Y*/_A_IDY_R();_RD();c.A&=_GD();_NZ(c.A);break;
-      case 0x32:/*INVALID*/break;
-      case 0x33:/*RLA (zp),Y (undoc)*/_A_IDY_W();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x80){c.P|=M6502_CF;}l<<=1;if(carry){l|=0x01;}_NZ(l);}_SD(l);_WR();c.A&=l;_NZ(c.A);break;
-      case 0x34:/*NOP zp,X (undoc)*/_A_ZPX();_RD();break;
-      case 0x35:/*AND zp,X*/_A_ZPX();_RD();c.A&=_GD();_NZ(c.A);break;
-      case 0x36:/*ROL zp,X*/_A_ZPX();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x80){c.P|=M6502_CF;}l<<=1;if(carry){l|=0x01;}_NZ(l);}_SD(l);_WR();break;
-      case 0x37:/*RLA zp,X (undoc)*/_A_ZPX();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x80){c.P|=M6502_CF;}l<<=1;if(carry){l|=0x01;}_NZ(l);}_SD(l);_WR();c.A&=l;_NZ(c.A);break;
-      case 0x38:/*SEC */_A_IMP();_RD();c.P|=0x1;break;
-      case 0x39:/*AND abs,Y*/_A_ABY_R();_RD();c.A&=_GD();_NZ(c.A);break;
-      case 0x3a:/*NOP  (undoc)*/_A_IMP();_RD();break;
-      case 0x3b:/*RLA abs,Y (undoc)*/_A_ABY_W();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x80){c.P|=M6502_CF;}l<<=1;if(carry){l|=0x01;}_NZ(l);}_SD(l);_WR();c.A&=l;_NZ(c.A);break;
-      case 0x3c:/*NOP abs,X (undoc)*/_A_ABX_R();_RD();break;
-      case 0x3d:/*AND abs,X*/_A_ABX_R();_RD();c.A&=_GD();_NZ(c.A);break;
-      case 0x3e:/*ROL abs,X*/_A_ABX_W();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x80){c.P|=M6502_CF;}l<<=1;if(carry){l|=0x01;}_NZ(l);}_SD(l);_WR();break;
-      case 0x3f:/*RLA abs,X (undoc)*/_A_ABX_W();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x80){c.P|=M6502_CF;}l<<=1;if(carry){l|=0x01;}_NZ(l);}_SD(l);_WR();c.A&=l;_NZ(c.A);break;
-      case 0x40:/*RTI */_A_IMP();_RD();_SA(0x0100|c.S++);_RD();_SA(0x0100|c.S++);_RD();c.P=(_GD()&~M6502_BF)|M6502_XF;_SA(0x0100|c.S++);_RD();l=_GD();_SA(0x0100|c.S);_RD();h=_GD();c.PC=(h<<8)|l;c.pi=c.P;break;
-      case 0x41:/*EOR (zp,X)*/_A_IDX();_RD();c.A^=_GD();_NZ(c.A);break;
-      case 0x42:/*INVALID*/break;
-      case 0x43:/*SRE (zp,X) (undoc)*/_A_IDX();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x01)?M6502_CF:0);l>>=1;_NZ(l);_SD(l);_WR();c.A^=l;_NZ(c.A);break;
-      case 0x44:/*NOP zp (undoc)*/_A_ZER();_RD();break;
-      case 0x45:/*EOR zp*/_A_ZER();_RD();c.A^=_GD();_NZ(c.A);break;
-      case 0x46:/*LSR zp*/_A_ZER();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x01)?M6502_CF:0);l>>=1;_NZ(l);_SD(l);_WR();break;
-      case 0x47:/*SRE zp (undoc)*/_A_ZER();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x01)?M6502_CF:0);l>>=1;_NZ(l);_SD(l);_WR();c.A^=l;_NZ(c.A);break;
-      case 0x48:/*PHA */_A_IMP();_RD();_SAD(0x0100|c.S--,c.A);_WR();break;
-      case 0x49:/*EOR #*/_A_IMM();_RD();c.A^=_GD();_NZ(c.A);break;
-      case 0x4a:/*LSRA */_A_IMP();_RD();c.P=(c.P&~M6502_CF)|((c.A&0x01)?M6502_CF:0);c.A>>=1;_NZ(c.A);break;
-      case 0x4b:/*ASR # (undoc)*/_A_IMM();_RD();c.A&=_GD();c.P=(c.P&~M6502_CF)|((c.A&0x01)?M6502_CF:0);c.A>>=1;_NZ(c.A);break;
-      case 0x4c:/*JMP */_SA(c.PC++);_RD();l=_GD();_SA(c.PC++);_RD();h=_GD();c.PC=(h<<8)|l;break;
-      case 0x4d:/*EOR abs*/_A_ABS();_RD();c.A^=_GD();_NZ(c.A);break;
-      case 0x4e:/*LSR abs*/_A_ABS();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x01)?M6502_CF:0);l>>=1;_NZ(l);_SD(l);_WR();break;
-      case 0x4f:/*SRE abs (undoc)*/_A_ABS();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x01)?M6502_CF:0);l>>=1;_NZ(l);_SD(l);_WR();c.A^=l;_NZ(c.A);break;
-      case 0x50:/*BVC #*/_A_IMM();_RD();if((c.P&0x40)==0x0){_RD();t=c.PC+(int8_t)_GD();if((t&0xFF00)!=(c.PC&0xFF00)){_RD();}c.PC=t;}break;
-      case 0x51:/*EOR (zp),Y*/_A_IDY_R();_RD();c.A^=_GD();_NZ(c.A);break;
-      case 0x52:/*INVALID*/break;
-      case 0x53:/*SRE (zp),Y (undoc)*/_A_IDY_W();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x01)?M6502_CF:0);l>>=1;_NZ(l);_SD(l);_WR();c.A^=l;_NZ(c.A);break;
-      case 0x54:/*NOP zp,X (undoc)*/_A_ZPX();_RD();break;
-      case 0x55:/*EOR zp,X*/_A_ZPX();_RD();c.A^=_GD();_NZ(c.A);break;
-      case 0x56:/*LSR zp,X*/_A_ZPX();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x01)?M6502_CF:0);l>>=1;_NZ(l);_SD(l);_WR();break;
-      case 0x57:/*SRE zp,X (undoc)*/_A_ZPX();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x01)?M6502_CF:0);l>>=1;_NZ(l);_SD(l);_WR();c.A^=l;_NZ(c.A);break;
-      case 0x58:/*CLI */_A_IMP();_RD();c.P&=~0x4;break;
-      case 0x59:/*EOR abs,Y*/_A_ABY_R();_RD();c.A^=_GD();_NZ(c.A);break;
-      case 0x5a:/*NOP  (undoc)*/_A_IMP();_RD();break;
-      case 0x5b:/*SRE abs,Y (undoc)*/_A_ABY_W();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x01)?M6502_CF:0);l>>=1;_NZ(l);_SD(l);_WR();c.A^=l;_NZ(c.A);break;
-      case 0x5c:/*NOP abs (undoc)*/_A_ABS();_RD();break;
-      case 0x5d:/*EOR abs,X*/_A_ABX_R();_RD();c.A^=_GD();_NZ(c.A);break;
-      case 0x5e:/*LSR abs,X*/_A_ABX_W();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x01)?M6502_CF:0);l>>=1;_NZ(l);_SD(l);_WR();break;
-      case 0x5f:/*SRE abs,X (undoc)*/_A_ABX_W();_RD();_WR();l=_GD();c.P=(c.P&~M6502_CF)|((l&0x01)?M6502_CF:0);l>>=1;_NZ(l);_SD(l);_WR();c.A^=l;_NZ(c.A);break;
-      case 0x60:/*RTS */_A_IMP();_RD();_SA(0x0100|c.S++);_RD();_SA(0x0100|c.S++);_RD();l=_GD();_SA(0x0100|c.S);_RD();h=_GD();c.PC=(h<<8)|l;_SA(c.PC++);_RD();break;
-      case 0x61:/*ADC (zp,X)*/_A_IDX();_RD();_m6502_adc(&c,_GD());break;
-      case 0x62:/*INVALID*/break;
-      case 0x63:/*RRA (zp,X) (undoc)*/_A_IDX();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x01){c.P|=M6502_CF;}l>>=1;if(carry){l|=0x80;}_NZ(l);}_SD(l);_WR();_m6502_adc(&c,l);break;
-      case 0x64:/*NOP zp (undoc)*/_A_ZER();_RD();break;
-      case 0x65:/*ADC zp*/_A_ZER();_RD();_m6502_adc(&c,_GD());break;
-      case 0x66:/*ROR zp*/_A_ZER();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x01){c.P|=M6502_CF;}l>>=1;if(carry){l|=0x80;}_NZ(l);}_SD(l);_WR();break;
-      case 0x67:/*RRA zp (undoc)*/_A_ZER();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x01){c.P|=M6502_CF;}l>>=1;if(carry){l|=0x80;}_NZ(l);}_SD(l);_WR();_m6502_adc(&c,l);break;
-      case 0x68:/*PLA */_A_IMP();_RD();_SA(0x0100|c.S++);_RD();_SA(0x0100|c.S);_RD();c.A=_GD();_NZ(c.A);break;
-      case 0x69:/*ADC #*/_A_IMM();_RD();_m6502_adc(&c,_GD());break;
-      case 0x6a:/*RORA */_A_IMP();_RD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(c.A&0x01){c.P|=M6502_CF;}c.A>>=1;if(carry){c.A|=0x80;}_NZ(c.A);}break;
-      case 0x6b:/*ARR # (undoc)*/_A_IMM();_RD();c.A&=_GD();_m6502_arr(&c);break;
-      case 0x6c:/*JMPI */_SA(c.PC++);_RD();l=_GD();_SA(c.PC++);_RD();h=_GD();a=(h<<8)|l;_SA(a);_RD();l=_GD();a=(a&0xFF00)|((a+1)&0x00FF);_SA(a);_RD();h=_GD();c.PC=(h<<8)|l;break;
-      case 0x6d:/*ADC abs*/_A_ABS();_RD();_m6502_adc(&c,_GD());break;
-      case 0x6e:/*ROR abs*/_A_ABS();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x01){c.P|=M6502_CF;}l>>=1;if(carry){l|=0x80;}_NZ(l);}_SD(l);_WR();break;
-      case 0x6f:/*RRA abs (undoc)*/_A_ABS();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x01){c.P|=M6502_CF;}l>>=1;if(carry){l|=0x80;}_NZ(l);}_SD(l);_WR();_m6502_adc(&c,l);break;
-      case 0x70:/*BVS #*/_A_IMM();_RD();if((c.P&0x40)==0x40){_RD();t=c.PC+(int8_t)_GD();if((t&0xFF00)!=(c.PC&0xFF00)){_RD();}c.PC=t;}break;
-      case 0x71:/*ADC (zp),Y*/_A_IDY_R();_RD();_m6502_adc(&c,_GD());break;
-      case 0x72:/*INVALID*/break;
-      case 0x73:/*RRA (zp),Y (undoc)*/_A_IDY_W();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x01){c.P|=M6502_CF;}l>>=1;if(carry){l|=0x80;}_NZ(l);}_SD(l);_WR();_m6502_adc(&c,l);break;
-      case 0x74:/*NOP zp,X (undoc)*/_A_ZPX();_RD();break;
-      case 0x75:/*ADC zp,X*/_A_ZPX();_RD();_m6502_adc(&c,_GD());break;
-      case 0x76:/*ROR zp,X*/_A_ZPX();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x01){c.P|=M6502_CF;}l>>=1;if(carry){l|=0x80;}_NZ(l);}_SD(l);_WR();break;
-      case 0x77:/*RRA zp,X (undoc)*/_A_ZPX();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x01){c.P|=M6502_CF;}l>>=1;if(carry){l|=0x80;}_NZ(l);}_SD(l);_WR();_m6502_adc(&c,l);break;
-      case 0x78:/*SEI */_A_IMP();_RD();c.P|=0x4;break;
-      case 0x79:/*ADC abs,Y*/_A_ABY_R();_RD();_m6502_adc(&c,_GD());break;
-      case 0x7a:/*NOP  (undoc)*/_A_IMP();_RD();break;
-      case 0x7b:/*RRA abs,Y (undoc)*/_A_ABY_W();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x01){c.P|=M6502_CF;}l>>=1;if(carry){l|=0x80;}_NZ(l);}_SD(l);_WR();_m6502_adc(&c,l);break;
-      case 0x7c:/*NOP abs (undoc)*/_A_ABS();_RD();break;
-      case 0x7d:/*ADC abs,X*/_A_ABX_R();_RD();_m6502_adc(&c,_GD());break;
-      case 0x7e:/*ROR abs,X*/_A_ABX_W();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x01){c.P|=M6502_CF;}l>>=1;if(carry){l|=0x80;}_NZ(l);}_SD(l);_WR();break;
-      case 0x7f:/*RRA abs,X (undoc)*/_A_ABX_W();_RD();_WR();l=_GD();{bool carry=c.P&M6502_CF;c.P&=~(M6502_NF|M6502_ZF|M6502_CF);if(l&0x01){c.P|=M6502_CF;}l>>=1;if(carry){l|=0x80;}_NZ(l);}_SD(l);_WR();_m6502_adc(&c,l);break;
-      case 0x80:/*NOP # (undoc)*/_A_IMM();_RD();break;
-      case 0x81:/*STA (zp,X)*/_A_IDX();_SD(c.A);_WR();break;
-      case 0x82:/*NOP # (undoc)*/_A_IMM();_RD();break;
-      case 0x83:/*SAX (zp,X) (undoc)*/_A_IDX();_SD(c.A&c.X);_WR();break;
-      case 0x84:/*STY zp*/_A_ZER();_SD(c.Y);_WR();break;
-      case 0x85:/*STA zp*/_A_ZER();_SD(c.A);_WR();break;
-      case 0x86:/*STX zp*/_A_ZER();_SD(c.X);_WR();break;
-      case 0x87:/*SAX zp (undoc)*/_A_ZER();_SD(c.A&c.X);_WR();break;
-      case 0x88:/*DEY */_A_IMP();_RD();c.Y--;_NZ(c.Y);break;
-      case 0x89:/*NOP # (undoc)*/_A_IMM();_RD();break;
-      case 0x8a:/*TXA */_A_IMP();_RD();c.A=c.X;_NZ(c.A);break;
-      case 0x8b:/*ANE # (undoc)*/_A_IMM();_RD();l=_GD();c.A&=l&c.X;_NZ(c.A);break;
-      case 0x8c:/*STY abs*/_A_ABS();_SD(c.Y);_WR();break;
-      case 0x8d:/*STA abs*/_A_ABS();_SD(c.A);_WR();break;
-      case 0x8e:/*STX abs*/_A_ABS();_SD(c.X);_WR();break;
-      case 0x8f:/*SAX abs (undoc)*/_A_ABS();_SD(c.A&c.X);_WR();break;
-      case 0x90:/*BCC #*/_A_IMM();_RD();if((c.P&0x1)==0x0){_RD();t=c.PC+(int8_t)_GD();if((t&0xFF00)!=(c.PC&0xFF00)){_RD();}c.PC=t;}break;
-      case 0x91:/*STA (zp),Y*/_A_IDY_W();_SD(c.A);_WR();break;
-      case 0x92:/*INVALID*/break;
-      case 0x93:/*SHA (not impl) (zp),Y (undoc)*/_A_IDY_W();_RD();break;
-      case 0x94:/*STY zp,X*/_A_ZPX();_SD(c.Y);_WR();break;
-      case 0x95:/*STA zp,X*/_A_ZPX();_SD(c.A);_WR();break;
-      case 0x96:/*STX zp,Y*/_A_ZPY();_SD(c.X);_WR();break;
-      case 0x97:/*SAX zp,Y (undoc)*/_A_ZPY();_SD(c.A&c.X);_WR();break;
-      case 0x98:/*TYA */_A_IMP();_RD();c.A=c.Y;_NZ(c.A);break;
-      case 0x99:/*STA abs,Y*/_A_ABY_W();_SD(c.A);_WR();break;
-      case 0x9a:/*TXS */_A_IMP();_RD();c.S=c.X;break;
-      case 0x9b:/*SHS (not impl) abs,Y (undoc)*/_A_ABY_W();_RD();break;
-      case 0x9c:/*SHY (not impl) abs,X (undoc)*/_A_ABX_W();_RD();break;
-      case 0x9d:/*STA abs,X*/_A_ABX_W();_SD(c.A);_WR();break;
-      case 0x9e:/*SHX (not impl) abs,Y (undoc)*/_A_ABY_W();_RD();break;
-      case 0x9f:/*SHA (not impl) abs,Y (undoc)*/_A_ABY_W();_RD();break;
-      case 0xa0:/*LDY #*/_A_IMM();_RD();c.Y=_GD();_NZ(c.Y);break;
-      case 0xa1:/*LDA (zp,X)*/_A_IDX();_RD();c.A=_GD();_NZ(c.A);break;
-      case 0xa2:/*LDX #*/_A_IMM();_RD();c.X=_GD();_NZ(c.X);break;
-      case 0xa3:/*LAX (zp,X) (undoc)*/_A_IDX();_RD();c.A=c.X=_GD();_NZ(c.A);break;
-      case 0xa4:/*LDY zp*/_A_ZER();_RD();c.Y=_GD();_NZ(c.Y);break;
-      case 0xa5:/*LDA zp*/_A_ZER();_RD();c.A=_GD();_NZ(c.A);break;
-      case 0xa6:/*LDX zp*/_A_ZER();_RD();c.X=_GD();_NZ(c.X);break;
-      case 0xa7:/*LAX zp (undoc)*/_A_ZER();_RD();c.A=c.X=_GD();_NZ(c.A);break;
-      case 0xa8:/*TAY */_A_IMP();_RD();c.Y=c.A;_NZ(c.Y);break;
-      case 0xa9:/*LDA #*/_A_IMM();_RD();c.A=_GD();_NZ(c.A);break;
-      case 0xaa:/*TAX */_A_IMP();_RD();c.X=c.A;_NZ(c.X);break;
-      case 0xab:/*LXA # (undoc)*/_A_IMM();_RD();c.A&=_GD();c.X=c.A;_NZ(c.A);break;
-      case 0xac:/*LDY abs*/_A_ABS();_RD();c.Y=_GD();_NZ(c.Y);break;
-      case 0xad:/*LDA abs*/_A_ABS();_RD();c.A=_GD();_NZ(c.A);break;
-      case 0xae:/*LDX abs*/_A_ABS();_RD();c.X=_GD();_NZ(c.X);break;
-      case 0xaf:/*LAX abs (undoc)*/_A_ABS();_RD();c.A=c.X=_GD();_NZ(c.A);break;
-      case 0xb0:/*BCS #*/_A_IMM();_RD();if((c.P&0x1)==0x1){_RD();t=c.PC+(int8_t)_GD();if((t&0xFF00)!=(c.PC&0xFF00)){_RD();}c.PC=t;}break;
-      case 0xb1:/*LDA (zp),Y*/_A_IDY_R();_RD();c.A=_GD();_NZ(c.A);break;
-      case 0xb2:/*INVALID*/break;
-      case 0xb3:/*LAX (zp),Y (undoc)*/_A_IDY_R();_RD();c.A=c.X=_GD();_NZ(c.A);break;
-      case 0xb4:/*LDY zp,X*/_A_ZPX();_RD();c.Y=_GD();_NZ(c.Y);break;
-      case 0xb5:/*LDA zp,X*/_A_ZPX();_RD();c.A=_GD();_NZ(c.A);break;
-      case 0xb6:/*LDX zp,Y*/_A_ZPY();_RD();c.X=_GD();_NZ(c.X);break;
-      case 0xb7:/*LAX zp,Y (undoc)*/_A_ZPY();_RD();c.A=c.X=_GD();_NZ(c.A);break;
-      case 0xb8:/*CLV */_A_IMP();_RD();c.P&=~0x40;break;
-      case 0xb9:/*LDA abs,Y*/_A_ABY_R();_RD();c.A=_GD();_NZ(c.A);break;
-      case 0xba:/*TSX */_A_IMP();_RD();c.X=c.S;_NZ(c.X);break;
-      case 0xbb:/*LAS (not impl) abs,Y (undoc)*/_A_ABY_R();_RD();break;
-      case 0xbc:/*LDY abs,X*/_A_ABX_R();_RD();c.Y=_GD();_NZ(c.Y);break;
-      case 0xbd:/*LDA abs,X*/_A_ABX_R();_RD();c.A=_GD();_NZ(c.A);break;
-      case 0xbe:/*LDX abs,Y*/_A_ABY_R();_RD();c.X=_GD();_NZ(c.X);break;
-      case 0xbf:/*LAX abs,Y (undoc)*/_A_ABY_R();_RD();c.A=c.X=_GD();_NZ(c.A);break;
-      case 0xc0:/*CPY #*/_A_IMM();_RD();l=_GD();t=c.Y-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xc1:/*CMP (zp,X)*/_A_IDX();_RD();l=_GD();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xc2:/*NOP # (undoc)*/_A_IMM();_RD();break;
-      case 0xc3:/*DCP (zp,X) (undoc)*/_A_IDX();_RD();_WR();l=_GD();l--;_NZ(l);_SD(l);_WR();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xc4:/*CPY zp*/_A_ZER();_RD();l=_GD();t=c.Y-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xc5:/*CMP zp*/_A_ZER();_RD();l=_GD();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xc6:/*DEC zp*/_A_ZER();_RD();l=_GD();_WR();l--;_NZ(l);_SD(l);_WR();break;
-      case 0xc7:/*DCP zp (undoc)*/_A_ZER();_RD();_WR();l=_GD();l--;_NZ(l);_SD(l);_WR();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xc8:/*INY */_A_IMP();_RD();c.Y++;_NZ(c.Y);break;
-      case 0xc9:/*CMP #*/_A_IMM();_RD();l=_GD();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xca:/*DEX */_A_IMP();_RD();c.X--;_NZ(c.X);break;
-      case 0xcb:/*SBX (not impl) # (undoc)*/_A_IMM();_RD();break;
-      case 0xcc:/*CPY abs*/_A_ABS();_RD();l=_GD();t=c.Y-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xcd:/*CMP abs*/_A_ABS();_RD();l=_GD();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xce:/*DEC abs*/_A_ABS();_RD();l=_GD();_WR();l--;_NZ(l);_SD(l);_WR();break;
-      case 0xcf:/*DCP abs (undoc)*/_A_ABS();_RD();_WR();l=_GD();l--;_NZ(l);_SD(l);_WR();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xd0:/*BNE #*/_A_IMM();_RD();if((c.P&0x2)==0x0){_RD();t=c.PC+(int8_t)_GD();if((t&0xFF00)!=(c.PC&0xFF00)){_RD();}c.PC=t;}break;
-      case 0xd1:/*CMP (zp),Y*/_A_IDY_R();_RD();l=_GD();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xd2:/*INVALID*/break;
-      case 0xd3:/*DCP (zp),Y (undoc)*/_A_IDY_W();_RD();_WR();l=_GD();l--;_NZ(l);_SD(l);_WR();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xd4:/*NOP zp,X (undoc)*/_A_ZPX();_RD();break;
-      case 0xd5:/*CMP zp,X*/_A_ZPX();_RD();l=_GD();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xd6:/*DEC zp,X*/_A_ZPX();_RD();l=_GD();_WR();l--;_NZ(l);_SD(l);_WR();break;
-      case 0xd7:/*DCP zp,X (undoc)*/_A_ZPX();_RD();_WR();l=_GD();l--;_NZ(l);_SD(l);_WR();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xd8:/*CLD */_A_IMP();_RD();c.P&=~0x8;break;
-      case 0xd9:/*CMP abs,Y*/_A_ABY_R();_RD();l=_GD();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xda:/*NOP  (undoc)*/_A_IMP();_RD();break;
-      case 0xdb:/*DCP abs,Y (undoc)*/_A_ABY_W();_RD();_WR();l=_GD();l--;_NZ(l);_SD(l);_WR();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xdc:/*NOP abs,X (undoc)*/_A_ABX_R();_RD();break;
-      case 0xdd:/*CMP abs,X*/_A_ABX_R();_RD();l=_GD();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xde:/*DEC abs,X*/_A_ABX_W();_RD();l=_GD();_WR();l--;_NZ(l);_SD(l);_WR();break;
-      case 0xdf:/*DCP abs,X (undoc)*/_A_ABX_W();_RD();_WR();l=_GD();l--;_NZ(l);_SD(l);_WR();t=c.A-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xe0:/*CPX #*/_A_IMM();_RD();l=_GD();t=c.X-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xe1:/*SBC (zp,X)*/_A_IDX();_RD();_m6502_sbc(&c,_GD());break;
-      case 0xe2:/*NOP # (undoc)*/_A_IMM();_RD();break;
-      case 0xe3:/*ISB (zp,X) (undoc)*/_A_IDX();_RD();_WR();l=_GD();l++;_SD(l);_WR();_m6502_sbc(&c,l);break;
-      case 0xe4:/*CPX zp*/_A_ZER();_RD();l=_GD();t=c.X-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xe5:/*SBC zp*/_A_ZER();_RD();_m6502_sbc(&c,_GD());break;
-      case 0xe6:/*INC zp*/_A_ZER();_RD();l=_GD();_WR();l++;_NZ(l);_SD(l);_WR();break;
-      case 0xe7:/*ISB zp (undoc)*/_A_ZER();_RD();_WR();l=_GD();l++;_SD(l);_WR();_m6502_sbc(&c,l);break;
-      case 0xe8:/*INX */_A_IMP();_RD();c.X++;_NZ(c.X);break;
-      case 0xe9:/*SBC #*/_A_IMM();_RD();_m6502_sbc(&c,_GD());break;
-      case 0xea:/*NOP */_A_IMP();_RD();break;
-      case 0xeb:/*SBC # (undoc)*/_A_IMM();_RD();_m6502_sbc(&c,_GD());break;
-      case 0xec:/*CPX abs*/_A_ABS();_RD();l=_GD();t=c.X-l;_NZ((uint8_t)t)&~M6502_CF;if(!(t&0xFF00)){c.P|=M6502_CF;}break;
-      case 0xed:/*SBC abs*/_A_ABS();_RD();_m6502_sbc(&c,_GD());break;
-      case 0xee:/*INC abs*/_A_ABS();_RD();l=_GD();_WR();l++;_NZ(l);_SD(l);_WR();break;
-      case 0xef:/*ISB abs (undoc)*/_A_ABS();_RD();_WR();l=_GD();l++;_SD(l);_WR();_m6502_sbc(&c,l);break;
-      case 0xf0:/*BEQ #*/_A_IMM();_RD();if((c.P&0x2)==0x2){_RD();t=c.PC+(int8_t)_GD();if((t&0xFF00)!=(c.PC&0xFF00)){_RD();}c.PC=t;}break;
-      case 0xf1:/*SBC (zp),Y*/_A_IDY_R();_RD();_m6502_sbc(&c,_GD());break;
-      case 0xf2:/*INVALID*/break;
-      case 0xf3:/*ISB (zp),Y (undoc)*/_A_IDY_W();_RD();_WR();l=_GD();l++;_SD(l);_WR();_m6502_sbc(&c,l);break;
-      case 0xf4:/*NOP zp,X (undoc)*/_A_ZPX();_RD();break;
-      case 0xf5:/*SBC zp,X*/_A_ZPX();_RD();_m6502_sbc(&c,_GD());break;
-      case 0xf6:/*INC zp,X*/_A_ZPX();_RD();l=_GD();_WR();l++;_NZ(l);_SD(l);_WR();break;
-      case 0xf7:/*ISB zp,X (undoc)*/_A_ZPX();_RD();_WR();l=_GD();l++;_SD(l);_WR();_m6502_sbc(&c,l);break;
-      case 0xf8:/*SED */_A_IMP();_RD();c.P|=0x8;break;
-      case 0xf9:/*SBC abs,Y*/_A_ABY_R();_RD();_m6502_sbc(&c,_GD());break;
-      case 0xfa:/*NOP  (undoc)*/_A_IMP();_RD();break;
-      case 0xfb:/*ISB abs,Y (undoc)*/_A_ABY_W();_RD();_WR();l=_GD();l++;_SD(l);_WR();_m6502_sbc(&c,l);break;
-      case 0xfc:/*NOP abs,X (undoc)*/_A_ABX_R();_RD();break;
-      case 0xfd:/*SBC abs,X*/_A_ABX_R();_RD();_m6502_sbc(&c,_GD());break;
-      case 0xfe:/*INC abs,X*/_A_ABX_W();_RD();l=_GD();_WR();l++;_NZ(l);_SD(l);_WR();break;
-      case 0xff:/*ISB abs,X (undoc)*/_A_ABX_W();_RD();_WR();l=_GD();l++;_SD(l);_WR();_m6502_sbc(&c,l);break;
+uint32_t m6502_exec(m6502_t* cpu, uint64_t* pins_ptr, uint32_t num_ticks, m6502_tick_t tick, void* ud) {
+    uint64_t pins = *pins_ptr;
+    uint32_t ticks = 0;
+    /* if not at an instruction boundary, continue cycle-stepped until the next opcode fetch */
+    while (!(pins & M6502_SYNC) && (ticks < num_ticks)) {
+        pins = tick(m6502_tick(cpu, pins), ud);
+        ticks++;
     }
-    /* edge detection for NMI pin */
-    bool nmi = 0 != ((pins & (pre_pins ^ pins)) & M6502_NMI);
-    /* check for interrupt request */
-    if (nmi || ((pins & M6502_IRQ) && !(c.pi & M6502_IF))) {
-      /* execute a slightly modified BRK instruction, do NOT increment PC! */
-      _SA(c.PC);_ON(M6502_SYNC);_RD();_OFF(M6502_SYNC);
-      _SA(c.PC); _RD();
-      _SAD(0x0100|c.S--, c.PC>>8); _WR();
-      _SAD(0x0100|c.S--, c.PC); _WR();
-      _SAD(0x0100|c.S--, c.P&~M6502_BF); _WR();
-      if (pins & M6502_NMI) {
-        _SA(0xFFFA); _RD(); l=_GD();
-        c.P |= M6502_IF;
-        _SA(0xFFFB); _RD(); h=_GD();
-      }
-      else {
-        _SA(0xFFFE); _RD(); l=_GD();
-        c.P |= M6502_IF;
-        _SA(0xFFFF); _RD(); h=_GD();
-      }
-      c.PC = (h<<8)|l;
+    if (!(pins & M6502_SYNC) || cpu->exec_break) {
+        *pins_ptr = pins;
+        return ticks;
     }
-    for (int i=0; i<M6502_MAX_NUM_TRAPS; i++) {
-      if (cpu->trap_valid[i] && (c.PC==cpu->trap_addr[i])) {
-        trap_id=i;
-      }
+    /* only the register state is kept in locals, the 6510 IO port state
+       may be modified from within the tick callback
+    */
+    m6502_t c;
+    c.IR = cpu->IR; c.PC = cpu->PC; c.AD = cpu->AD;
+    c.A = cpu->A; c.X = cpu->X; c.Y = cpu->Y; c.S = cpu->S; c.P = cpu->P;
+    c.PINS = cpu->PINS;
+    c.irq_pip = cpu->irq_pip; c.nmi_pip = cpu->nmi_pip;
+    c.brk_flags = cpu->brk_flags;
+    c.bcd_enabled = cpu->bcd_enabled;
+    _P();
+    if ((pins & (M6502_RW|M6502_RDY)) == (M6502_RW|M6502_RDY)) {
+        /* still stalled when the tick budget ran out */
+        goto _exit;
     }
-  } while ((ticks < num_ticks) && (trap_id < 0));
-  c.PINS = pins;
-  cpu->state = c;
-  cpu->trap_id = trap_id;
-  return ticks;
+    do {
+        /* load new instruction into 'instruction register' and check interrupts, see m6502_tick() */
+        c.IR = _GD()<<3;
+        _OFF(M6502_SYNC);
+        if (0 != (c.irq_pip & 0x400)) {
+            c.brk_flags |= M6502_BRK_IRQ;
+        }
+        if (0 != (c.nmi_pip & 0xFC00)) {
+            c.brk_flags |= M6502_BRK_NMI;
+        }
+        if (0 != (pins & M6502_RES)) {
+            c.brk_flags |= M6502_BRK_RESET;
+            cpu->io_ddr = 0;
+            cpu->io_out = 0;
+            cpu->io_inp = 0;
+            cpu->io_pins = 0;
+        }
+        c.irq_pip &= 0x3FF;
+        c.nmi_pip &= 0x3FF;
+        if (c.brk_flags) {
+            c.IR = 0;
+            c.P &= ~M6502_BF;
+            pins &= ~M6502_RES;
+        }
+        else {
+            c.PC++;
+        }
+        _RD();
+        switch (c.IR>>3) {
+        /* BRK */
+        case 0x00:
+            _SA(c.PC);_T();
+            if(0==(c.brk_flags&(M6502_BRK_IRQ|M6502_BRK_NMI))){c.PC++;}_SAD(0x0100|c.S--,c.PC>>8);if(0==(c.brk_flags&M6502_BRK_RESET)){_WR();}_T();
+            _SAD(0x0100|c.S--,c.PC);if(0==(c.brk_flags&M6502_BRK_RESET)){_WR();}_T();
+            _SAD(0x0100|c.S--,c.P|M6502_XF);if(c.brk_flags&M6502_BRK_RESET){c.AD=0xFFFC;}else{_WR();if(c.brk_flags&M6502_BRK_NMI){c.AD=0xFFFA;}else{c.AD=0xFFFE;}}_T();
+            _SA(c.AD++);c.P|=(M6502_IF|M6502_BF);c.brk_flags=0; /* RES/NMI hijacking */_T();
+            _SA(c.AD);c.AD=_GD(); /* NMI "half-hijacking" not possible */_T();
+            c.PC=(_GD()<<8)|c.AD;_FETCH();_T();break;
+        /* ORA (zp,X) */
+        case 0x01:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.A|=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0x02:
+            _SA(c.PC);_T();
+            _02_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _02_1;}c.IR=(0x02<<3)|1;goto _exit;
+        /* SLO (zp,X) (undoc) */
+        case 0x03:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_asl(&c,c.AD);_SD(c.AD);c.A|=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP zp (undoc) */
+        case 0x04:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            _FETCH();_T();break;
+        /* ORA zp */
+        case 0x05:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.A|=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* ASL zp */
+        case 0x06:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_asl(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* SLO zp (undoc) */
+        case 0x07:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_asl(&c,c.AD);_SD(c.AD);c.A|=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* PHP */
+        case 0x08:
+            _SA(c.PC);_T();
+            _SAD(0x0100|c.S--,c.P|M6502_XF);_WR();_T();
+            _FETCH();_T();break;
+        /* ORA # */
+        case 0x09:
+            _SA(c.PC++);_T();
+            c.A|=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* ASLA */
+        case 0x0A:
+            _SA(c.PC);_T();
+            c.A=_m6502_asl(&c,c.A);_FETCH();_T();break;
+        /* ANC # (undoc) */
+        case 0x0B:
+            _SA(c.PC++);_T();
+            c.A&=_GD();_NZ(c.A);if(c.A&0x80){c.P|=M6502_CF;}else{c.P&=~M6502_CF;}_FETCH();_T();break;
+        /* NOP abs (undoc) */
+        case 0x0C:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            _FETCH();_T();break;
+        /* ORA abs */
+        case 0x0D:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.A|=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* ASL abs */
+        case 0x0E:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_asl(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* SLO abs (undoc) */
+        case 0x0F:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_asl(&c,c.AD);_SD(c.AD);c.A|=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* BPL # */
+        case 0x10:
+            _SA(c.PC++);_T();
+            _SA(c.PC);c.AD=c.PC+(int8_t)_GD();if((c.P&0x80)!=0x0){_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            _SA((c.PC&0xFF00)|(c.AD&0x00FF));if((c.AD&0xFF00)==(c.PC&0xFF00)){c.PC=c.AD;c.irq_pip>>=1;c.nmi_pip>>=1;_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            c.PC=c.AD;_FETCH();_T();break;
+        /* ORA (zp),Y */
+        case 0x11:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _11_5;}
+            _SA(c.AD+c.Y);_T();
+            _11_5: c.A|=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0x12:
+            _SA(c.PC);_T();
+            _12_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _12_1;}c.IR=(0x12<<3)|1;goto _exit;
+        /* SLO (zp),Y (undoc) */
+        case 0x13:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_asl(&c,c.AD);_SD(c.AD);c.A|=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP zp,X (undoc) */
+        case 0x14:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            _FETCH();_T();break;
+        /* ORA zp,X */
+        case 0x15:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.A|=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* ASL zp,X */
+        case 0x16:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_asl(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* SLO zp,X (undoc) */
+        case 0x17:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_asl(&c,c.AD);_SD(c.AD);c.A|=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* CLC */
+        case 0x18:
+            _SA(c.PC);_T();
+            c.P&=~0x1;_FETCH();_T();break;
+        /* ORA abs,Y */
+        case 0x19:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _19_4;}
+            _SA(c.AD+c.Y);_T();
+            _19_4: c.A|=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* NOP  (undoc) */
+        case 0x1A:
+            _SA(c.PC);_T();
+            _FETCH();_T();break;
+        /* SLO abs,Y (undoc) */
+        case 0x1B:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_asl(&c,c.AD);_SD(c.AD);c.A|=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP abs,X (undoc) */
+        case 0x1C:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _1C_4;}
+            _SA(c.AD+c.X);_T();
+            _1C_4: _FETCH();_T();break;
+        /* ORA abs,X */
+        case 0x1D:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _1D_4;}
+            _SA(c.AD+c.X);_T();
+            _1D_4: c.A|=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* ASL abs,X */
+        case 0x1E:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_asl(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* SLO abs,X (undoc) */
+        case 0x1F:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_asl(&c,c.AD);_SD(c.AD);c.A|=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* JSR */
+        case 0x20:
+            _SA(c.PC++);_T();
+            _SA(0x0100|c.S);c.AD=_GD();_T();
+            _SAD(0x0100|c.S--,c.PC>>8);_WR();_T();
+            _SAD(0x0100|c.S--,c.PC);_WR();_T();
+            _SA(c.PC);_T();
+            c.PC=(_GD()<<8)|c.AD;_FETCH();_T();break;
+        /* AND (zp,X) */
+        case 0x21:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.A&=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0x22:
+            _SA(c.PC);_T();
+            _22_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _22_1;}c.IR=(0x22<<3)|1;goto _exit;
+        /* RLA (zp,X) (undoc) */
+        case 0x23:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_rol(&c,c.AD);_SD(c.AD);c.A&=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* BIT zp */
+        case 0x24:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            _m6502_bit(&c,_GD());_FETCH();_T();break;
+        /* AND zp */
+        case 0x25:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.A&=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* ROL zp */
+        case 0x26:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_rol(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* RLA zp (undoc) */
+        case 0x27:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_rol(&c,c.AD);_SD(c.AD);c.A&=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* PLP */
+        case 0x28:
+            _SA(c.PC);_T();
+            _SA(0x0100|c.S++);_T();
+            _SA(0x0100|c.S);_T();
+            c.P=(_GD()|M6502_BF)&~M6502_XF;_FETCH();_T();break;
+        /* AND # */
+        case 0x29:
+            _SA(c.PC++);_T();
+            c.A&=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* ROLA */
+        case 0x2A:
+            _SA(c.PC);_T();
+            c.A=_m6502_rol(&c,c.A);_FETCH();_T();break;
+        /* ANC # (undoc) */
+        case 0x2B:
+            _SA(c.PC++);_T();
+            c.A&=_GD();_NZ(c.A);if(c.A&0x80){c.P|=M6502_CF;}else{c.P&=~M6502_CF;}_FETCH();_T();break;
+        /* BIT abs */
+        case 0x2C:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            _m6502_bit(&c,_GD());_FETCH();_T();break;
+        /* AND abs */
+        case 0x2D:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.A&=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* ROL abs */
+        case 0x2E:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_rol(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* RLA abs (undoc) */
+        case 0x2F:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_rol(&c,c.AD);_SD(c.AD);c.A&=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* BMI # */
+        case 0x30:
+            _SA(c.PC++);_T();
+            _SA(c.PC);c.AD=c.PC+(int8_t)_GD();if((c.P&0x80)!=0x80){_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            _SA((c.PC&0xFF00)|(c.AD&0x00FF));if((c.AD&0xFF00)==(c.PC&0xFF00)){c.PC=c.AD;c.irq_pip>>=1;c.nmi_pip>>=1;_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            c.PC=c.AD;_FETCH();_T();break;
+        /* AND (zp),Y */
+        case 0x31:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _31_5;}
+            _SA(c.AD+c.Y);_T();
+            _31_5: c.A&=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0x32:
+            _SA(c.PC);_T();
+            _32_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _32_1;}c.IR=(0x32<<3)|1;goto _exit;
+        /* RLA (zp),Y (undoc) */
+        case 0x33:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_rol(&c,c.AD);_SD(c.AD);c.A&=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP zp,X (undoc) */
+        case 0x34:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            _FETCH();_T();break;
+        /* AND zp,X */
+        case 0x35:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.A&=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* ROL zp,X */
+        case 0x36:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_rol(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* RLA zp,X (undoc) */
+        case 0x37:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_rol(&c,c.AD);_SD(c.AD);c.A&=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* SEC */
+        case 0x38:
+            _SA(c.PC);_T();
+            c.P|=0x1;_FETCH();_T();break;
+        /* AND abs,Y */
+        case 0x39:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _39_4;}
+            _SA(c.AD+c.Y);_T();
+            _39_4: c.A&=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* NOP  (undoc) */
+        case 0x3A:
+            _SA(c.PC);_T();
+            _FETCH();_T();break;
+        /* RLA abs,Y (undoc) */
+        case 0x3B:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_rol(&c,c.AD);_SD(c.AD);c.A&=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP abs,X (undoc) */
+        case 0x3C:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _3C_4;}
+            _SA(c.AD+c.X);_T();
+            _3C_4: _FETCH();_T();break;
+        /* AND abs,X */
+        case 0x3D:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _3D_4;}
+            _SA(c.AD+c.X);_T();
+            _3D_4: c.A&=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* ROL abs,X */
+        case 0x3E:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_rol(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* RLA abs,X (undoc) */
+        case 0x3F:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_rol(&c,c.AD);_SD(c.AD);c.A&=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* RTI */
+        case 0x40:
+            _SA(c.PC);_T();
+            _SA(0x0100|c.S++);_T();
+            _SA(0x0100|c.S++);_T();
+            _SA(0x0100|c.S++);c.P=(_GD()|M6502_BF)&~M6502_XF;_T();
+            _SA(0x0100|c.S);c.AD=_GD();_T();
+            c.PC=(_GD()<<8)|c.AD;_FETCH();_T();break;
+        /* EOR (zp,X) */
+        case 0x41:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.A^=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0x42:
+            _SA(c.PC);_T();
+            _42_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _42_1;}c.IR=(0x42<<3)|1;goto _exit;
+        /* SRE (zp,X) (undoc) */
+        case 0x43:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_lsr(&c,c.AD);_SD(c.AD);c.A^=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP zp (undoc) */
+        case 0x44:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            _FETCH();_T();break;
+        /* EOR zp */
+        case 0x45:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.A^=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LSR zp */
+        case 0x46:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_lsr(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* SRE zp (undoc) */
+        case 0x47:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_lsr(&c,c.AD);_SD(c.AD);c.A^=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* PHA */
+        case 0x48:
+            _SA(c.PC);_T();
+            _SAD(0x0100|c.S--,c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* EOR # */
+        case 0x49:
+            _SA(c.PC++);_T();
+            c.A^=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LSRA */
+        case 0x4A:
+            _SA(c.PC);_T();
+            c.A=_m6502_lsr(&c,c.A);_FETCH();_T();break;
+        /* ASR # (undoc) */
+        case 0x4B:
+            _SA(c.PC++);_T();
+            c.A&=_GD();c.A=_m6502_lsr(&c,c.A);_FETCH();_T();break;
+        /* JMP */
+        case 0x4C:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.PC=(_GD()<<8)|c.AD;_FETCH();_T();break;
+        /* EOR abs */
+        case 0x4D:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.A^=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LSR abs */
+        case 0x4E:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_lsr(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* SRE abs (undoc) */
+        case 0x4F:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_lsr(&c,c.AD);_SD(c.AD);c.A^=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* BVC # */
+        case 0x50:
+            _SA(c.PC++);_T();
+            _SA(c.PC);c.AD=c.PC+(int8_t)_GD();if((c.P&0x40)!=0x0){_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            _SA((c.PC&0xFF00)|(c.AD&0x00FF));if((c.AD&0xFF00)==(c.PC&0xFF00)){c.PC=c.AD;c.irq_pip>>=1;c.nmi_pip>>=1;_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            c.PC=c.AD;_FETCH();_T();break;
+        /* EOR (zp),Y */
+        case 0x51:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _51_5;}
+            _SA(c.AD+c.Y);_T();
+            _51_5: c.A^=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0x52:
+            _SA(c.PC);_T();
+            _52_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _52_1;}c.IR=(0x52<<3)|1;goto _exit;
+        /* SRE (zp),Y (undoc) */
+        case 0x53:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_lsr(&c,c.AD);_SD(c.AD);c.A^=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP zp,X (undoc) */
+        case 0x54:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            _FETCH();_T();break;
+        /* EOR zp,X */
+        case 0x55:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.A^=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LSR zp,X */
+        case 0x56:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_lsr(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* SRE zp,X (undoc) */
+        case 0x57:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_lsr(&c,c.AD);_SD(c.AD);c.A^=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* CLI */
+        case 0x58:
+            _SA(c.PC);_T();
+            c.P&=~0x4;_FETCH();_T();break;
+        /* EOR abs,Y */
+        case 0x59:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _59_4;}
+            _SA(c.AD+c.Y);_T();
+            _59_4: c.A^=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* NOP  (undoc) */
+        case 0x5A:
+            _SA(c.PC);_T();
+            _FETCH();_T();break;
+        /* SRE abs,Y (undoc) */
+        case 0x5B:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_lsr(&c,c.AD);_SD(c.AD);c.A^=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP abs,X (undoc) */
+        case 0x5C:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _5C_4;}
+            _SA(c.AD+c.X);_T();
+            _5C_4: _FETCH();_T();break;
+        /* EOR abs,X */
+        case 0x5D:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _5D_4;}
+            _SA(c.AD+c.X);_T();
+            _5D_4: c.A^=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LSR abs,X */
+        case 0x5E:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_lsr(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* SRE abs,X (undoc) */
+        case 0x5F:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_lsr(&c,c.AD);_SD(c.AD);c.A^=c.AD;_NZ(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* RTS */
+        case 0x60:
+            _SA(c.PC);_T();
+            _SA(0x0100|c.S++);_T();
+            _SA(0x0100|c.S++);_T();
+            _SA(0x0100|c.S);c.AD=_GD();_T();
+            c.PC=(_GD()<<8)|c.AD;_SA(c.PC++);_T();
+            _FETCH();_T();break;
+        /* ADC (zp,X) */
+        case 0x61:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            _m6502_adc(&c,_GD());_FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0x62:
+            _SA(c.PC);_T();
+            _62_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _62_1;}c.IR=(0x62<<3)|1;goto _exit;
+        /* RRA (zp,X) (undoc) */
+        case 0x63:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_ror(&c,c.AD);_SD(c.AD);_m6502_adc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP zp (undoc) */
+        case 0x64:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            _FETCH();_T();break;
+        /* ADC zp */
+        case 0x65:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            _m6502_adc(&c,_GD());_FETCH();_T();break;
+        /* ROR zp */
+        case 0x66:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_ror(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* RRA zp (undoc) */
+        case 0x67:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_ror(&c,c.AD);_SD(c.AD);_m6502_adc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* PLA */
+        case 0x68:
+            _SA(c.PC);_T();
+            _SA(0x0100|c.S++);_T();
+            _SA(0x0100|c.S);_T();
+            c.A=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* ADC # */
+        case 0x69:
+            _SA(c.PC++);_T();
+            _m6502_adc(&c,_GD());_FETCH();_T();break;
+        /* RORA */
+        case 0x6A:
+            _SA(c.PC);_T();
+            c.A=_m6502_ror(&c,c.A);_FETCH();_T();break;
+        /* ARR # (undoc) */
+        case 0x6B:
+            _SA(c.PC++);_T();
+            c.A&=_GD();_m6502_arr(&c);_FETCH();_T();break;
+        /* JMPI */
+        case 0x6C:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA(c.AD);_T();
+            _SA((c.AD&0xFF00)|((c.AD+1)&0x00FF));c.AD=_GD();_T();
+            c.PC=(_GD()<<8)|c.AD;_FETCH();_T();break;
+        /* ADC abs */
+        case 0x6D:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            _m6502_adc(&c,_GD());_FETCH();_T();break;
+        /* ROR abs */
+        case 0x6E:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_ror(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* RRA abs (undoc) */
+        case 0x6F:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_ror(&c,c.AD);_SD(c.AD);_m6502_adc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* BVS # */
+        case 0x70:
+            _SA(c.PC++);_T();
+            _SA(c.PC);c.AD=c.PC+(int8_t)_GD();if((c.P&0x40)!=0x40){_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            _SA((c.PC&0xFF00)|(c.AD&0x00FF));if((c.AD&0xFF00)==(c.PC&0xFF00)){c.PC=c.AD;c.irq_pip>>=1;c.nmi_pip>>=1;_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            c.PC=c.AD;_FETCH();_T();break;
+        /* ADC (zp),Y */
+        case 0x71:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _71_5;}
+            _SA(c.AD+c.Y);_T();
+            _71_5: _m6502_adc(&c,_GD());_FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0x72:
+            _SA(c.PC);_T();
+            _72_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _72_1;}c.IR=(0x72<<3)|1;goto _exit;
+        /* RRA (zp),Y (undoc) */
+        case 0x73:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_ror(&c,c.AD);_SD(c.AD);_m6502_adc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP zp,X (undoc) */
+        case 0x74:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            _FETCH();_T();break;
+        /* ADC zp,X */
+        case 0x75:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            _m6502_adc(&c,_GD());_FETCH();_T();break;
+        /* ROR zp,X */
+        case 0x76:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_ror(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* RRA zp,X (undoc) */
+        case 0x77:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_ror(&c,c.AD);_SD(c.AD);_m6502_adc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* SEI */
+        case 0x78:
+            _SA(c.PC);_T();
+            c.P|=0x4;_FETCH();_T();break;
+        /* ADC abs,Y */
+        case 0x79:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _79_4;}
+            _SA(c.AD+c.Y);_T();
+            _79_4: _m6502_adc(&c,_GD());_FETCH();_T();break;
+        /* NOP  (undoc) */
+        case 0x7A:
+            _SA(c.PC);_T();
+            _FETCH();_T();break;
+        /* RRA abs,Y (undoc) */
+        case 0x7B:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_ror(&c,c.AD);_SD(c.AD);_m6502_adc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP abs,X (undoc) */
+        case 0x7C:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _7C_4;}
+            _SA(c.AD+c.X);_T();
+            _7C_4: _FETCH();_T();break;
+        /* ADC abs,X */
+        case 0x7D:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _7D_4;}
+            _SA(c.AD+c.X);_T();
+            _7D_4: _m6502_adc(&c,_GD());_FETCH();_T();break;
+        /* ROR abs,X */
+        case 0x7E:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            _SD(_m6502_ror(&c,c.AD));_WR();_T();
+            _FETCH();_T();break;
+        /* RRA abs,X (undoc) */
+        case 0x7F:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD=_m6502_ror(&c,c.AD);_SD(c.AD);_m6502_adc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP # (undoc) */
+        case 0x80:
+            _SA(c.PC++);_T();
+            _FETCH();_T();break;
+        /* STA (zp,X) */
+        case 0x81:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_SD(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP # (undoc) */
+        case 0x82:
+            _SA(c.PC++);_T();
+            _FETCH();_T();break;
+        /* SAX (zp,X) (undoc) */
+        case 0x83:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_SD(c.A&c.X);_WR();_T();
+            _FETCH();_T();break;
+        /* STY zp */
+        case 0x84:
+            _SA(c.PC++);_T();
+            _SA(_GD());_SD(c.Y);_WR();_T();
+            _FETCH();_T();break;
+        /* STA zp */
+        case 0x85:
+            _SA(c.PC++);_T();
+            _SA(_GD());_SD(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* STX zp */
+        case 0x86:
+            _SA(c.PC++);_T();
+            _SA(_GD());_SD(c.X);_WR();_T();
+            _FETCH();_T();break;
+        /* SAX zp (undoc) */
+        case 0x87:
+            _SA(c.PC++);_T();
+            _SA(_GD());_SD(c.A&c.X);_WR();_T();
+            _FETCH();_T();break;
+        /* DEY */
+        case 0x88:
+            _SA(c.PC);_T();
+            c.Y--;_NZ(c.Y);_FETCH();_T();break;
+        /* NOP # (undoc) */
+        case 0x89:
+            _SA(c.PC++);_T();
+            _FETCH();_T();break;
+        /* TXA */
+        case 0x8A:
+            _SA(c.PC);_T();
+            c.A=c.X;_NZ(c.A);_FETCH();_T();break;
+        /* ANE # (undoc) */
+        case 0x8B:
+            _SA(c.PC++);_T();
+            c.A=(c.A|0xEE)&c.X&_GD();_NZ(c.A);_FETCH();_T();break;
+        /* STY abs */
+        case 0x8C:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_SD(c.Y);_WR();_T();
+            _FETCH();_T();break;
+        /* STA abs */
+        case 0x8D:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_SD(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* STX abs */
+        case 0x8E:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_SD(c.X);_WR();_T();
+            _FETCH();_T();break;
+        /* SAX abs (undoc) */
+        case 0x8F:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_SD(c.A&c.X);_WR();_T();
+            _FETCH();_T();break;
+        /* BCC # */
+        case 0x90:
+            _SA(c.PC++);_T();
+            _SA(c.PC);c.AD=c.PC+(int8_t)_GD();if((c.P&0x1)!=0x0){_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            _SA((c.PC&0xFF00)|(c.AD&0x00FF));if((c.AD&0xFF00)==(c.PC&0xFF00)){c.PC=c.AD;c.irq_pip>>=1;c.nmi_pip>>=1;_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            c.PC=c.AD;_FETCH();_T();break;
+        /* STA (zp),Y */
+        case 0x91:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_SD(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0x92:
+            _SA(c.PC);_T();
+            _92_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _92_1;}c.IR=(0x92<<3)|1;goto _exit;
+        /* SHA (zp),Y (undoc) */
+        case 0x93:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_SD(c.A&c.X&(uint8_t)((_GA()>>8)+1));_WR();_T();
+            _FETCH();_T();break;
+        /* STY zp,X */
+        case 0x94:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_SD(c.Y);_WR();_T();
+            _FETCH();_T();break;
+        /* STA zp,X */
+        case 0x95:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_SD(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* STX zp,Y */
+        case 0x96:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.Y)&0x00FF);_SD(c.X);_WR();_T();
+            _FETCH();_T();break;
+        /* SAX zp,Y (undoc) */
+        case 0x97:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.Y)&0x00FF);_SD(c.A&c.X);_WR();_T();
+            _FETCH();_T();break;
+        /* TYA */
+        case 0x98:
+            _SA(c.PC);_T();
+            c.A=c.Y;_NZ(c.A);_FETCH();_T();break;
+        /* STA abs,Y */
+        case 0x99:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_SD(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* TXS */
+        case 0x9A:
+            _SA(c.PC);_T();
+            c.S=c.X;_FETCH();_T();break;
+        /* SHS abs,Y (undoc) */
+        case 0x9B:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);c.S=c.A&c.X;_SD(c.S&(uint8_t)((_GA()>>8)+1));_WR();_T();
+            _FETCH();_T();break;
+        /* SHY abs,X (undoc) */
+        case 0x9C:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_SD(c.Y&(uint8_t)((_GA()>>8)+1));_WR();_T();
+            _FETCH();_T();break;
+        /* STA abs,X */
+        case 0x9D:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_SD(c.A);_WR();_T();
+            _FETCH();_T();break;
+        /* SHX abs,Y (undoc) */
+        case 0x9E:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_SD(c.X&(uint8_t)((_GA()>>8)+1));_WR();_T();
+            _FETCH();_T();break;
+        /* SHA abs,Y (undoc) */
+        case 0x9F:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_SD(c.A&c.X&(uint8_t)((_GA()>>8)+1));_WR();_T();
+            _FETCH();_T();break;
+        /* LDY # */
+        case 0xA0:
+            _SA(c.PC++);_T();
+            c.Y=_GD();_NZ(c.Y);_FETCH();_T();break;
+        /* LDA (zp,X) */
+        case 0xA1:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.A=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LDX # */
+        case 0xA2:
+            _SA(c.PC++);_T();
+            c.X=_GD();_NZ(c.X);_FETCH();_T();break;
+        /* LAX (zp,X) (undoc) */
+        case 0xA3:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.A=c.X=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LDY zp */
+        case 0xA4:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.Y=_GD();_NZ(c.Y);_FETCH();_T();break;
+        /* LDA zp */
+        case 0xA5:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.A=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LDX zp */
+        case 0xA6:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.X=_GD();_NZ(c.X);_FETCH();_T();break;
+        /* LAX zp (undoc) */
+        case 0xA7:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.A=c.X=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* TAY */
+        case 0xA8:
+            _SA(c.PC);_T();
+            c.Y=c.A;_NZ(c.Y);_FETCH();_T();break;
+        /* LDA # */
+        case 0xA9:
+            _SA(c.PC++);_T();
+            c.A=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* TAX */
+        case 0xAA:
+            _SA(c.PC);_T();
+            c.X=c.A;_NZ(c.X);_FETCH();_T();break;
+        /* LXA # (undoc) */
+        case 0xAB:
+            _SA(c.PC++);_T();
+            c.A=c.X=(c.A|0xEE)&_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LDY abs */
+        case 0xAC:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.Y=_GD();_NZ(c.Y);_FETCH();_T();break;
+        /* LDA abs */
+        case 0xAD:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.A=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LDX abs */
+        case 0xAE:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.X=_GD();_NZ(c.X);_FETCH();_T();break;
+        /* LAX abs (undoc) */
+        case 0xAF:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.A=c.X=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* BCS # */
+        case 0xB0:
+            _SA(c.PC++);_T();
+            _SA(c.PC);c.AD=c.PC+(int8_t)_GD();if((c.P&0x1)!=0x1){_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            _SA((c.PC&0xFF00)|(c.AD&0x00FF));if((c.AD&0xFF00)==(c.PC&0xFF00)){c.PC=c.AD;c.irq_pip>>=1;c.nmi_pip>>=1;_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            c.PC=c.AD;_FETCH();_T();break;
+        /* LDA (zp),Y */
+        case 0xB1:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _B1_5;}
+            _SA(c.AD+c.Y);_T();
+            _B1_5: c.A=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0xB2:
+            _SA(c.PC);_T();
+            _B2_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _B2_1;}c.IR=(0xB2<<3)|1;goto _exit;
+        /* LAX (zp),Y (undoc) */
+        case 0xB3:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _B3_5;}
+            _SA(c.AD+c.Y);_T();
+            _B3_5: c.A=c.X=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LDY zp,X */
+        case 0xB4:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.Y=_GD();_NZ(c.Y);_FETCH();_T();break;
+        /* LDA zp,X */
+        case 0xB5:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.A=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LDX zp,Y */
+        case 0xB6:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.Y)&0x00FF);_T();
+            c.X=_GD();_NZ(c.X);_FETCH();_T();break;
+        /* LAX zp,Y (undoc) */
+        case 0xB7:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.Y)&0x00FF);_T();
+            c.A=c.X=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* CLV */
+        case 0xB8:
+            _SA(c.PC);_T();
+            c.P&=~0x40;_FETCH();_T();break;
+        /* LDA abs,Y */
+        case 0xB9:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _B9_4;}
+            _SA(c.AD+c.Y);_T();
+            _B9_4: c.A=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* TSX */
+        case 0xBA:
+            _SA(c.PC);_T();
+            c.X=c.S;_NZ(c.X);_FETCH();_T();break;
+        /* LAS abs,Y (undoc) */
+        case 0xBB:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _BB_4;}
+            _SA(c.AD+c.Y);_T();
+            _BB_4: c.A=c.X=c.S=_GD()&c.S;_NZ(c.A);_FETCH();_T();break;
+        /* LDY abs,X */
+        case 0xBC:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _BC_4;}
+            _SA(c.AD+c.X);_T();
+            _BC_4: c.Y=_GD();_NZ(c.Y);_FETCH();_T();break;
+        /* LDA abs,X */
+        case 0xBD:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _BD_4;}
+            _SA(c.AD+c.X);_T();
+            _BD_4: c.A=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* LDX abs,Y */
+        case 0xBE:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _BE_4;}
+            _SA(c.AD+c.Y);_T();
+            _BE_4: c.X=_GD();_NZ(c.X);_FETCH();_T();break;
+        /* LAX abs,Y (undoc) */
+        case 0xBF:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _BF_4;}
+            _SA(c.AD+c.Y);_T();
+            _BF_4: c.A=c.X=_GD();_NZ(c.A);_FETCH();_T();break;
+        /* CPY # */
+        case 0xC0:
+            _SA(c.PC++);_T();
+            _m6502_cmp(&c, c.Y, _GD());_FETCH();_T();break;
+        /* CMP (zp,X) */
+        case 0xC1:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            _m6502_cmp(&c, c.A, _GD());_FETCH();_T();break;
+        /* NOP # (undoc) */
+        case 0xC2:
+            _SA(c.PC++);_T();
+            _FETCH();_T();break;
+        /* DCP (zp,X) (undoc) */
+        case 0xC3:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD--;_NZ(c.AD);_SD(c.AD);_m6502_cmp(&c, c.A, c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* CPY zp */
+        case 0xC4:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            _m6502_cmp(&c, c.Y, _GD());_FETCH();_T();break;
+        /* CMP zp */
+        case 0xC5:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            _m6502_cmp(&c, c.A, _GD());_FETCH();_T();break;
+        /* DEC zp */
+        case 0xC6:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            c.AD--;_NZ(c.AD);_SD(c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* DCP zp (undoc) */
+        case 0xC7:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            c.AD--;_NZ(c.AD);_SD(c.AD);_m6502_cmp(&c, c.A, c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* INY */
+        case 0xC8:
+            _SA(c.PC);_T();
+            c.Y++;_NZ(c.Y);_FETCH();_T();break;
+        /* CMP # */
+        case 0xC9:
+            _SA(c.PC++);_T();
+            _m6502_cmp(&c, c.A, _GD());_FETCH();_T();break;
+        /* DEX */
+        case 0xCA:
+            _SA(c.PC);_T();
+            c.X--;_NZ(c.X);_FETCH();_T();break;
+        /* SBX # (undoc) */
+        case 0xCB:
+            _SA(c.PC++);_T();
+            _m6502_sbx(&c, _GD());_FETCH();_T();break;
+        /* CPY abs */
+        case 0xCC:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            _m6502_cmp(&c, c.Y, _GD());_FETCH();_T();break;
+        /* CMP abs */
+        case 0xCD:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            _m6502_cmp(&c, c.A, _GD());_FETCH();_T();break;
+        /* DEC abs */
+        case 0xCE:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD--;_NZ(c.AD);_SD(c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* DCP abs (undoc) */
+        case 0xCF:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD--;_NZ(c.AD);_SD(c.AD);_m6502_cmp(&c, c.A, c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* BNE # */
+        case 0xD0:
+            _SA(c.PC++);_T();
+            _SA(c.PC);c.AD=c.PC+(int8_t)_GD();if((c.P&0x2)!=0x0){_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            _SA((c.PC&0xFF00)|(c.AD&0x00FF));if((c.AD&0xFF00)==(c.PC&0xFF00)){c.PC=c.AD;c.irq_pip>>=1;c.nmi_pip>>=1;_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            c.PC=c.AD;_FETCH();_T();break;
+        /* CMP (zp),Y */
+        case 0xD1:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _D1_5;}
+            _SA(c.AD+c.Y);_T();
+            _D1_5: _m6502_cmp(&c, c.A, _GD());_FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0xD2:
+            _SA(c.PC);_T();
+            _D2_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _D2_1;}c.IR=(0xD2<<3)|1;goto _exit;
+        /* DCP (zp),Y (undoc) */
+        case 0xD3:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD--;_NZ(c.AD);_SD(c.AD);_m6502_cmp(&c, c.A, c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP zp,X (undoc) */
+        case 0xD4:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            _FETCH();_T();break;
+        /* CMP zp,X */
+        case 0xD5:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            _m6502_cmp(&c, c.A, _GD());_FETCH();_T();break;
+        /* DEC zp,X */
+        case 0xD6:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD--;_NZ(c.AD);_SD(c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* DCP zp,X (undoc) */
+        case 0xD7:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD--;_NZ(c.AD);_SD(c.AD);_m6502_cmp(&c, c.A, c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* CLD */
+        case 0xD8:
+            _SA(c.PC);_T();
+            c.P&=~0x8;_FETCH();_T();break;
+        /* CMP abs,Y */
+        case 0xD9:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _D9_4;}
+            _SA(c.AD+c.Y);_T();
+            _D9_4: _m6502_cmp(&c, c.A, _GD());_FETCH();_T();break;
+        /* NOP  (undoc) */
+        case 0xDA:
+            _SA(c.PC);_T();
+            _FETCH();_T();break;
+        /* DCP abs,Y (undoc) */
+        case 0xDB:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD--;_NZ(c.AD);_SD(c.AD);_m6502_cmp(&c, c.A, c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP abs,X (undoc) */
+        case 0xDC:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _DC_4;}
+            _SA(c.AD+c.X);_T();
+            _DC_4: _FETCH();_T();break;
+        /* CMP abs,X */
+        case 0xDD:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _DD_4;}
+            _SA(c.AD+c.X);_T();
+            _DD_4: _m6502_cmp(&c, c.A, _GD());_FETCH();_T();break;
+        /* DEC abs,X */
+        case 0xDE:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD--;_NZ(c.AD);_SD(c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* DCP abs,X (undoc) */
+        case 0xDF:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD--;_NZ(c.AD);_SD(c.AD);_m6502_cmp(&c, c.A, c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* CPX # */
+        case 0xE0:
+            _SA(c.PC++);_T();
+            _m6502_cmp(&c, c.X, _GD());_FETCH();_T();break;
+        /* SBC (zp,X) */
+        case 0xE1:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            _m6502_sbc(&c,_GD());_FETCH();_T();break;
+        /* NOP # (undoc) */
+        case 0xE2:
+            _SA(c.PC++);_T();
+            _FETCH();_T();break;
+        /* ISB (zp,X) (undoc) */
+        case 0xE3:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            c.AD=(c.AD+c.X)&0xFF;_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD++;_SD(c.AD);_m6502_sbc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* CPX zp */
+        case 0xE4:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            _m6502_cmp(&c, c.X, _GD());_FETCH();_T();break;
+        /* SBC zp */
+        case 0xE5:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            _m6502_sbc(&c,_GD());_FETCH();_T();break;
+        /* INC zp */
+        case 0xE6:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            c.AD++;_NZ(c.AD);_SD(c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* ISB zp (undoc) */
+        case 0xE7:
+            _SA(c.PC++);_T();
+            _SA(_GD());_T();
+            c.AD=_GD();_WR();_T();
+            c.AD++;_SD(c.AD);_m6502_sbc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* INX */
+        case 0xE8:
+            _SA(c.PC);_T();
+            c.X++;_NZ(c.X);_FETCH();_T();break;
+        /* SBC # */
+        case 0xE9:
+            _SA(c.PC++);_T();
+            _m6502_sbc(&c,_GD());_FETCH();_T();break;
+        /* NOP */
+        case 0xEA:
+            _SA(c.PC);_T();
+            _FETCH();_T();break;
+        /* SBC # (undoc) */
+        case 0xEB:
+            _SA(c.PC++);_T();
+            _m6502_sbc(&c,_GD());_FETCH();_T();break;
+        /* CPX abs */
+        case 0xEC:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            _m6502_cmp(&c, c.X, _GD());_FETCH();_T();break;
+        /* SBC abs */
+        case 0xED:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            _m6502_sbc(&c,_GD());_FETCH();_T();break;
+        /* INC abs */
+        case 0xEE:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD++;_NZ(c.AD);_SD(c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* ISB abs (undoc) */
+        case 0xEF:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            _SA((_GD()<<8)|c.AD);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD++;_SD(c.AD);_m6502_sbc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* BEQ # */
+        case 0xF0:
+            _SA(c.PC++);_T();
+            _SA(c.PC);c.AD=c.PC+(int8_t)_GD();if((c.P&0x2)!=0x2){_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            _SA((c.PC&0xFF00)|(c.AD&0x00FF));if((c.AD&0xFF00)==(c.PC&0xFF00)){c.PC=c.AD;c.irq_pip>>=1;c.nmi_pip>>=1;_FETCH();};_T();if(pins&M6502_SYNC){break;}
+            c.PC=c.AD;_FETCH();_T();break;
+        /* SBC (zp),Y */
+        case 0xF1:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _F1_5;}
+            _SA(c.AD+c.Y);_T();
+            _F1_5: _m6502_sbc(&c,_GD());_FETCH();_T();break;
+        /* JAM INVALID (undoc) */
+        case 0xF2:
+            _SA(c.PC);_T();
+            _F2_1: _SAD(0xFFFF,0xFF);_T();if(ticks<num_ticks){goto _F2_1;}c.IR=(0xF2<<3)|1;goto _exit;
+        /* ISB (zp),Y (undoc) */
+        case 0xF3:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+1)&0xFF);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD++;_SD(c.AD);_m6502_sbc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP zp,X (undoc) */
+        case 0xF4:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            _FETCH();_T();break;
+        /* SBC zp,X */
+        case 0xF5:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            _m6502_sbc(&c,_GD());_FETCH();_T();break;
+        /* INC zp,X */
+        case 0xF6:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD++;_NZ(c.AD);_SD(c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* ISB zp,X (undoc) */
+        case 0xF7:
+            _SA(c.PC++);_T();
+            c.AD=_GD();_SA(c.AD);_T();
+            _SA((c.AD+c.X)&0x00FF);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD++;_SD(c.AD);_m6502_sbc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* SED */
+        case 0xF8:
+            _SA(c.PC);_T();
+            c.P|=0x8;_FETCH();_T();break;
+        /* SBC abs,Y */
+        case 0xF9:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.Y)>>8)))&1){goto _F9_4;}
+            _SA(c.AD+c.Y);_T();
+            _F9_4: _m6502_sbc(&c,_GD());_FETCH();_T();break;
+        /* NOP  (undoc) */
+        case 0xFA:
+            _SA(c.PC);_T();
+            _FETCH();_T();break;
+        /* ISB abs,Y (undoc) */
+        case 0xFB:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.Y)&0xFF));_T();
+            _SA(c.AD+c.Y);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD++;_SD(c.AD);_m6502_sbc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* NOP abs,X (undoc) */
+        case 0xFC:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _FC_4;}
+            _SA(c.AD+c.X);_T();
+            _FC_4: _FETCH();_T();break;
+        /* SBC abs,X */
+        case 0xFD:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();if((~((c.AD>>8)-((c.AD+c.X)>>8)))&1){goto _FD_4;}
+            _SA(c.AD+c.X);_T();
+            _FD_4: _m6502_sbc(&c,_GD());_FETCH();_T();break;
+        /* INC abs,X */
+        case 0xFE:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD++;_NZ(c.AD);_SD(c.AD);_WR();_T();
+            _FETCH();_T();break;
+        /* ISB abs,X (undoc) */
+        case 0xFF:
+            _SA(c.PC++);_T();
+            _SA(c.PC++);c.AD=_GD();_T();
+            c.AD|=_GD()<<8;_SA((c.AD&0xFF00)|((c.AD+c.X)&0xFF));_T();
+            _SA(c.AD+c.X);_T();
+            c.AD=_GD();_WR();_T();
+            c.AD++;_SD(c.AD);_m6502_sbc(&c,c.AD);_WR();_T();
+            _FETCH();_T();break;
+            default: _M6502_UNREACHABLE;
+        }
+    } while ((ticks < num_ticks) && !cpu->exec_break);
+_exit:
+    cpu->IR = c.IR; cpu->PC = c.PC; cpu->AD = c.AD;
+    cpu->A = c.A; cpu->X = c.X; cpu->Y = c.Y; cpu->S = c.S; cpu->P = c.P;
+    cpu->PINS = c.PINS;
+    cpu->irq_pip = c.irq_pip; cpu->nmi_pip = c.nmi_pip;
+    cpu->brk_flags = c.brk_flags;
+    *pins_ptr = pins;
+    return ticks;
 }
 #undef _SA
 #undef _SAD
+#undef _FETCH
+#undef _SD
 #undef _GD
 #undef _ON
 #undef _OFF
-#undef _T
 #undef _RD
 #undef _WR
-#undef _A_IMP
-#undef _A_IMM
-#undef _A_ZER
-#undef _A_ZPX
-#undef _A_ZPY
-#undef _A_ABS
-#undef _A_ABX_R
-#undef _A_ABX_W
-#undef _A_ABY_R
-#undef _A_ABY_W
-#undef _A_IDX
-#undef _A_IDY_R
-#undef _A_IDY_W
 #undef _NZ
+#undef _P
+#undef _T
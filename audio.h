@@ -0,0 +1,226 @@
+#pragma once
+/*
+    audio.h - Sound output for docker-c64.
+
+    Streams the SID output to a WAV file, a raw PCM file or an already
+    open file descriptor (for instance a pipe or FIFO set up by the shell):
+
+      --audio=out.wav   16-bit mono WAV, the header sizes are fixed up on
+                        close when the file is seekable
+      --audio=out.raw   raw signed 16-bit little-endian mono PCM
+      --audio=fd:3      raw PCM to file descriptor 3
+
+    Threading model: audio_push() is called from the emulation thread as
+    chips_audio_callback_t, it converts the samples to 16-bit and puts
+    them into a single-producer/single-consumer ring buffer. A writer
+    thread drains the ring buffer with write(). The emulation never
+    waits for the writer: when the ring buffer is full (disk or pipe
+    stall), new samples are dropped and counted instead.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+
+#define AUDIO_SAMPLE_RATE (44100)
+#define AUDIO_RING_SIZE   (1<<16)   /* samples, ~1.5 seconds at 44.1 kHz, must be power of 2 */
+#define AUDIO_WRITER_USEC (5000)    /* writer thread poll interval when the ring is empty */
+
+typedef struct {
+    int      fd;            /* output file descriptor, -1 when audio output is off */
+    bool     own_fd;        /* true if fd was opened by audio_open() */
+    bool     wav;           /* true if a WAV header was written */
+    int      sample_rate;
+    pthread_t thread;
+    atomic_bool stop;
+    /* ring buffer, head is only written by audio_push(), tail only by the writer thread */
+    atomic_uint_fast32_t head;
+    atomic_uint_fast32_t tail;
+    int16_t  ring[AUDIO_RING_SIZE];
+    /* statistics */
+    long long dropped;      /* samples dropped because the ring buffer was full */
+    long long written;      /* samples written (writer thread) */
+    bool     failed;        /* write error, e.g. reader closed the pipe (writer thread) */
+} audio_state_t;
+
+static void _audio_le16(uint8_t *p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static void _audio_le32(uint8_t *p, uint32_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = v >> 24;
+}
+
+/* write all bytes, retry on EINTR and partial writes */
+static bool _audio_write(int fd, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+/* 44 byte canonical WAV header, data_bytes=0xFFFFFFFF for unknown length */
+static void _audio_wav_header(uint8_t *h, int sample_rate, uint32_t data_bytes) {
+    memcpy(h + 0, "RIFF", 4);
+    _audio_le32(h + 4, (data_bytes == 0xFFFFFFFF) ? 0xFFFFFFFF : (36 + data_bytes));
+    memcpy(h + 8, "WAVEfmt ", 8);
+    _audio_le32(h + 16, 16);                        /* fmt chunk size */
+    _audio_le16(h + 20, 1);                         /* PCM */
+    _audio_le16(h + 22, 1);                         /* mono */
+    _audio_le32(h + 24, (uint32_t)sample_rate);
+    _audio_le32(h + 28, (uint32_t)sample_rate * 2); /* bytes per second */
+    _audio_le16(h + 32, 2);                         /* block align */
+    _audio_le16(h + 34, 16);                        /* bits per sample */
+    memcpy(h + 36, "data", 4);
+    _audio_le32(h + 40, data_bytes);
+}
+
+static void *_audio_writer(void *arg) {
+    audio_state_t *st = (audio_state_t *)arg;
+    for (;;) {
+        const uint32_t tail = (uint32_t)atomic_load_explicit(&st->tail, memory_order_relaxed);
+        const uint32_t head = (uint32_t)atomic_load_explicit(&st->head, memory_order_acquire);
+        uint32_t avail = head - tail;
+        if (avail == 0) {
+            if (atomic_load_explicit(&st->stop, memory_order_acquire)) {
+                break;
+            }
+            struct timespec ts = { 0, AUDIO_WRITER_USEC * 1000L };
+            nanosleep(&ts, NULL);
+            continue;
+        }
+        /* write the contiguous part up to the end of the ring */
+        const uint32_t pos = tail & (AUDIO_RING_SIZE - 1);
+        if (avail > (AUDIO_RING_SIZE - pos)) {
+            avail = AUDIO_RING_SIZE - pos;
+        }
+        if (!st->failed) {
+            if (_audio_write(st->fd, &st->ring[pos], avail * sizeof(int16_t))) {
+                st->written += avail;
+            }
+            else {
+                st->failed = true;
+            }
+        }
+        atomic_store_explicit(&st->tail, tail + avail, memory_order_release);
+    }
+    return NULL;
+}
+
+/* open the output and start the writer thread, spec is a file name or fd:N */
+static bool audio_open(audio_state_t *st, const char *spec, int sample_rate) {
+    memset(st, 0, sizeof(*st));
+    st->fd = -1;
+    st->sample_rate = sample_rate;
+    if (strncmp(spec, "fd:", 3) == 0) {
+        char *end;
+        long fd = strtol(spec + 3, &end, 10);
+        if ((end == spec + 3) || (*end != 0) || (fd < 0) || (fcntl((int)fd, F_GETFD) < 0)) {
+            fprintf(stderr, "Invalid audio file descriptor: %s\n", spec);
+            return false;
+        }
+        st->fd = (int)fd;
+    }
+    else {
+        st->fd = open(spec, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (st->fd < 0) {
+            fprintf(stderr, "Cannot open audio output %s: %s\n", spec, strerror(errno));
+            return false;
+        }
+        st->own_fd = true;
+        const char *dot = strrchr(spec, '.');
+        st->wav = dot && (strcmp(dot, ".wav") == 0 || strcmp(dot, ".WAV") == 0);
+    }
+    if (st->wav) {
+        uint8_t h[44];
+        _audio_wav_header(h, sample_rate, 0xFFFFFFFF);
+        if (!_audio_write(st->fd, h, sizeof(h))) {
+            fprintf(stderr, "Cannot write audio output %s: %s\n", spec, strerror(errno));
+            close(st->fd);
+            st->fd = -1;
+            return false;
+        }
+    }
+    /* a closed pipe must not terminate the emulator, write() fails with EPIPE instead */
+    signal(SIGPIPE, SIG_IGN);
+    atomic_init(&st->stop, false);
+    atomic_init(&st->head, 0);
+    atomic_init(&st->tail, 0);
+    if (pthread_create(&st->thread, NULL, _audio_writer, st) != 0) {
+        fprintf(stderr, "Cannot start audio writer thread\n");
+        if (st->own_fd) {
+            close(st->fd);
+        }
+        st->fd = -1;
+        return false;
+    }
+    return true;
+}
+
+/* chips_audio_callback_t, called by the emulation with user_data = audio_state_t* */
+static void audio_push(const float *samples, int num_samples, void *user_data) {
+    audio_state_t *st = (audio_state_t *)user_data;
+    const uint32_t head = (uint32_t)atomic_load_explicit(&st->head, memory_order_relaxed);
+    const uint32_t tail = (uint32_t)atomic_load_explicit(&st->tail, memory_order_acquire);
+    uint32_t space = AUDIO_RING_SIZE - (head - tail);
+    uint32_t n = (uint32_t)num_samples;
+    if (n > space) {
+        st->dropped += n - space;
+        n = space;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        float s = samples[i];
+        s = (s > 1.0f) ? 1.0f : ((s < -1.0f) ? -1.0f : s);
+        st->ring[(head + i) & (AUDIO_RING_SIZE - 1)] = (int16_t)(s * 32767.0f);
+    }
+    atomic_store_explicit(&st->head, head + n, memory_order_release);
+}
+
+/* drain the ring buffer, stop the writer thread and finish the output */
+static void audio_close(audio_state_t *st) {
+    if (st->fd < 0) {
+        return;
+    }
+    atomic_store_explicit(&st->stop, true, memory_order_release);
+    pthread_join(st->thread, NULL);
+    if (st->wav && !st->failed) {
+        /* fix up the header sizes if the output is seekable */
+        const uint32_t data_bytes = (uint32_t)(st->written * sizeof(int16_t));
+        if (lseek(st->fd, 0, SEEK_SET) == 0) {
+            uint8_t h[44];
+            _audio_wav_header(h, st->sample_rate, data_bytes);
+            _audio_write(st->fd, h, sizeof(h));
+        }
+    }
+    if (st->own_fd) {
+        close(st->fd);
+    }
+    if (st->dropped > 0) {
+        fprintf(stderr, "audio: %lld samples dropped (output too slow)\n", st->dropped);
+    }
+    if (st->failed) {
+        fprintf(stderr, "audio: write error, output stopped after %lld samples\n", st->written);
+    }
+    st->fd = -1;
+}
@@ -20,6 +20,7 @@
 #include <wchar.h>
 #include <time.h>
 #include <string.h>
+#include <errno.h>
 #define CHIPS_IMPL
 #include "chips_common.h"
 #include "m6502.h"
@@ -29,13 +30,17 @@
 #include "beeper.h"
 #include "kbd.h"
 #include "mem.h"
+#include "m6502dr.h"
 #include "clk.h"
 #include "c1530.h"
 #include "m6522.h"
 #include "c1541.h"
+#include "reu.h"
 #include "c64.h"
 #include "c64-roms.h"
 #include "sixel.h"
+#include "audio.h"
+#include "hostio.h"
 
 static c64_t c64;
 static const char *prg_filename = "file.prg";
@@ -44,12 +49,38 @@ static bool auto_tape_file = false;
 static bool auto_disk_file = false;
 static bool file_loaded = false;
 static int char_width = 1;  // 1 = narrow (default), 2 = wide
+static int bench_frames = 0;  // >0: run headless benchmark for this many frames
+static int bench_cpu_mcycles = 0;  // >0: run the bare CPU benchmark for this many million cycles
+static bool bench_sprites = false;  // run the benchmark on a screen full of sprites
+static bool warp_mode = false;  // run emulation uncapped, present at WARP_PRESENT_USEC
+static c64_cpu_backend_t cpu_backend = C64_CPUBACKEND_EXEC;
+static bool vic_line_renderer = false;  // --vic=line: render per raster line instead of per cycle
+static bool idle_skip = true;   // skip CPU emulation while a program waits in an idle loop
+static bool lazy_collisions = false;    // --lazy-collisions: skip unobserved sprite-data collisions in text modes
+static bool basic_accel = false;    // --basic-accel: run BASIC ROM math routines with the system paused
+static uint32_t basic_accel_ticks = 0;  // --basic-accel=N: ticks charged per accelerated routine call
+static int cpu_turbo = 1;       // --turbo=N: run the CPU at N times the PAL clock
+static long reu_size = 0;       // --reu=SIZE: RAM Expansion Unit size in bytes, 0 = none
+static const char *reu_image = NULL;   // --reu-image=FILE: preload the REU from a file
+static chips_range_t reu_mem;   // host memory backing the REU
+static int frameskip_max = 3;   // --frameskip=N: render at least 1 of N+1 frames when behind real time
+static long frames_run = 0;     // frames emulated in real-time mode
+static long frames_skipped = 0; // frames emulated without rendering to catch up
+static int frameskip_stats_sec = 0;    // --frameskip-stats=SEC: print the frameskip counters every SEC seconds
+static const char *audio_spec = NULL;  // --audio output (file name or fd:N), NULL = no sound
+static audio_state_t audio_state = { .fd = -1 };
+static const char *hostio_dir = NULL;  // --hostio directory for the IO1 host file device, NULL = off
+static hostio_t hostio;
 
 static gfx_mode_t  gfx_mode  = GFXMODE_AUTO;
 static gfx_state_t gfx_state;
 
 // Use existing VIC-II and C64 timing constants from headers
 #define PAL_FRAME_USEC ((M6569_VTOTAL * M6569_HTOTAL * 1000000L) / C64_FREQUENCY)
+// Wall clock interval between presented frames in warp mode (25 Hz)
+#define WARP_PRESENT_USEC (40000L)
+// Frame backlog after which the real-time schedule is restarted instead of caught up
+#define FRAMESKIP_RESYNC_USEC (10 * PAL_FRAME_USEC)
 
 // Clock utility functions
 static inline void clock_get_time(struct timespec *ts) {
@@ -224,6 +255,60 @@ static void init_c64_colors(void) {
     }
 }
 
+// map the REU memory, optionally preloaded copy-on-write from --reu-image (the file is never modified)
+static bool reu_map(void) {
+    int fd = -1;
+    off_t image_size = 0;
+    if (reu_image) {
+        fd = open(reu_image, O_RDONLY);
+        struct stat sb;
+        if ((fd == -1) || (fstat(fd, &sb) == -1)) {
+            fprintf(stderr, "Cannot open REU image %s: %s\n", reu_image, strerror(errno));
+            if (fd != -1) close(fd);
+            return false;
+        }
+        image_size = sb.st_size;
+        if (reu_size == 0) {
+            // no explicit size: the smallest REU that holds the image
+            reu_size = REU_MIN_SIZE;
+            while ((reu_size < image_size) && (reu_size < REU_MAX_SIZE)) {
+                reu_size <<= 1;
+            }
+        }
+        if (image_size > reu_size) {
+            fprintf(stderr, "REU image %s is larger than the REU (%ld KB)\n", reu_image, reu_size / 1024);
+            close(fd);
+            return false;
+        }
+    }
+    // private mapping of /dev/zero, MAP_ANONYMOUS is not part of the POSIX level requested above
+    int zero_fd = open("/dev/zero", O_RDWR);
+    void *ptr = (zero_fd == -1) ? MAP_FAILED :
+        mmap(NULL, (size_t)reu_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, zero_fd, 0);
+    if (zero_fd != -1) close(zero_fd);
+    if (ptr == MAP_FAILED) {
+        fprintf(stderr, "Cannot allocate REU memory: %s\n", strerror(errno));
+        if (fd != -1) close(fd);
+        return false;
+    }
+    if ((fd != -1) && (image_size > 0)) {
+        if (mmap(ptr, (size_t)image_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+            fprintf(stderr, "Cannot map REU image %s: %s\n", reu_image, strerror(errno));
+            munmap(ptr, (size_t)reu_size);
+            close(fd);
+            return false;
+        }
+    }
+    if (fd != -1) close(fd);
+    reu_mem = (chips_range_t){ .ptr = ptr, .size = (size_t)reu_size };
+    return true;
+}
+
+// one line with the frameskip counters, printed with --frameskip-stats and on exit
+static void print_frameskip_stats(void) {
+    fprintf(stderr, "frameskip: %ld of %ld frames not rendered\n", frames_skipped, frames_run);
+}
+
 static bool load_file_name(const char *filename) {
     // map file to memory
     int fd = open(filename, O_RDONLY);
@@ -329,22 +414,35 @@ static bool load_file(void) {
     return load_file_name(prg_filename);
 }
 
-static bool save_file_name(const char *filename, uint16_t ptr, uint16_t endptr) {
-    // open or create file
-    int fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC);
-    if (fd == -1) return false;
-
-    // write header
-    uint8_t lobyte = (uint8_t)ptr;
-    uint8_t hibyte = (uint8_t)(ptr>>8);
-    if (write(fd, &lobyte, 1) == -1 || write(fd, &hibyte, 1) == -1) { close(fd); return false; }
+// write all bytes, retry on EINTR and partial writes
+static bool write_all(int fd, const uint8_t *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
 
-    // write data
+static bool save_file_name(const char *filename, uint16_t ptr, uint16_t endptr) {
+    // collect header and data, then write them in one go
+    static uint8_t buf[2 + 0x10000];
+    size_t len = 0;
+    buf[len++] = (uint8_t)ptr;
+    buf[len++] = (uint8_t)(ptr>>8);
     while (ptr < endptr) {
-        uint8_t byte = mem_rd(&c64.mem_cpu, ptr++);
-        if (write(fd, &byte, 1) == -1) { close(fd); return false; }
+        buf[len++] = mem_rd(&c64.mem_cpu, ptr++);
     }
 
+    // open or create file
+    int fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) return false;
+    if (!write_all(fd, buf, len)) { close(fd); return false; }
+
     // cleanup
     return close(fd) == 0;
 }
@@ -476,6 +574,9 @@ static void flush_screen_changes(void) {
     }
 }
 
+// total number of emulated clock ticks (used for benchmark statistics)
+static uint64_t emulated_ticks = 0;
+
 static void execute_scanlines(int start_line, int end_line) {
     // Calculate exact ticks for the specified scanline range to avoid rounding errors
     int num_lines = end_line - start_line + 1;
@@ -486,7 +587,7 @@ static void execute_scanlines(int start_line, int end_line) {
     uint32_t microseconds = (exact_ticks * 1000000L) / C64_FREQUENCY;
     
     // Execute emulator for this scanline range
-    c64_exec(&c64, microseconds);
+    emulated_ticks += c64_exec(&c64, microseconds);
 }
 
 static void execute_frame_by_scanlines(void) {
@@ -585,6 +686,45 @@ static bool is_c64_basic_ready(void) {
     return false;
 }
 
+// Auto-load and optionally run file when BASIC is ready
+static void handle_autoload(void) {
+    if (auto_run_file && !file_loaded) {
+        if (is_c64_basic_ready()) {
+            if (load_file_name(prg_filename)) {
+                inject_run_command();
+            }
+            file_loaded = true;
+        }
+    }
+    if (auto_tape_file && !file_loaded) {
+        if (is_c64_basic_ready()) {
+            int fd = open(prg_filename, O_RDONLY);
+            if (fd != -1) {
+                struct stat sb;
+                if (fstat(fd, &sb) == 0) {
+                    void *ptr = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (ptr != MAP_FAILED) {
+                        if (c64_insert_tape(&c64, (chips_range_t){ .ptr=ptr, .size=sb.st_size })) {
+                            c64_tape_play(&c64);
+                            c64_basic_load(&c64);  /* injects LOAD + ENTER */
+                        }
+                        munmap(ptr, sb.st_size);
+                    }
+                }
+                close(fd);
+            }
+            file_loaded = true;
+        }
+    }
+    if (auto_disk_file && !file_loaded) {
+        if (is_c64_basic_ready()) {
+            if (load_d64_file(prg_filename))
+                inject_run_command();
+            file_loaded = true;
+        }
+    }
+}
+
 static void print_usage(const char *program_name) {
     printf("Usage: %s [OPTIONS] [filename]\n", program_name);
     printf("\n");
@@ -598,6 +738,46 @@ static void print_usage(const char *program_name) {
     printf("                       sixel  sixel graphics protocol\n");
     printf("                       narrow text mode, narrow characters (1:1 aspect)\n");
     printf("                       wide   text mode, wide characters (2:1 aspect)\n");
+    printf("                       none   no output (only with --bench)\n");
+    printf("  --warp             Start in warp mode (uncapped speed, toggle with F9)\n");
+    printf("  --cpu=BACKEND      CPU emulation backend (default: exec)\n");
+    printf("                       exec   instruction-stepped, faster\n");
+    printf("                       tick   cycle-stepped reference implementation\n");
+    printf("                       dynarec pre-decoded code blocks, fastest but not\n");
+    printf("                              cycle exact (for --warp and --bench)\n");
+    printf("  --vic=RENDERER     VIC-II renderer (default: cycle)\n");
+    printf("                       cycle  8 pixels per cycle, shows mid-line raster effects\n");
+    printf("                       line   whole raster lines, faster, registers are\n");
+    printf("                              sampled once per line\n");
+    printf("  --lazy-collisions  In the text modes, only detect sprite-background collisions\n");
+    printf("                     while a program polls $D01F or enables their interrupt\n");
+    printf("                     (faster, the first poll after a pause can miss one)\n");
+    printf("  --no-idle-skip     Keep emulating the CPU in idle loops (READY prompt, GET\n");
+    printf("                     wait), interrupts are then taken on the exact cycle\n");
+    printf("  --turbo=N          Run the CPU at N times the PAL clock (1-%d) while video,\n", C64_MAX_CPU_TURBO);
+    printf("                     timers and sound keep their speed (exec/tick CPU only)\n");
+    printf("  --reu=SIZE         Attach a 17xx RAM Expansion Unit of SIZE bytes, a power of\n");
+    printf("                     two from 128k to 16m (suffix k or m)\n");
+    printf("  --reu-image=FILE   Preload the REU from FILE, the file itself is not changed\n");
+    printf("                     (REU size defaults to the file size rounded up)\n");
+    printf("  --basic-accel[=N]  Run the BASIC ROM floating point and string concatenation\n");
+    printf("                     routines without emulating the rest of the machine and\n");
+    printf("                     charge N cycles per call (default: 0, exec CPU only)\n");
+    printf("  --hostio=DIR       Let programs access files in DIR through the host I/O\n");
+    printf("                     device at $DE00 (see hostio.h)\n");
+    printf("  --frameskip=N      When the host can't keep up, skip rendering of up to N\n");
+    printf("                     frames in a row (default: 3, 0 = never skip)\n");
+    printf("  --frameskip-stats=SEC  Print the number of emulated and skipped frames to\n");
+    printf("                     stderr every SEC seconds (redirect stderr to a file)\n");
+    printf("  --audio=OUTPUT     Write SID sound output (44.1 kHz 16-bit mono) to\n");
+    printf("                       FILE.wav  WAV file\n");
+    printf("                       FILE      raw signed 16-bit little-endian PCM\n");
+    printf("                       fd:N      raw PCM to open file descriptor N\n");
+    printf("  --bench=N          Run N frames headless as fast as possible and print\n");
+    printf("                     emulation speed and per-phase timing (default mode: none)\n");
+    printf("  --bench-sprites    Run the --bench frames with 8 expanded sprites on screen\n");
+    printf("  --bench-cpu=N      Run N million cycles of the bare 6502 core on a fixed\n");
+    printf("                     instruction mix and print the clock rate\n");
     printf("\n");
     printf("Arguments:\n");
     printf("  filename      File to auto-load and run:\n");
@@ -610,6 +790,7 @@ static void print_usage(const char *program_name) {
     printf("  PageDown      Load file\n");
     printf("  PageUp        Save file\n");
     printf("  End           Toggle upper/lower case\n");
+    printf("  F9            Toggle warp mode\n");
     printf("  Escape        RUN/STOP key\n");
     printf("  Ctrl+C        Exit emulator\n");
 }
@@ -623,6 +804,122 @@ static void parse_arguments(int argc, char* argv[]) {
         else if (gfx_parse_arg(argv[i], &gfx_mode, &char_width)) {
             // handled
         }
+        else if (strcmp(argv[i], "--warp") == 0) {
+            warp_mode = true;
+        }
+        else if (strcmp(argv[i], "--cpu=exec") == 0) {
+            cpu_backend = C64_CPUBACKEND_EXEC;
+        }
+        else if (strcmp(argv[i], "--cpu=tick") == 0) {
+            cpu_backend = C64_CPUBACKEND_TICK;
+        }
+        else if (strcmp(argv[i], "--cpu=dynarec") == 0) {
+            cpu_backend = C64_CPUBACKEND_DYNAREC;
+        }
+        else if (strcmp(argv[i], "--vic=cycle") == 0) {
+            vic_line_renderer = false;
+        }
+        else if (strcmp(argv[i], "--vic=line") == 0) {
+            vic_line_renderer = true;
+        }
+        else if (strcmp(argv[i], "--lazy-collisions") == 0) {
+            lazy_collisions = true;
+        }
+        else if (strcmp(argv[i], "--no-idle-skip") == 0) {
+            idle_skip = false;
+        }
+        else if (strncmp(argv[i], "--turbo=", 8) == 0) {
+            char *end;
+            cpu_turbo = (int)strtol(argv[i] + 8, &end, 10);
+            if ((end == argv[i] + 8) || (*end != 0) || (cpu_turbo < 1) || (cpu_turbo > C64_MAX_CPU_TURBO)) {
+                fprintf(stderr, "Invalid turbo factor: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        else if (strncmp(argv[i], "--reu=", 6) == 0) {
+            char *end;
+            reu_size = strtol(argv[i] + 6, &end, 10);
+            if (*end == 'k' || *end == 'K') {
+                reu_size *= 1024;
+                end++;
+            }
+            else if (*end == 'm' || *end == 'M') {
+                reu_size *= 1024 * 1024;
+                end++;
+            }
+            if ((end == argv[i] + 6) || (*end != 0) || (reu_size < REU_MIN_SIZE) || (reu_size > REU_MAX_SIZE) ||
+                (reu_size & (reu_size - 1))) {
+                fprintf(stderr, "Invalid REU size: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        else if (strncmp(argv[i], "--reu-image=", 12) == 0) {
+            reu_image = argv[i] + 12;
+            if (*reu_image == 0) {
+                fprintf(stderr, "Invalid REU image: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        else if (strcmp(argv[i], "--basic-accel") == 0) {
+            basic_accel = true;
+        }
+        else if (strncmp(argv[i], "--basic-accel=", 14) == 0) {
+            char *end;
+            const long n = strtol(argv[i] + 14, &end, 10);
+            if ((end == argv[i] + 14) || (*end != 0) || (n < 0) || (n > 1000000)) {
+                fprintf(stderr, "Invalid BASIC accelerator cycle count: %s\n", argv[i]);
+                exit(1);
+            }
+            basic_accel = true;
+            basic_accel_ticks = (uint32_t)n;
+        }
+        else if (strncmp(argv[i], "--hostio=", 9) == 0) {
+            hostio_dir = argv[i] + 9;
+            if (*hostio_dir == 0) {
+                fprintf(stderr, "Invalid host I/O directory: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        else if (strncmp(argv[i], "--frameskip-stats=", 18) == 0) {
+            char *end;
+            frameskip_stats_sec = (int)strtol(argv[i] + 18, &end, 10);
+            if ((end == argv[i] + 18) || (*end != 0) || (frameskip_stats_sec <= 0)) {
+                fprintf(stderr, "Invalid frameskip statistics interval: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        else if (strncmp(argv[i], "--frameskip=", 12) == 0) {
+            char *end;
+            frameskip_max = (int)strtol(argv[i] + 12, &end, 10);
+            if ((end == argv[i] + 12) || (*end != 0) || (frameskip_max < 0)) {
+                fprintf(stderr, "Invalid frameskip count: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        else if (strncmp(argv[i], "--audio=", 8) == 0) {
+            audio_spec = argv[i] + 8;
+            if (*audio_spec == 0) {
+                fprintf(stderr, "Invalid audio output: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        else if (strcmp(argv[i], "--bench-sprites") == 0) {
+            bench_sprites = true;
+        }
+        else if (strncmp(argv[i], "--bench-cpu=", 12) == 0) {
+            bench_cpu_mcycles = atoi(argv[i] + 12);
+            if (bench_cpu_mcycles <= 0) {
+                fprintf(stderr, "Invalid cycle count: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        else if (strncmp(argv[i], "--bench=", 8) == 0) {
+            bench_frames = atoi(argv[i] + 8);
+            if (bench_frames <= 0) {
+                fprintf(stderr, "Invalid frame count: %s\n", argv[i]);
+                exit(1);
+            }
+        }
         else if (argv[i][0] == '-') {
             fprintf(stderr, "Unknown option: %s\n", argv[i]);
             fprintf(stderr, "Use -h or --help for usage information.\n");
@@ -639,13 +936,284 @@ static void parse_arguments(int argc, char* argv[]) {
                 auto_run_file = true;
         }
     }
+    if (gfx_mode == GFXMODE_NULL && bench_frames == 0) {
+        fprintf(stderr, "--mode=none is only supported together with --bench\n");
+        exit(1);
+    }
+}
+
+/*
+    CPU microbenchmark: runs m6502_tick() on a flat 64 KByte RAM with
+    a fixed instruction mix (immediate, zero page, absolute, indexed and
+    indirect addressing, read-modify-write, stack, branches, JSR/RTS),
+    so that the cost of the instruction decoder can be compared between
+    builds, for instance with -DM6502_COMPUTED_GOTO=1.
+*/
+static int run_cpu_benchmark(void) {
+    static const uint8_t code[] = {
+        0xA2, 0x00,         // 1000: LDX #$00
+        0xBD, 0x00, 0x20,   // 1002: LDA $2000,X
+        0x18,               //       CLC
+        0x69, 0x11,         //       ADC #$11
+        0x9D, 0x00, 0x21,   //       STA $2100,X
+        0xA4, 0x20,         //       LDY $20
+        0xE6, 0x21,         //       INC $21
+        0xB1, 0x22,         //       LDA ($22),Y
+        0x49, 0x5A,         //       EOR #$5A
+        0x91, 0x24,         //       STA ($24),Y
+        0x0E, 0x00, 0x22,   //       ASL $2200
+        0x6A,               //       ROR A
+        0x20, 0x2A, 0x10,   //       JSR $102A
+        0xC9, 0x80,         //       CMP #$80
+        0x90, 0x02,         //       BCC $1022
+        0xE9, 0x07,         //       SBC #$07
+        0x48,               // 1022: PHA
+        0x68,               //       PLA
+        0xE8,               //       INX
+        0xD0, 0xDB,         //       BNE $1002
+        0x4C, 0x00, 0x10,   //       JMP $1000
+        0xA8,               // 102A: TAY
+        0x88,               //       DEY
+        0x98,               //       TYA
+        0x24, 0x26,         //       BIT $26
+        0x60,               //       RTS
+    };
+    static uint8_t ram[1<<16];
+    memcpy(&ram[0x1000], code, sizeof(code));
+    ram[0x22] = 0x00; ram[0x23] = 0x23;     // ($22) => $2300
+    ram[0x24] = 0x00; ram[0x25] = 0x24;     // ($24) => $2400
+    ram[0xFFFC] = 0x00; ram[0xFFFD] = 0x10;
+
+    m6502_t cpu;
+    uint64_t pins = m6502_init(&cpu, &(m6502_desc_t){0});
+    const uint64_t num_cycles = (uint64_t)bench_cpu_mcycles * 1000000;
+    struct timespec t0, t1;
+    clock_get_time(&t0);
+    for (uint64_t i = 0; i < num_cycles; i++) {
+        pins = m6502_tick(&cpu, pins);
+        const uint16_t addr = M6502_GET_ADDR(pins);
+        if (pins & M6502_RW) {
+            M6502_SET_DATA(pins, ram[addr]);
+        }
+        else {
+            ram[addr] = M6502_GET_DATA(pins);
+        }
+    }
+    clock_get_time(&t1);
+    const long usec = clock_diff_microseconds(&t1, &t0);
+    printf("bench-cpu: %llu cycles, computed goto %s\n",
+        (unsigned long long)num_cycles, M6502_COMPUTED_GOTO ? "on" : "off");
+    if (usec > 0) {
+        printf("  time:      %.3f s\n", usec / 1e6);
+        printf("  speed:     %.2f MHz (%.2f ns/cycle)\n", num_cycles / (double)usec, usec * 1000.0 / num_cycles);
+    }
+    // print a register so the work can't be optimized away
+    printf("  state:     PC=%04X A=%02X X=%02X Y=%02X\n", cpu.PC, cpu.A, cpu.X, cpu.Y);
+    return 0;
+}
+
+/*
+    Headless benchmark: run bench_frames PAL frames back-to-back without
+    terminal setup or frame pacing, and report emulation throughput and
+    where the wall time went:
+
+      emulation  execute_frame_by_scanlines() including autoload
+      encoding   gfx_present() minus its write() calls, or ncurses
+                 flush_screen_changes() in text modes
+      output     write() calls of gfx_present(), or ncurses refresh()
+
+    All output goes to /dev/null, text modes render into an ncurses screen
+    opened on /dev/null so that the real terminal is never touched.
+
+    With --bench-sprites a small built-in program is started as soon as
+    BASIC is ready, which puts 8 X/Y-expanded, overlapping sprites on
+    the screen, so that the sprite paths of the VIC can be compared to
+    a sprite-free screen.
+*/
+static void handle_bench_sprites(void) {
+    static const uint8_t prg[] = {
+        0x01, 0x08,                         // load address $0801
+        0x0B, 0x08, 0x0A, 0x00, 0x9E,       // 0801: 10 SYS2061
+        0x32, 0x30, 0x36, 0x31, 0x00,
+        0x00, 0x00,                         // 080B: end of BASIC program
+        0xA2, 0x3E,                         // 080D: LDX #$3E
+        0xA9, 0xFF,                         // 080F: LDA #$FF
+        0x9D, 0x40, 0x03,                   //       STA $0340,X   ; solid sprite in block 13
+        0xCA,                               //       DEX
+        0x10, 0xF8,                         //       BPL $080F
+        0xA2, 0x07,                         //       LDX #$07
+        0xA9, 0x0D,                         // 0819: LDA #$0D
+        0x9D, 0xF8, 0x07,                   //       STA $07F8,X   ; sprite pointer
+        0x8A,                               //       TXA
+        0x0A,                               //       ASL A
+        0xA8,                               //       TAY
+        0xBD, 0x42, 0x08,                   //       LDA $0842,X
+        0x99, 0x00, 0xD0,                   //       STA $D000,Y   ; X position
+        0xBD, 0x4A, 0x08,                   //       LDA $084A,X
+        0x99, 0x01, 0xD0,                   //       STA $D001,Y   ; Y position
+        0x8A,                               //       TXA
+        0x9D, 0x27, 0xD0,                   //       STA $D027,X   ; color
+        0xCA,                               //       DEX
+        0x10, 0xE5,                         //       BPL $0819
+        0xA9, 0xFF,                         //       LDA #$FF
+        0x8D, 0x15, 0xD0,                   //       STA $D015     ; enable
+        0x8D, 0x17, 0xD0,                   //       STA $D017     ; Y expand
+        0x8D, 0x1D, 0xD0,                   //       STA $D01D     ; X expand
+        0x4C, 0x3F, 0x08,                   // 083F: JMP $083F
+        0x18, 0x38, 0x58, 0x78,             // 0842: X positions
+        0x98, 0xB8, 0xD8, 0xF8,
+        0x32, 0x4A, 0x62, 0x7A,             // 084A: Y positions
+        0x92, 0xAA, 0xC2, 0xDA,
+    };
+    static bool started = false;
+    if (bench_sprites && !started && is_c64_basic_ready()) {
+        if (c64_quickload(&c64, (chips_range_t){ .ptr = (void*)prg, .size = sizeof(prg) })) {
+            inject_run_command();
+        }
+        started = true;
+    }
+}
+
+static int run_benchmark(void) {
+    if (gfx_mode == GFXMODE_AUTO) {
+        gfx_mode = GFXMODE_NULL;
+    }
+    int null_fd = open("/dev/null", O_RDWR);
+    if (null_fd == -1) {
+        perror("/dev/null");
+        return 1;
+    }
+    FILE *null_file = NULL;
+    SCREEN *null_screen = NULL;
+    c64.vic.timing_only = (gfx_mode == GFXMODE_NONE);
+    c64.vic.lazy_collisions = c64.vic.timing_only && lazy_collisions;
+    if (gfx_mode == GFXMODE_NONE) {
+        null_file = fdopen(null_fd, "r+");
+        if (null_file) {
+            null_screen = newterm("xterm-256color", null_file, null_file);
+        }
+        if (!null_screen) {
+            fprintf(stderr, "Failed to initialize ncurses for text mode benchmark\n");
+            return 1;
+        }
+        init_c64_colors();
+        attron(A_BOLD);
+        memset(prev_buffer, 0xFF, sizeof(prev_buffer));
+    } else if (gfx_mode != GFXMODE_NULL) {
+        gfx_init_fd(&gfx_state, gfx_mode, null_fd);
+    }
+
+    long emu_usec = 0, encode_usec = 0, output_usec = 0;
+    int frames = 0;
+    struct timespec t0, t1, t2, t3;
+    while ((frames < bench_frames) && !quit_requested) {
+        long write_usec = 0;
+        clock_get_time(&t0);
+        execute_frame_by_scanlines();
+        handle_autoload();
+        handle_bench_sprites();
+        clock_get_time(&t1);
+        if (gfx_mode == GFXMODE_NONE) {
+            flush_screen_changes();
+            clock_get_time(&t2);
+            refresh();
+        } else if (gfx_mode != GFXMODE_NULL) {
+            write_usec = gfx_state.out_usec;
+            gfx_present(&gfx_state, c64.fb);
+            write_usec = gfx_state.out_usec - write_usec;
+            clock_get_time(&t2);
+        } else {
+            t2 = t1;
+        }
+        clock_get_time(&t3);
+        // gfx_present() writes while encoding, account write() time as output
+        emu_usec    += clock_diff_microseconds(&t1, &t0);
+        encode_usec += clock_diff_microseconds(&t2, &t1) - write_usec;
+        output_usec += clock_diff_microseconds(&t3, &t2) + write_usec;
+        frames++;
+    }
+
+    if (null_screen) {
+        endwin();
+        delscreen(null_screen);
+        fclose(null_file);
+    } else {
+        close(null_fd);
+    }
+
+    const char *mode_name = gfx_mode_name(gfx_mode);
+    if (gfx_mode == GFXMODE_NONE) {
+        mode_name = (char_width == 1) ? "narrow" : "wide";
+    }
+    const long wall_usec = emu_usec + encode_usec + output_usec;
+    const double wall_sec = wall_usec / 1e6;
+    const double emu_sec = emu_usec / 1e6;
+    const char *cpu_name = (c64.cpu_backend == C64_CPUBACKEND_TICK) ? "tick" :
+        (c64.cpu_backend == C64_CPUBACKEND_EXEC) ? "exec" : "dynarec";
+    printf("bench: %d frames, mode=%s, cpu=%s, vic=%s%s\n", frames, mode_name, cpu_name,
+        c64.vic.line_renderer ? "line" : "cycle", bench_sprites ? ", sprites" : "");
+    printf("  emulated:  %llu cycles (%.3f s of C64 time)\n",
+        (unsigned long long)emulated_ticks, (double)emulated_ticks / C64_FREQUENCY);
+    if (emu_usec > 0) {
+        printf("  emulation: %.2f MHz (%.2fx realtime)\n",
+            emulated_ticks / emu_sec / 1e6, ((double)emulated_ticks / C64_FREQUENCY) / emu_sec);
+    }
+    if (wall_usec > 0) {
+        printf("  overall:   %.1f frames/sec (%.2fx realtime)\n",
+            frames / wall_sec, ((double)emulated_ticks / C64_FREQUENCY) / wall_sec);
+        printf("  wall time: %.3f s\n", wall_sec);
+        printf("    emulation %8.3f s %5.1f%%\n", emu_sec, 100.0 * emu_usec / wall_usec);
+        printf("    encoding  %8.3f s %5.1f%%\n", encode_usec / 1e6, 100.0 * encode_usec / wall_usec);
+        printf("    output    %8.3f s %5.1f%%\n", output_usec / 1e6, 100.0 * output_usec / wall_usec);
+    }
+    if (c64.idle_skip && (c64.cpu_backend == C64_CPUBACKEND_EXEC) && (emulated_ticks > 0)) {
+        printf("  idle skip: %.1f%% of cycles without CPU emulation\n", 100.0 * c64.idle_ticks / emulated_ticks);
+    }
+    if (c64.basic_accel && (c64.cpu_backend == C64_CPUBACKEND_EXEC)) {
+        printf("  basic accel: %llu ROM routine calls, %llu cycles not charged\n",
+            (unsigned long long)c64.basic_accel_calls, (unsigned long long)c64.basic_accel_saved);
+    }
+    if ((c64.cpu_backend == C64_CPUBACKEND_DYNAREC) && (emulated_ticks > 0)) {
+        printf("  dynarec:   %.1f%% of cycles in translated code, %llu translations\n",
+            100.0 * c64.dr.num_ticks / emulated_ticks, (unsigned long long)c64.dr.num_translations);
+    }
+    if ((gfx_mode == GFXMODE_SIXEL || gfx_mode == GFXMODE_KITTY) && frames > 0) {
+        printf("  output:    %lld bytes (%lld bytes/frame)\n",
+            gfx_state.out_bytes, gfx_state.out_bytes / frames);
+    }
+    return 0;
 }
 
 int main(int argc, char* argv[]) {
 
     parse_arguments(argc, argv);
+    if (bench_cpu_mcycles > 0) {
+        return run_cpu_benchmark();
+    }
+    if ((reu_size > 0 || reu_image) && !reu_map()) {
+        return 1;
+    }
+    if (hostio_dir && !hostio_open(&hostio, hostio_dir, &c64)) {
+        return 1;
+    }
+    if (audio_spec && !audio_open(&audio_state, audio_spec, AUDIO_SAMPLE_RATE)) {
+        return 1;
+    }
     c64_init(&c64, &(c64_desc_t){
         .c1530_enabled = true,
+        .cpu_backend = cpu_backend,
+        .sid_no_sound = !audio_spec,    // without --audio there is no sound output
+        .vic_line_renderer = vic_line_renderer,
+        .idle_skip = idle_skip,
+        .basic_accel = basic_accel,
+        .basic_accel_ticks = basic_accel_ticks,
+        .cpu_turbo = (uint32_t)cpu_turbo,
+        .reu = reu_mem,
+        .io1 = { .func = hostio_dir ? hostio_access : 0, .user_data = &hostio },
+        .audio = {
+            .callback = { .func = audio_push, .user_data = &audio_state },
+            .sample_rate = AUDIO_SAMPLE_RATE,
+        },
         .roms = {
             .chars = { .ptr=dump_c64_char_bin, .size=sizeof(dump_c64_char_bin) },
             .basic = { .ptr=dump_c64_basic_bin, .size=sizeof(dump_c64_basic_bin) },
@@ -656,10 +1224,21 @@ int main(int argc, char* argv[]) {
     // install a Ctrl-C signal handler
     signal(SIGINT, catch_sigint);
 
+    if (bench_frames > 0) {
+        setlocale(LC_ALL, "C.utf8");
+        int ret = run_benchmark();
+        audio_close(&audio_state);
+        hostio_close(&hostio);
+        return ret;
+    }
+
     // Resolve auto-detection (gfx_detect handles raw mode internally)
     if (gfx_mode == GFXMODE_AUTO) {
         gfx_mode = gfx_detect();
     }
+    // text modes build the screen from video memory, c64.fb is never shown
+    c64.vic.timing_only = (gfx_mode == GFXMODE_NONE);
+    c64.vic.lazy_collisions = c64.vic.timing_only && lazy_collisions;
 
     setlocale(LC_ALL, "C.utf8");
     if (gfx_mode != GFXMODE_NONE) {
@@ -694,50 +1273,38 @@ int main(int argc, char* argv[]) {
     // Initialize timing for 50.125 Hz frame rate
     struct timespec next_frame_time;
     clock_get_time(&next_frame_time);
+    // frameskip state: skip rendering of the next frame, and frames skipped in a row
+    bool skip_frame = false;
+    int skipped_in_row = 0;
+    struct timespec next_stats_time = next_frame_time;
+    clock_add_microseconds(&next_stats_time, frameskip_stats_sec * 1000000L);
 
     // run the emulation/input/render loop at exactly 50.125 Hz
     while (!quit_requested) {
         struct timespec frame_start_time;
         clock_get_time(&frame_start_time);
 
-        // Execute one complete frame by scanlines with per-line buffer updates
-        execute_frame_by_scanlines();
-
-        // Auto-load and optionally run file when BASIC is ready
-        if (auto_run_file && !file_loaded) {
-            if (is_c64_basic_ready()) {
-                if (load_file_name(prg_filename)) {
-                    inject_run_command();
-                }
-                file_loaded = true;
-            }
+        // a skipped frame doesn't need VIC-II pixel output, which also allows idle skipping of the VIC
+        const bool skip_render = skip_frame && !warp_mode;
+        const bool vic_timing_only = c64.vic.timing_only;
+        if (skip_render) {
+            c64.vic.timing_only = true;
         }
-        if (auto_tape_file && !file_loaded) {
-            if (is_c64_basic_ready()) {
-                int fd = open(prg_filename, O_RDONLY);
-                if (fd != -1) {
-                    struct stat sb;
-                    if (fstat(fd, &sb) == 0) {
-                        void *ptr = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
-                        if (ptr != MAP_FAILED) {
-                            if (c64_insert_tape(&c64, (chips_range_t){ .ptr=ptr, .size=sb.st_size })) {
-                                c64_tape_play(&c64);
-                                c64_basic_load(&c64);  /* injects LOAD + ENTER */
-                            }
-                            munmap(ptr, sb.st_size);
-                        }
-                    }
-                    close(fd);
-                }
-                file_loaded = true;
-            }
-        }
-        if (auto_disk_file && !file_loaded) {
-            if (is_c64_basic_ready()) {
-                if (load_d64_file(prg_filename))
-                    inject_run_command();
-                file_loaded = true;
-            }
+        if (warp_mode) {
+            // Warp: run complete frames back-to-back until the next frame
+            // presentation is due, only the latest frame is rendered
+            struct timespec current_time;
+            do {
+                execute_frame_by_scanlines();
+                handle_autoload();
+                clock_get_time(&current_time);
+            } while (!quit_requested && clock_is_before(&current_time, &next_frame_time));
+        } else {
+            // Execute one complete frame by scanlines with per-line buffer updates
+            execute_frame_by_scanlines();
+
+            // Auto-load and optionally run file when BASIC is ready
+            handle_autoload();
         }
 
         // Keyboard input — both modes use ncurses getch()
@@ -766,6 +1333,11 @@ int main(int argc, char* argv[]) {
                 case KEY_F(6): ch = C64_KEY_F6; break;
                 case KEY_F(7): ch = C64_KEY_F7; break;
                 case KEY_F(8): ch = C64_KEY_F8; break;
+                case KEY_F(9):
+                    warp_mode = !warp_mode;
+                    clock_get_time(&next_frame_time);
+                    ch = -1; // Don't send to C64
+                    break;
                 case KEY_END:
                     toggle_charset();
                     ch = -1; // Don't send to C64
@@ -790,24 +1362,56 @@ int main(int argc, char* argv[]) {
         }
 
         // Render
-        if (gfx_mode != GFXMODE_NONE) {
+        c64.vic.timing_only = vic_timing_only;
+        if (skip_render) {
+            frames_skipped++;
+        } else if (gfx_mode != GFXMODE_NONE) {
             gfx_present(&gfx_state, c64.fb);
         } else {
             flush_screen_changes();
             refresh();
         }
 
+        // periodic frameskip counters for monitoring, also when nothing was skipped
+        if (frameskip_stats_sec > 0) {
+            struct timespec current_time;
+            clock_get_time(&current_time);
+            if (!clock_is_before(&current_time, &next_stats_time)) {
+                print_frameskip_stats();
+                next_stats_time = current_time;
+                clock_add_microseconds(&next_stats_time, frameskip_stats_sec * 1000000L);
+            }
+        }
+
+        if (warp_mode) {
+            // Warp: no sleeping, just schedule the next frame presentation
+            clock_get_time(&next_frame_time);
+            clock_add_microseconds(&next_frame_time, WARP_PRESENT_USEC);
+            continue;
+        }
+
         // Calculate next frame time for 50.125 Hz
         clock_add_microseconds(&next_frame_time, PAL_FRAME_USEC);
+        frames_run++;
+        skipped_in_row = skip_render ? (skipped_in_row + 1) : 0;
 
         // Sleep until next frame to maintain real-time 50.125 Hz
         struct timespec current_time;
         clock_get_time(&current_time);
         if (clock_is_before(&current_time, &next_frame_time)) {
+            skip_frame = false;
             long sleep_usec = clock_diff_microseconds(&next_frame_time, &current_time);
             if (sleep_usec > 0) {
                 usleep(sleep_usec);
             }
+        } else {
+            // behind real time: emulate the next frame without rendering it, unless
+            // too many frames in a row were skipped already
+            skip_frame = (skipped_in_row < frameskip_max);
+            if (clock_diff_microseconds(&current_time, &next_frame_time) > FRAMESKIP_RESYNC_USEC) {
+                // too far behind to catch up (host stall or suspended process), restart the schedule
+                next_frame_time = current_time;
+            }
         }
     }
 
@@ -821,5 +1425,8 @@ int main(int argc, char* argv[]) {
         write(STDOUT_FILENO, reset, sizeof(reset) - 1);
     }
     endwin();
+    audio_close(&audio_state);
+    hostio_close(&hostio);
+    print_frameskip_stats();
     return 0;
 }
@@ -27,10 +27,12 @@
     - chips/m6581.h
     - chips/kbd.h
     - chips/mem.h
+    - chips/m6502dr.h
     - chips/clk.h
     - systems/c1530.h
     - chips/m6522.h
     - systems/c1541.h
+    - systems/reu.h
 
     ## The Commodore C64
 
@@ -252,11 +254,12 @@ extern "C" {
 #endif
 
 // bump snapshot version when c64_t memory layout changes
-#define C64_SNAPSHOT_VERSION (1)
+#define C64_SNAPSHOT_VERSION (12)
 
 #define C64_FREQUENCY (985248)              // clock frequency in Hz
 #define C64_MAX_AUDIO_SAMPLES (1024)        // max number of audio samples in internal sample buffer
 #define C64_DEFAULT_AUDIO_SAMPLES (128)     // default number of samples in internal sample buffer
+#define C64_MAX_CPU_TURBO (64)              // max CPU clock multiplier in c64_desc_t.cpu_turbo
 
 // C64 joystick types
 typedef enum {
@@ -268,6 +271,33 @@ typedef enum {
     C64_JOYSTICKTYPE_PADDLE_2,      // FIXME: not emulated
 } c64_joystick_type_t;
 
+// CPU emulation backends
+typedef enum {
+    C64_CPUBACKEND_TICK,            // cycle-stepped m6502_tick() (default)
+    C64_CPUBACKEND_EXEC,            // instruction-stepped m6502_exec(), same bus timing
+    C64_CPUBACKEND_DYNAREC,         // pre-decoded RAM/ROM blocks via m6502dr.h, not cycle exact
+} c64_cpu_backend_t;
+
+// CPU address decoding target of a 256-byte page (see c64_t.cpu_page)
+typedef enum {
+    C64_PAGE_MEM,           // RAM or ROM through mem_cpu
+    C64_PAGE_PORT,          // page 0: the M6510 IO port at 0000/0001, RAM otherwise
+    C64_PAGE_VIC,           // D000..D3FF
+    C64_PAGE_SID,           // D400..D7FF
+    C64_PAGE_COLOR_RAM,     // D800..DBFF
+    C64_PAGE_CIA1,          // DC00..DCFF
+    C64_PAGE_CIA2,          // DD00..DDFF
+    C64_PAGE_EXP,           // DE00..DFFF expansion port IO1/IO2, nothing connected
+    C64_PAGE_REU,           // DF00..DFFF RAM Expansion Unit registers (if connected)
+    C64_PAGE_IO1,           // DE00..DEFF host-provided device (c64_desc_t.io1)
+} c64_page_t;
+
+// host-provided device in the expansion port IO1 area (DE00..DEFF), returns the data bus value for reads
+typedef struct {
+    uint8_t (*func)(uint16_t addr, bool rw, uint8_t data, void* user_data);
+    void* user_data;
+} c64_io_callback_t;
+
 // joystick mask bits
 #define C64_JOYSTICK_UP    (1<<0)
 #define C64_JOYSTICK_DOWN  (1<<1)
@@ -324,6 +354,15 @@ typedef struct {
     bool c1530_enabled;     // true to enable the C1530 datassette emulation
     bool c1541_enabled;     // true to enable the C1541 floppy drive emulation
     c64_joystick_type_t joystick_type;  // default is C64_JOYSTICK_NONE
+    c64_cpu_backend_t cpu_backend;      // default is C64_CPUBACKEND_TICK
+    bool sid_no_sound;      // skip SID sound synthesis, only what the CPU can read back is emulated
+    bool vic_line_renderer; // render the VIC output per raster line (faster, no mid-line raster effects)
+    bool idle_skip;         // don't emulate the CPU while it spins in an idle loop (exec backend only)
+    bool basic_accel;       // run the BASIC ROM math routines with the system paused (exec backend only)
+    uint32_t basic_accel_ticks; // ticks charged per accelerated routine call (0: only the next opcode fetch)
+    uint32_t cpu_turbo;     // run the CPU at N times the system clock (exec and tick backends, 0 or 1: off)
+    chips_range_t reu;      // optional RAM Expansion Unit memory (power of 2, 128 KB to 16 MB)
+    c64_io_callback_t io1;  // optional device in the IO1 area
     chips_debug_t debug;    // optional debugging hook
     chips_audio_desc_t audio;   // audio output options
     // ROM images
@@ -341,6 +380,10 @@ typedef struct {
 
 // C64 emulator state
 typedef struct {
+    /*  state touched in every tick, kept together at the start so it stays
+        in a few cache lines, bulk data and rarely used state follows after
+        the CPU memory map
+    */
     m6502_t cpu;
     m6526_t cia_1;
     m6526_t cia_2;
@@ -348,20 +391,39 @@ typedef struct {
     m6581_t sid;
     uint64_t pins;
 
-    c64_joystick_type_t joystick_type;
+    c64_cpu_backend_t cpu_backend;
+    uint32_t cpu_ticks_ahead;   // number of ticks m6502_exec() ran past the last c64_exec() call
+    bool idle_skip;             // skip CPU emulation in idle loops, see _c64_idle_probe()
+    bool basic_accel;           // trap calls of BASIC ROM math routines, see _c64_basic_accel_run()
+    uint32_t cpu_turbo;         // CPU clock multiplier, see _c64_tick_turbo()
+    uint32_t turbo_phase;       // remaining CPU ticks before the next system tick
+    uint32_t turbo_ticks;       // system ticks in the current turbo c64_exec() call
+    uint32_t turbo_target;      // system ticks requested in the current turbo c64_exec() call
+    bool reu_active;            // REU DMA running, armed or IRQ pending, see _c64_reu_begin()
+    bool sid_no_sound;          // SID is only caught up when accessed (see m6581_skip())
+    uint32_t sid_skipped;       // ticks not yet applied to the SID (see _c64_sid_sync())
     bool io_mapped;             // true when D000..DFFF has IO area mapped in
     uint8_t cas_port;           // cassette port, shared with c1530_t if datasette is connected
     uint8_t iec_port;           // IEC serial port, shared with c1541_t if connected
     uint8_t cpu_port;           // last state of CPU port (for memory mapping)
+    uint16_t vic_bank_select;   // upper 4 address bits from CIA-2 port A
+    bool cia_1_inp_dirty;       // CIA-1 port inputs need to be recomputed from keyboard and joysticks
+    uint8_t cia_1_pa_inp;       // cached CIA-1 port A input
+    uint8_t cia_1_pb_inp;       // cached CIA-1 port B input
+    uint32_t cia_1_idle;        // remaining ticks in which CIA-1 only counts down (see m6526_idle_ticks())
+    uint32_t cia_1_skipped;     // ticks not yet applied to CIA-1 (see m6526_skip())
+    uint32_t cia_2_idle;
+    uint32_t cia_2_skipped;
+    uint8_t cpu_page[256];      // c64_page_t decoding target per CPU page, see _c64_update_memory_map()
+    mem_t mem_cpu;              // CPU-visible memory mapping (only the leading page_table is hot)
+
+    mem_t mem_vic;              // VIC-visible memory mapping (the VIC fetches through m6569_set_bank())
+    c64_joystick_type_t joystick_type;
     uint8_t kbd_joy1_mask;      // current joystick-1 state from keyboard-joystick emulation
     uint8_t kbd_joy2_mask;      // current joystick-2 state from keyboard-joystick emulation
     uint8_t joy_joy1_mask;      // current joystick-1 state from c64_joystick()
     uint8_t joy_joy2_mask;      // current joystick-2 state from c64_joystick()
-    uint16_t vic_bank_select;   // upper 4 address bits from CIA-2 port A
-
     kbd_t kbd;                  // keyboard matrix state
-    mem_t mem_cpu;              // CPU-visible memory mapping
-    mem_t mem_vic;              // VIC-visible memory mapping
     bool valid;
     chips_debug_t debug;
 
@@ -372,6 +434,11 @@ typedef struct {
         float sample_buffer[C64_MAX_AUDIO_SAMPLES];
     } audio;
 
+    uint64_t idle_ticks;        // statistics: ticks with the CPU skipped in an idle loop
+    uint32_t basic_accel_ticks; // ticks charged per accelerated BASIC ROM routine call
+    uint64_t basic_accel_calls; // statistics: accelerated BASIC ROM routine calls
+    uint64_t basic_accel_saved; // statistics: CPU ticks run by accelerated calls but not charged
+    m6502dr_t dr;               // translated code cache for C64_CPUBACKEND_DYNAREC
     uint8_t color_ram[1024];        // special static color ram
     uint8_t ram[1<<16];             // general ram
     uint8_t rom_char[0x1000];       // 4 KB character ROM image
@@ -381,6 +448,9 @@ typedef struct {
 
     c1530_t c1530;      // optional datassette
     c1541_t c1541;      // optional floppy drive
+    reu_t reu;          // optional RAM Expansion Unit
+    bool reu_ba;        // VIC-II BA in the last tick, pauses REU DMA
+    c64_io_callback_t io1;  // optional host-provided device in the IO1 area
 } c64_t;
 
 // initialize a new C64 instance
@@ -403,6 +473,8 @@ void c64_set_joystick_type(c64_t* sys, c64_joystick_type_t type);
 c64_joystick_type_t c64_joystick_type(c64_t* sys);
 // set joystick mask (combination of C64_JOYSTICK_*)
 void c64_joystick(c64_t* sys, uint8_t joy1_mask, uint8_t joy2_mask);
+// announce that the host changed c64_t.ram directly (drops translated code in that range)
+void c64_ram_modified(c64_t* sys, uint16_t addr, uint32_t num_bytes);
 // quickload a .bin/.prg file
 bool c64_quickload(c64_t* sys, chips_range_t data);
 // insert tape as .TAP file (c1530 must be enabled)
@@ -450,11 +522,34 @@ uint16_t c64_syscall_return_addr(void);
 static uint8_t _c64_cpu_port_in(void* user_data);
 static void _c64_cpu_port_out(uint8_t data, void* user_data);
 static uint16_t _c64_vic_fetch(uint16_t addr, void* user_data);
+static void _c64_update_vic_bank(c64_t* sys);
 static void _c64_update_memory_map(c64_t* sys);
 static void _c64_init_key_map(c64_t* sys);
 static void _c64_init_memory_map(c64_t* sys);
+static void _c64_cia_sync(c64_t* sys);
 
 #define _C64_DEFAULT(val,def) (((val) != 0) ? (val) : (def))
+// CRC32 of the BASIC V2 ROM (901226-01)
+#define _C64_BASIC_V2_CRC32 (0xF833D117)
+// max number of ticks translated code runs without checking for interrupts
+#define _C64_DR_MAX_TICKS (64)
+// the per-configuration tick variants rely on the tick body being inlined
+#if defined(__GNUC__)
+#define _C64_FORCE_INLINE static inline __attribute__((always_inline))
+#else
+#define _C64_FORCE_INLINE static inline
+#endif
+
+static uint32_t _c64_crc32(const uint8_t* ptr, size_t num_bytes) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < num_bytes; i++) {
+        crc ^= ptr[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
 
 void c64_init(c64_t* sys, const c64_desc_t* desc) {
     CHIPS_ASSERT(sys && desc);
@@ -463,6 +558,9 @@ void c64_init(c64_t* sys, const c64_desc_t* desc) {
     memset(sys, 0, sizeof(c64_t));
     sys->valid = true;
     sys->joystick_type = desc->joystick_type;
+    sys->cpu_backend = desc->cpu_backend;
+    sys->idle_skip = desc->idle_skip;
+    sys->sid_no_sound = desc->sid_no_sound;
     sys->debug = desc->debug;
     sys->audio.callback = desc->audio.callback;
     sys->audio.num_samples = _C64_DEFAULT(desc->audio.num_samples, C64_DEFAULT_AUDIO_SAMPLES);
@@ -473,6 +571,15 @@ void c64_init(c64_t* sys, const c64_desc_t* desc) {
     memcpy(sys->rom_char, desc->roms.chars.ptr, sizeof(sys->rom_char));
     memcpy(sys->rom_basic, desc->roms.basic.ptr, sizeof(sys->rom_basic));
     memcpy(sys->rom_kernal, desc->roms.kernal.ptr, sizeof(sys->rom_kernal));
+    // the trapped entry points are only known for the original BASIC V2 ROM
+    sys->basic_accel = desc->basic_accel && (_c64_crc32(sys->rom_basic, sizeof(sys->rom_basic)) == _C64_BASIC_V2_CRC32);
+    sys->basic_accel_ticks = desc->basic_accel_ticks;
+    sys->cpu_turbo = _C64_DEFAULT(desc->cpu_turbo, 1);
+    CHIPS_ASSERT(sys->cpu_turbo <= C64_MAX_CPU_TURBO);
+    if (desc->reu.ptr) {
+        reu_init(&sys->reu, &(reu_desc_t){ .mem = desc->reu });
+    }
+    sys->io1 = desc->io1;
 
     // initialize the hardware
     sys->cpu_port = 0xF7;       // for initial memory mapping
@@ -488,6 +595,7 @@ void c64_init(c64_t* sys, const c64_desc_t* desc) {
     });
     m6526_init(&sys->cia_1);
     m6526_init(&sys->cia_2);
+    _c64_cia_sync(sys);
     m6569_init(&sys->vic, &(m6569_desc_t){
         .fetch_cb = _c64_vic_fetch,
         .framebuffer = {
@@ -502,6 +610,7 @@ void c64_init(c64_t* sys, const c64_desc_t* desc) {
         },
         .user_data = sys,
     });
+    sys->vic.line_renderer = desc->vic_line_renderer;
     m6581_init(&sys->sid, &(m6581_desc_t){
         .tick_hz = C64_FREQUENCY,
         .sound_hz = _C64_DEFAULT(desc->audio.sample_rate, 44100),
@@ -509,6 +618,7 @@ void c64_init(c64_t* sys, const c64_desc_t* desc) {
     });
     _c64_init_key_map(sys);
     _c64_init_memory_map(sys);
+    _c64_update_vic_bank(sys);
     if (desc->c1530_enabled) {
         c1530_init(&sys->c1530, &(c1530_desc_t){
             .cas_port = &sys->cas_port,
@@ -534,6 +644,9 @@ void c64_discard(c64_t* sys) {
     if (sys->c1541.valid) {
         c1541_discard(&sys->c1541);
     }
+    if (sys->reu.valid) {
+        reu_discard(&sys->reu);
+    }
 }
 
 void c64_reset(c64_t* sys) {
@@ -547,84 +660,166 @@ void c64_reset(c64_t* sys) {
     sys->pins |= M6502_RES;
     m6526_reset(&sys->cia_1);
     m6526_reset(&sys->cia_2);
+    _c64_cia_sync(sys);
     m6569_reset(&sys->vic);
     m6581_reset(&sys->sid);
+    sys->sid_skipped = 0;
+    if (sys->reu.valid) {
+        reu_reset(&sys->reu);
+        sys->reu_active = false;
+    }
+}
+
+// pass the sample buffer to the audio callback when it is full
+static inline void _c64_audio_flush(c64_t* sys) {
+    if (sys->audio.sample_pos == sys->audio.num_samples) {
+        if (sys->audio.callback.func) {
+            sys->audio.callback.func(sys->audio.sample_buffer, sys->audio.num_samples, sys->audio.callback.user_data);
+        }
+        sys->audio.sample_pos = 0;
+    }
 }
 
-static uint64_t _c64_tick(c64_t* sys, uint64_t pins) {
+/*  apply the SID ticks skipped since the last CPU access, either as one
+    block of sound synthesis, or without sound via m6581_skip()
+*/
+static void _c64_sid_sync(c64_t* sys, bool audio) {
+    if (audio) {
+        while (sys->sid_skipped > 0) {
+            int num_samples = 0;
+            sys->sid_skipped -= m6581_synth(&sys->sid, sys->sid_skipped,
+                &sys->audio.sample_buffer[sys->audio.sample_pos],
+                sys->audio.num_samples - sys->audio.sample_pos,
+                &num_samples);
+            sys->audio.sample_pos += num_samples;
+            _c64_audio_flush(sys);
+        }
+    }
+    else if (sys->sid_skipped > 0) {
+        m6581_skip(&sys->sid, sys->sid_skipped);
+        sys->sid_skipped = 0;
+    }
+}
+
+// true if the SID generates sound for the audio callback
+static inline bool _c64_audio_enabled(const c64_t* sys) {
+    return (0 != sys->audio.callback.func) && !sys->sid_no_sound;
+}
+
+/*  REU DMA takes over the bus like the VIC-II does: the CPU is stopped
+    through RDY at its next read cycle, then the REU accesses the bus
+    once per tick, through the same address decoding as the CPU, except
+    while the VIC-II holds BA low. A transfer starts after the write to
+    the command register, or after the CPU write to FF00 which
+    triggers it.
+*/
+static inline uint64_t _c64_reu_begin(c64_t* sys, uint64_t pins, bool* reu_dma) {
+    if (sys->reu.dma && (pins & M6502_RW)) {
+        if (sys->reu_ba) {
+            // a harmless RAM read while the VIC-II owns the bus
+            M6502_SET_ADDR(pins, 0x0002);
+        }
+        else {
+            *reu_dma = true;
+            pins = reu_dma_pins(&sys->reu, pins);
+        }
+    }
+    return pins;
+}
+
+static inline uint64_t _c64_reu_end(c64_t* sys, uint64_t cpu_pins, uint64_t pins, bool reu_dma) {
+    sys->reu_ba = 0 != (pins & M6502_RDY);
+    if (reu_dma) {
+        reu_dma_done(&sys->reu, pins);
+    }
+    if (sys->reu.dma || reu_dma) {
+        // the CPU repeats its read cycle when the transfer is done
+        pins = (cpu_pins & ~(M6502_IRQ|M6502_NMI|M6502_RDY|M6510_AEC)) | (pins & (M6502_IRQ|M6502_NMI|M6510_AEC)) | M6502_RDY;
+    }
+    else if (!(cpu_pins & M6502_RW) && (M6502_GET_ADDR(cpu_pins) == 0xFF00)) {
+        reu_ff00(&sys->reu);
+    }
+    if (reu_irq(&sys->reu)) {
+        pins |= M6502_IRQ;
+    }
+    sys->reu_active = reu_busy(&sys->reu);
+    return pins;
+}
+
+/*  tick everything but the CPU for one clock cycle, pins is the CPU
+    pin mask after m6502_tick(), this is shared between the
+    cycle-stepped and the instruction-stepped CPU backends
+
+    The tape, floppy and audio arguments are always compile-time
+    constants, each combination is instantiated once by _C64_VARIANT()
+    below and c64_exec() picks the matching one per call.
+*/
+_C64_FORCE_INLINE uint64_t _c64_tick_bus(c64_t* sys, uint64_t pins, const bool tape, const bool floppy, const bool audio) {
     // FIXME: move datasette and floppy tick to end
-    if (sys->c1530.valid) {
-        c1530_tick(&sys->c1530);
+    if (tape) {
+        // with the motor off or no tape inserted, the datasette only clears the READ pulse
+        if ((0 == (sys->cas_port & C64_CASPORT_MOTOR)) && (sys->c1530.size > 0)) {
+            c1530_tick(&sys->c1530);
+        }
+        else {
+            sys->cas_port &= ~C64_CASPORT_READ;
+        }
     }
-    if (sys->c1541.valid) {
+    if (floppy) {
         c1541_tick(&sys->c1541);
     }
 
-    // tick the CPU
-    pins = m6502_tick(&sys->cpu, pins);
+    // while an REU transfer runs, the REU accesses the bus instead of the CPU
+    const uint64_t cpu_pins = pins;
+    bool reu_dma = false;
+    if (sys->reu_active) {
+        pins = _c64_reu_begin(sys, pins, &reu_dma);
+    }
+
     const uint16_t addr = M6502_GET_ADDR(pins);
 
     // those pins are set each tick by the CIAs and VIC
     pins &= ~(M6502_IRQ|M6502_NMI|M6502_RDY|M6510_AEC);
 
-    /*  address decoding
+    /*  address decoding, one lookup in the page table which is rebuilt
+        by _c64_update_memory_map()
 
         When the RDY pin is active (during bad lines), no CPU/chip
         communication takes place starting with the first read access.
     */
-    bool cpu_io_access = false;
-    bool color_ram_access = false;
-    bool mem_access = false;
-    uint64_t vic_pins = pins & M6502_PIN_MASK;
-    uint64_t cia1_pins = pins & M6502_PIN_MASK;
-    uint64_t cia2_pins = pins & M6502_PIN_MASK;
-    uint64_t sid_pins = pins & M6502_PIN_MASK;
+    c64_page_t target = C64_PAGE_EXP;
     if ((pins & (M6502_RDY|M6502_RW)) != (M6502_RDY|M6502_RW)) {
-        if (M6510_CHECK_IO(pins)) {
-            cpu_io_access = true;
-        }
-        else {
-            if (sys->io_mapped && ((addr & 0xF000) == 0xD000)) {
-                if (addr < 0xD400) {
-                    // VIC-II (D000..D3FF)
-                    vic_pins |= M6569_CS;
-                }
-                else if (addr < 0xD800) {
-                    // SID (D400..D7FF)
-                    sid_pins |= M6581_CS;
-                }
-                else if (addr < 0xDC00) {
-                    // read or write the special color Static-RAM bank (D800..DBFF)
-                    color_ram_access = true;
-                }
-                else if (addr < 0xDD00) {
-                    // CIA-1 (DC00..DCFF)
-                    cia1_pins |= M6526_CS;
-                }
-                else if (addr < 0xDE00) {
-                    // CIA-2 (DD00..DDFF)
-                    cia2_pins |= M6526_CS;
-                }
-            }
-            else {
-                mem_access = true;
-            }
+        target = (c64_page_t) sys->cpu_page[addr >> 8];
+        if ((target == C64_PAGE_PORT) && (reu_dma || !M6510_CHECK_IO(pins))) {
+            target = C64_PAGE_MEM;
         }
     }
-
-    // tick the SID
-    {
-        sid_pins = m6581_tick(&sys->sid, sid_pins);
-        if (sid_pins & M6581_SAMPLE) {
-            // new audio sample ready
-            sys->audio.sample_buffer[sys->audio.sample_pos++] = sys->sid.sample;
-            if (sys->audio.sample_pos == sys->audio.num_samples) {
-                if (sys->audio.callback.func) {
-                    sys->audio.callback.func(sys->audio.sample_buffer, sys->audio.num_samples, sys->audio.callback.user_data);
-                }
-                sys->audio.sample_pos = 0;
+    const uint64_t pins_out = pins & M6502_PIN_MASK;
+    uint64_t vic_pins = pins_out | ((target == C64_PAGE_VIC) ? M6569_CS : 0);
+    uint64_t sid_pins = pins_out | ((target == C64_PAGE_SID) ? M6581_CS : 0);
+    uint64_t cia1_pins = pins_out | ((target == C64_PAGE_CIA1) ? M6526_CS : 0);
+    uint64_t cia2_pins = pins_out | ((target == C64_PAGE_CIA2) ? M6526_CS : 0);
+
+    /*  tick the SID, with an audio callback or sid_no_sound it only runs
+        when the CPU accesses it and catches up in one block before that
+        (see _c64_sid_sync()), otherwise it is ticked without sound output
+    */
+    if ((audio || sys->sid_no_sound) && (target != C64_PAGE_SID)) {
+        sys->sid_skipped++;
+    }
+    else {
+        _c64_sid_sync(sys, audio);
+        if (audio) {
+            sid_pins = m6581_tick(&sys->sid, sid_pins);
+            if (sid_pins & M6581_SAMPLE) {
+                // new audio sample ready
+                sys->audio.sample_buffer[sys->audio.sample_pos++] = sys->sid.sample;
+                _c64_audio_flush(sys);
             }
         }
+        else {
+            sid_pins = m6581_tick_silent(&sys->sid, sid_pins);
+        }
         if ((sid_pins & (M6581_CS|M6581_RW)) == (M6581_CS|M6581_RW)) {
             pins = M6502_COPY_DATA(pins, sid_pins);
         }
@@ -642,18 +837,46 @@ static uint64_t _c64_tick(c64_t* sys, uint64_t pins) {
             write keyboard matrix lines
 
         IRQ pin is connected to the CPU IRQ pin
+
+        While the CPU doesn't access the CIA, its inputs are unchanged
+        and the timers only count down, the ticks are only counted and
+        applied in one go with m6526_skip() before the next real tick.
     */
     {
         // cassette port READ pin is connected to CIA-1 FLAG pin
-        const uint8_t pa = ~(sys->kbd_joy2_mask|sys->joy_joy2_mask);
-        const uint8_t pb = ~(kbd_scan_columns(&sys->kbd) | sys->kbd_joy1_mask | sys->joy_joy1_mask);
-        M6526_SET_PAB(cia1_pins, pa, pb);
-        if (sys->cas_port & C64_CASPORT_READ) {
-            cia1_pins |= M6526_FLAG;
+        const bool flag = 0 != (sys->cas_port & C64_CASPORT_READ);
+        if ((target != C64_PAGE_CIA1) && (sys->cia_1_idle > 0) && (flag == sys->cia_1.intr.flag)) {
+            sys->cia_1_idle--;
+            sys->cia_1_skipped++;
+            cia1_pins = sys->cia_1.pins & M6526_IRQ;
+        }
+        else {
+            if (sys->cia_1_skipped > 0) {
+                m6526_skip(&sys->cia_1, sys->cia_1_skipped);
+                sys->cia_1_skipped = 0;
+            }
+            // the port inputs only change with the keyboard/joystick state or the active keyboard lines
+            if (sys->cia_1_inp_dirty) {
+                sys->cia_1_pa_inp = ~(sys->kbd_joy2_mask|sys->joy_joy2_mask);
+                sys->cia_1_pb_inp = ~(kbd_scan_columns(&sys->kbd) | sys->kbd_joy1_mask | sys->joy_joy1_mask);
+                sys->cia_1_inp_dirty = false;
+            }
+            M6526_SET_PAB(cia1_pins, sys->cia_1_pa_inp, sys->cia_1_pb_inp);
+            if (flag) {
+                cia1_pins |= M6526_FLAG;
+            }
+            cia1_pins = m6526_tick(&sys->cia_1, cia1_pins);
+            /*  the port A output pins are only updated in the next tick, take the
+                keyboard lines from the registers so that a port write selects
+                the new lines right away (a turbo CPU reads DC01 in the next tick)
+            */
+            const uint8_t kbd_lines = ~(sys->cia_1.pa.reg | (sys->cia_1.pa.inp & ~sys->cia_1.pa.ddr));
+            if (kbd_lines != sys->kbd.active_lines) {
+                kbd_set_active_lines(&sys->kbd, kbd_lines);
+                sys->cia_1_inp_dirty = true;
+            }
+            sys->cia_1_idle = m6526_idle_ticks(&sys->cia_1);
         }
-        cia1_pins = m6526_tick(&sys->cia_1, cia1_pins);
-        const uint8_t kbd_lines = ~M6526_GET_PA(cia1_pins);
-        kbd_set_active_lines(&sys->kbd, kbd_lines);
         if (cia1_pins & M6502_IRQ) {
             pins |= M6502_IRQ;
         }
@@ -684,9 +907,25 @@ static uint64_t _c64_tick(c64_t* sys, uint64_t pins) {
         CIA-2 IRQ pin connected to CPU NMI pin
     */
     {
-        M6526_SET_PAB(cia2_pins, 0xFF, 0xFF);
-        cia2_pins = m6526_tick(&sys->cia_2, cia2_pins);
-        sys->vic_bank_select = ((~M6526_GET_PA(cia2_pins))&3)<<14;
+        if ((target != C64_PAGE_CIA2) && (sys->cia_2_idle > 0)) {
+            sys->cia_2_idle--;
+            sys->cia_2_skipped++;
+            cia2_pins = sys->cia_2.pins & M6526_IRQ;
+        }
+        else {
+            if (sys->cia_2_skipped > 0) {
+                m6526_skip(&sys->cia_2, sys->cia_2_skipped);
+                sys->cia_2_skipped = 0;
+            }
+            M6526_SET_PAB(cia2_pins, 0xFF, 0xFF);
+            cia2_pins = m6526_tick(&sys->cia_2, cia2_pins);
+            const uint16_t vic_bank_select = ((~M6526_GET_PA(cia2_pins))&3)<<14;
+            if (vic_bank_select != sys->vic_bank_select) {
+                sys->vic_bank_select = vic_bank_select;
+                _c64_update_vic_bank(sys);
+            }
+            sys->cia_2_idle = m6526_idle_ticks(&sys->cia_2);
+        }
         if (cia2_pins & M6502_IRQ) {
             pins |= M6502_NMI;
         }
@@ -719,31 +958,610 @@ static uint64_t _c64_tick(c64_t* sys, uint64_t pins) {
     /* remaining CPU IO and memory accesses, those don't fit into the
        "universal tick model" (yet?)
     */
-    if (cpu_io_access) {
-        // ...the integrated IO port in the M6510 CPU at addresses 0 and 1
-        pins = m6510_iorq(&sys->cpu, pins);
+    switch (target) {
+        case C64_PAGE_MEM:
+            if (pins & M6502_RW) {
+                // memory read
+                M6502_SET_DATA(pins, mem_rd(&sys->mem_cpu, addr));
+            }
+            else {
+                // memory write
+                mem_wr(&sys->mem_cpu, addr, M6502_GET_DATA(pins));
+                m6502dr_write(&sys->dr, addr);
+            }
+            break;
+        case C64_PAGE_PORT:
+            // ...the integrated IO port in the M6510 CPU at addresses 0 and 1
+            pins = m6510_iorq(&sys->cpu, pins);
+            break;
+        case C64_PAGE_COLOR_RAM:
+            // read or write the special color Static-RAM bank (D800..DBFF)
+            if (pins & M6502_RW) {
+                M6502_SET_DATA(pins, sys->color_ram[addr & 0x03FF]);
+            }
+            else {
+                sys->color_ram[addr & 0x03FF] = M6502_GET_DATA(pins);
+            }
+            break;
+        case C64_PAGE_REU:
+            if (pins & M6502_RW) {
+                M6502_SET_DATA(pins, reu_read(&sys->reu, addr));
+            }
+            else {
+                reu_write(&sys->reu, addr, M6502_GET_DATA(pins));
+            }
+            sys->reu_active = reu_busy(&sys->reu);
+            break;
+        case C64_PAGE_IO1:
+            if (pins & M6502_RW) {
+                M6502_SET_DATA(pins, sys->io1.func(addr, true, 0xFF, sys->io1.user_data));
+            }
+            else {
+                sys->io1.func(addr, false, M6502_GET_DATA(pins), sys->io1.user_data);
+            }
+            break;
+        default:
+            break;
+    }
+    if (sys->reu_active) {
+        pins = _c64_reu_end(sys, cpu_pins, pins, reu_dma);
+    }
+    return pins;
+}
+
+/*  translated code may only be entered at an instruction boundary when
+    the CPU isn't stalled and no interrupt or reset is about to happen
+*/
+static inline bool _c64_dr_can_enter(c64_t* sys, uint64_t pins) {
+    const m6502_t* cpu = &sys->cpu;
+    if ((pins & (M6502_SYNC|M6502_RDY|M6502_RES)) != M6502_SYNC) {
+        return false;
     }
-    else if (color_ram_access) {
-        if (pins & M6502_RW) {
-            M6502_SET_DATA(pins, sys->color_ram[addr & 0x03FF]);
+    if ((pins & M6502_IRQ) && (0 == (cpu->P & M6502_IF))) {
+        return false;
+    }
+    if ((pins & ~cpu->PINS) & M6502_NMI) {
+        return false;
+    }
+    return (0 == (cpu->irq_pip | cpu->nmi_pip | cpu->brk_flags));
+}
+
+/*  catch up with translated code which ran for num_ticks, the CPU is
+    idle on the bus except for the last tick which fetches the next
+    opcode, interrupt requests are recorded like in m6502_tick()
+*/
+_C64_FORCE_INLINE uint64_t _c64_dr_catch_up(c64_t* sys, uint64_t pins, uint32_t num_ticks, const bool tape, const bool floppy, const bool audio) {
+    m6502_t* cpu = &sys->cpu;
+    pins &= ~(M6502_SYNC|0xFFFFFFULL);
+    pins |= M6502_RW;
+    for (uint32_t i = 0; i < num_ticks; i++) {
+        if ((i + 1) == num_ticks) {
+            pins |= M6502_SYNC;
+            M6502_SET_ADDR(pins, cpu->PC);
         }
         else {
-            sys->color_ram[addr & 0x03FF] = M6502_GET_DATA(pins);
+            // a harmless RAM read
+            M6502_SET_ADDR(pins, 0x0002);
+        }
+        M6510_SET_PORT(pins, cpu->io_pins);
+        pins = _c64_tick_bus(sys, pins, tape, floppy, audio);
+        if ((i + 1) < num_ticks) {
+            if (0 != ((pins & (pins ^ cpu->PINS)) & M6502_NMI)) {
+                cpu->nmi_pip |= 0x100;
+            }
+            if ((pins & M6502_IRQ) && (0 == (cpu->P & M6502_IF))) {
+                cpu->irq_pip |= 0x100;
+            }
+            cpu->PINS = pins;
+            cpu->irq_pip <<= 1;
+            cpu->nmi_pip <<= 1;
         }
     }
-    else if (mem_access) {
-        if (pins & M6502_RW) {
-            // memory read
-            M6502_SET_DATA(pins, mem_rd(&sys->mem_cpu, addr));
+    return pins;
+}
+
+/*  run the cycle-stepped CPU for num_ticks */
+_C64_FORCE_INLINE uint64_t _c64_run_tick(c64_t* sys, uint64_t pins, uint32_t num_ticks, const bool tape, const bool floppy, const bool audio) {
+    for (uint32_t ticks = 0; ticks < num_ticks; ticks++) {
+        pins = _c64_tick_bus(sys, m6502_tick(&sys->cpu, pins), tape, floppy, audio);
+    }
+    return pins;
+}
+
+/*  Turbo CPU mode: the CPU runs at sys->cpu_turbo times the system clock
+    while the VIC-II, CIAs and SID keep their timing. Like on an
+    accelerator cartridge with its own memory, CPU ticks which access RAM,
+    ROM or the M6510 port don't need the system bus and run without
+    ticking the other chips. Every cpu_turbo-th CPU tick, and every access
+    to the IO area, is a regular system tick, so IO accesses are in sync
+    with the 1x bus. While the VIC-II holds RDY low, stalled read ticks
+    use up the fast ticks until the next system tick, which stretches
+    badlines over the same system ticks as at 1x.
+*/
+_C64_FORCE_INLINE uint64_t _c64_tick_turbo(c64_t* sys, uint64_t pins, const bool tape, const bool floppy, const bool audio) {
+    if ((sys->turbo_phase > 0) && !sys->reu_active) {
+        const uint16_t addr = M6502_GET_ADDR(pins);
+        const c64_page_t target = (c64_page_t) sys->cpu_page[addr >> 8];
+        if ((target == C64_PAGE_MEM) || (target == C64_PAGE_PORT)) {
+            sys->turbo_phase--;
+            if ((pins & (M6502_RDY|M6502_RW)) == (M6502_RDY|M6502_RW)) {
+                // stalled by the VIC-II, IRQ, NMI and RDY stay as set by the last system tick
+            }
+            else if ((target == C64_PAGE_PORT) && M6510_CHECK_IO(pins)) {
+                pins = m6510_iorq(&sys->cpu, pins);
+            }
+            else if (pins & M6502_RW) {
+                M6502_SET_DATA(pins, mem_rd(&sys->mem_cpu, addr));
+            }
+            else {
+                mem_wr(&sys->mem_cpu, addr, M6502_GET_DATA(pins));
+                m6502dr_write(&sys->dr, addr);
+            }
+            return pins;
         }
-        else {
-            // memory write
-            mem_wr(&sys->mem_cpu, addr, M6502_GET_DATA(pins));
+    }
+    sys->turbo_phase = sys->cpu_turbo - 1;
+    sys->turbo_ticks++;
+    return _c64_tick_bus(sys, pins, tape, floppy, audio);
+}
+
+/*  run the cycle-stepped CPU in turbo mode for num_ticks system ticks */
+_C64_FORCE_INLINE uint64_t _c64_run_tick_turbo(c64_t* sys, uint64_t pins, uint32_t num_ticks, const bool tape, const bool floppy, const bool audio) {
+    sys->turbo_ticks = 0;
+    while (sys->turbo_ticks < num_ticks) {
+        pins = _c64_tick_turbo(sys, m6502_tick(&sys->cpu, pins), tape, floppy, audio);
+    }
+    return pins;
+}
+
+/*  run translated code where possible, in short slices so that
+    interrupts are recognized at most _C64_DR_MAX_TICKS late,
+    and fall back to the cycle-stepped CPU everywhere else
+*/
+_C64_FORCE_INLINE uint64_t _c64_run_dr(c64_t* sys, uint64_t pins, uint32_t num_ticks, const bool tape, const bool floppy, const bool audio) {
+    uint32_t ticks = sys->cpu_ticks_ahead;
+    while (ticks < num_ticks) {
+        if (_c64_dr_can_enter(sys, pins)) {
+            uint32_t slice = num_ticks - ticks;
+            if (slice > _C64_DR_MAX_TICKS) {
+                slice = _C64_DR_MAX_TICKS;
+            }
+            const uint32_t dr_ticks = m6502_exec_dr(&sys->dr, &sys->cpu, slice);
+            if (dr_ticks > 0) {
+                pins = _c64_dr_catch_up(sys, pins, dr_ticks, tape, floppy, audio);
+                ticks += dr_ticks;
+                continue;
+            }
         }
+        pins = _c64_tick_bus(sys, m6502_tick(&sys->cpu, pins), tape, floppy, audio);
+        ticks++;
     }
+    sys->cpu_ticks_ahead = ticks - num_ticks;
     return pins;
 }
 
+/*  called by the exec backend tick callback, stops m6502_exec() at the
+    opcode fetch of an accelerated BASIC ROM routine (see _c64_basic_accel_run())
+*/
+static inline void _c64_basic_accel_check(c64_t* sys, uint64_t pins) {
+    if (!(pins & M6502_SYNC) || ((M6502_GET_ADDR(pins) & 0xE000) != 0xA000)) {
+        return;
+    }
+    switch (M6502_GET_ADDR(pins)) {
+        case 0xB63D:    // CAT: string concatenation
+        case 0xB850:    // FSUB: FAC = mem - FAC
+        case 0xB853:    // FSUBT: FAC = ARG - FAC
+        case 0xB867:    // FADD: FAC = mem + FAC
+        case 0xB86A:    // FADDT: FAC = ARG + FAC
+        case 0xBA28:    // FMULT: FAC = mem * FAC
+        case 0xBA2B:    // FMULTT: FAC = ARG * FAC
+        case 0xBB0F:    // FDIV: FAC = mem / FAC
+        case 0xBB12:    // FDIVT: FAC = ARG / FAC
+        case 0xBF71:    // SQR
+        case 0xBF7B:    // FPWRT: FAC = ARG ^ FAC
+            if ((sys->cpu_port & (C64_CPUPORT_HIRAM|C64_CPUPORT_LORAM)) == (C64_CPUPORT_HIRAM|C64_CPUPORT_LORAM)) {
+                sys->cpu.exec_break = true;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/*  number of upcoming ticks where the chips can be fast-forwarded in one
+    go while the CPU is off the bus: the CIAs only count down, the SID is
+    caught up lazily, the VIC is in timing-only mode without sprites, and
+    neither the datasette nor the floppy need to be ticked
+*/
+static inline uint32_t _c64_idle_skip_ticks(c64_t* sys, const bool tape, const bool floppy, const bool audio) {
+    if (floppy || !(audio || sys->sid_no_sound) || sys->reu_active) {
+        return 0;
+    }
+    if (tape && (0 == (sys->cas_port & C64_CASPORT_MOTOR)) && (sys->c1530.size > 0)) {
+        return 0;
+    }
+    const bool flag = 0 != (sys->cas_port & C64_CASPORT_READ);
+    if (flag != sys->cia_1.intr.flag) {
+        return 0;
+    }
+    uint32_t ticks = m6569_idle_ticks(&sys->vic);
+    ticks = (sys->cia_1_idle < ticks) ? sys->cia_1_idle : ticks;
+    ticks = (sys->cia_2_idle < ticks) ? sys->cia_2_idle : ticks;
+    return ticks;
+}
+
+/*  tick the system while the CPU spins in a confirmed idle loop (see
+    _c64_idle_probe()), the CPU is idle on the bus like in _c64_dr_catch_up()
+    until an interrupt or reset is requested or max_ticks are used up, then
+    the last tick fetches the opcode at the loop head, returns the number
+    of ticks
+
+    Stretches without any chip activity are skipped in one step with
+    m6569_skip() and the lazy CIA and SID tick counters, the interrupt
+    and NMI lines can't change during those.
+*/
+_C64_FORCE_INLINE uint32_t _c64_run_idle(c64_t* sys, uint64_t* pins_ptr, uint32_t max_ticks, const bool tape, const bool floppy, const bool audio) {
+    m6502_t* cpu = &sys->cpu;
+    uint64_t pins = *pins_ptr;
+    pins &= ~(M6502_SYNC|0xFFFFFFULL);
+    pins |= M6502_RW;
+    uint32_t ticks = 0;
+    bool last = false;
+    while (!last) {
+        last = ((ticks + 1) >= max_ticks) || (pins & M6502_RES) ||
+               ((pins & M6502_IRQ) && (0 == (cpu->P & M6502_IF))) ||
+               ((pins & ~cpu->PINS) & M6502_NMI) ||
+               (0 != (cpu->irq_pip | cpu->nmi_pip));
+        if (last) {
+            pins |= M6502_SYNC;
+            M6502_SET_ADDR(pins, cpu->PC);
+        }
+        else {
+            uint32_t skip = _c64_idle_skip_ticks(sys, tape, floppy, audio);
+            if (skip > (max_ticks - ticks - 1)) {
+                skip = max_ticks - ticks - 1;
+            }
+            if (skip > 0) {
+                m6569_skip(&sys->vic, skip);
+                sys->cia_1_idle -= skip;
+                sys->cia_1_skipped += skip;
+                sys->cia_2_idle -= skip;
+                sys->cia_2_skipped += skip;
+                sys->sid_skipped += skip;
+                ticks += skip;
+                continue;
+            }
+            // a harmless RAM read
+            M6502_SET_ADDR(pins, 0x0002);
+        }
+        M6510_SET_PORT(pins, cpu->io_pins);
+        pins = _c64_tick_bus(sys, pins, tape, floppy, audio);
+        ticks++;
+        if (!last) {
+            if (0 != ((pins & (pins ^ cpu->PINS)) & M6502_NMI)) {
+                cpu->nmi_pip |= 0x100;
+            }
+            if ((pins & M6502_IRQ) && (0 == (cpu->P & M6502_IF))) {
+                cpu->irq_pip |= 0x100;
+            }
+            cpu->PINS = pins;
+            cpu->irq_pip <<= 1;
+            cpu->nmi_pip <<= 1;
+        }
+    }
+    *pins_ptr = pins;
+    return ticks;
+}
+
+/*  per-configuration instances of the system tick: bus_tick() for the
+    debug loop, exec_tick() as m6502_exec() callback, and the complete
+    run loops for the cycle-stepped and translated CPU backends
+*/
+typedef struct {
+    uint64_t (*bus_tick)(c64_t* sys, uint64_t pins);
+    uint64_t (*exec_tick)(uint64_t pins, void* user_data);
+    uint64_t (*run_tick)(c64_t* sys, uint64_t pins, uint32_t num_ticks);
+    uint64_t (*run_dr)(c64_t* sys, uint64_t pins, uint32_t num_ticks);
+    uint32_t (*run_idle)(c64_t* sys, uint64_t* pins, uint32_t max_ticks);
+    uint64_t (*dr_catch_up)(c64_t* sys, uint64_t pins, uint32_t num_ticks);
+    uint64_t (*exec_tick_turbo)(uint64_t pins, void* user_data);
+    uint64_t (*run_tick_turbo)(c64_t* sys, uint64_t pins, uint32_t num_ticks);
+} _c64_variant_t;
+
+#define _C64_VARIANT(name, tape, floppy, audio) \
+    static uint64_t _c64_bus_tick_##name(c64_t* sys, uint64_t pins) { return _c64_tick_bus(sys, pins, tape, floppy, audio); } \
+    static uint64_t _c64_exec_tick_##name(uint64_t pins, void* user_data) { \
+        c64_t* sys = (c64_t*)user_data; \
+        pins = _c64_tick_bus(sys, pins, tape, floppy, audio); \
+        if (sys->basic_accel) { _c64_basic_accel_check(sys, pins); } \
+        return pins; \
+    } \
+    static uint64_t _c64_run_tick_##name(c64_t* sys, uint64_t pins, uint32_t num_ticks) { return _c64_run_tick(sys, pins, num_ticks, tape, floppy, audio); } \
+    static uint64_t _c64_run_dr_##name(c64_t* sys, uint64_t pins, uint32_t num_ticks) { return _c64_run_dr(sys, pins, num_ticks, tape, floppy, audio); } \
+    static uint32_t _c64_run_idle_##name(c64_t* sys, uint64_t* pins, uint32_t max_ticks) { return _c64_run_idle(sys, pins, max_ticks, tape, floppy, audio); } \
+    static uint64_t _c64_dr_catch_up_##name(c64_t* sys, uint64_t pins, uint32_t num_ticks) { return _c64_dr_catch_up(sys, pins, num_ticks, tape, floppy, audio); } \
+    static uint64_t _c64_exec_tick_turbo_##name(uint64_t pins, void* user_data) { \
+        c64_t* sys = (c64_t*)user_data; \
+        pins = _c64_tick_turbo(sys, pins, tape, floppy, audio); \
+        if (sys->turbo_ticks >= sys->turbo_target) { sys->cpu.exec_break = true; } \
+        return pins; \
+    } \
+    static uint64_t _c64_run_tick_turbo_##name(c64_t* sys, uint64_t pins, uint32_t num_ticks) { return _c64_run_tick_turbo(sys, pins, num_ticks, tape, floppy, audio); }
+_C64_VARIANT(0, false, false, false)
+_C64_VARIANT(1, true,  false, false)
+_C64_VARIANT(2, false, true,  false)
+_C64_VARIANT(3, true,  true,  false)
+_C64_VARIANT(4, false, false, true)
+_C64_VARIANT(5, true,  false, true)
+_C64_VARIANT(6, false, true,  true)
+_C64_VARIANT(7, true,  true,  true)
+#undef _C64_VARIANT
+
+#define _C64_VARIANT(name) { _c64_bus_tick_##name, _c64_exec_tick_##name, _c64_run_tick_##name, _c64_run_dr_##name, _c64_run_idle_##name, _c64_dr_catch_up_##name, _c64_exec_tick_turbo_##name, _c64_run_tick_turbo_##name }
+static const _c64_variant_t _c64_variants[8] = {
+    _C64_VARIANT(0), _C64_VARIANT(1), _C64_VARIANT(2), _C64_VARIANT(3),
+    _C64_VARIANT(4), _C64_VARIANT(5), _C64_VARIANT(6), _C64_VARIANT(7),
+};
+#undef _C64_VARIANT
+
+/*  the KERNAL serial bus routines time the IEC protocol with delay loops,
+    so turbo mode is only used without a floppy drive
+*/
+static inline bool _c64_turbo_enabled(const c64_t* sys) {
+    return (sys->cpu_turbo > 1) && !sys->c1541.valid;
+}
+
+// select the tick variant for the current tape, floppy and audio configuration
+static inline const _c64_variant_t* _c64_variant(const c64_t* sys) {
+    return &_c64_variants[(sys->c1530.valid ? 1 : 0) | (sys->c1541.valid ? 2 : 0) | (_c64_audio_enabled(sys) ? 4 : 0)];
+}
+
+/*  Idle loop detection for the exec backend.
+
+    Programs waiting for an interrupt spin in short loops like the KERNAL
+    keyboard buffer wait at $E5CD (LDA $C6, STA $CC, STA $0292, BEQ) or a
+    JMP to itself. Such a loop is a fixed point when it reads no IO
+    registers, only stores values already in memory and arrives back at
+    its first instruction with the same registers and flags: nothing but
+    an interrupt can change what it does. Memory only changes through the
+    CPU (or the host between c64_exec() calls), so a confirmed loop stays
+    idle until an interrupt is requested.
+
+    _c64_idle_probe() single-steps one iteration from the current
+    instruction, checking each instruction against the table below before
+    it runs. If the loop is confirmed, the system is ticked without the
+    CPU until an interrupt is requested, and the CPU resumes at the loop
+    head. Compared to running the loop, an interrupt may be taken up to
+    one loop iteration later.
+*/
+#define _C64_IDLE_MAX_INSTRUCTIONS (16)
+// addressing modes for _c64_idle_ops, stores have the source register in the upper bits
+#define _C64_IDLE_IMP   (1)
+#define _C64_IDLE_IMM   (2)
+#define _C64_IDLE_ZP    (3)
+#define _C64_IDLE_ZPX   (4)
+#define _C64_IDLE_ZPY   (5)
+#define _C64_IDLE_ABS   (6)
+#define _C64_IDLE_ABSX  (7)
+#define _C64_IDLE_ABSY  (8)
+#define _C64_IDLE_REL   (9)
+#define _C64_IDLE_JMP   (10)
+#define _C64_IDLE_STA   (1<<4)
+#define _C64_IDLE_STX   (2<<4)
+#define _C64_IDLE_STY   (3<<4)
+static const uint8_t _c64_idle_ops[256] = {
+    // LDA, LDX, LDY
+    [0xA9] = _C64_IDLE_IMM, [0xA5] = _C64_IDLE_ZP, [0xB5] = _C64_IDLE_ZPX, [0xAD] = _C64_IDLE_ABS, [0xBD] = _C64_IDLE_ABSX, [0xB9] = _C64_IDLE_ABSY,
+    [0xA2] = _C64_IDLE_IMM, [0xA6] = _C64_IDLE_ZP, [0xB6] = _C64_IDLE_ZPY, [0xAE] = _C64_IDLE_ABS, [0xBE] = _C64_IDLE_ABSY,
+    [0xA0] = _C64_IDLE_IMM, [0xA4] = _C64_IDLE_ZP, [0xB4] = _C64_IDLE_ZPX, [0xAC] = _C64_IDLE_ABS, [0xBC] = _C64_IDLE_ABSX,
+    // CMP, CPX, CPY, BIT
+    [0xC9] = _C64_IDLE_IMM, [0xC5] = _C64_IDLE_ZP, [0xD5] = _C64_IDLE_ZPX, [0xCD] = _C64_IDLE_ABS, [0xDD] = _C64_IDLE_ABSX, [0xD9] = _C64_IDLE_ABSY,
+    [0xE0] = _C64_IDLE_IMM, [0xE4] = _C64_IDLE_ZP, [0xEC] = _C64_IDLE_ABS,
+    [0xC0] = _C64_IDLE_IMM, [0xC4] = _C64_IDLE_ZP, [0xCC] = _C64_IDLE_ABS,
+    [0x24] = _C64_IDLE_ZP, [0x2C] = _C64_IDLE_ABS,
+    // AND, ORA, EOR
+    [0x29] = _C64_IDLE_IMM, [0x25] = _C64_IDLE_ZP, [0x35] = _C64_IDLE_ZPX, [0x2D] = _C64_IDLE_ABS, [0x3D] = _C64_IDLE_ABSX, [0x39] = _C64_IDLE_ABSY,
+    [0x09] = _C64_IDLE_IMM, [0x05] = _C64_IDLE_ZP, [0x15] = _C64_IDLE_ZPX, [0x0D] = _C64_IDLE_ABS, [0x1D] = _C64_IDLE_ABSX, [0x19] = _C64_IDLE_ABSY,
+    [0x49] = _C64_IDLE_IMM, [0x45] = _C64_IDLE_ZP, [0x55] = _C64_IDLE_ZPX, [0x4D] = _C64_IDLE_ABS, [0x5D] = _C64_IDLE_ABSX, [0x59] = _C64_IDLE_ABSY,
+    // register-only instructions, the loop check catches any changes
+    [0xEA] = _C64_IDLE_IMP, [0xAA] = _C64_IDLE_IMP, [0xA8] = _C64_IDLE_IMP, [0x8A] = _C64_IDLE_IMP, [0x98] = _C64_IDLE_IMP,
+    [0xBA] = _C64_IDLE_IMP, [0xE8] = _C64_IDLE_IMP, [0xC8] = _C64_IDLE_IMP, [0xCA] = _C64_IDLE_IMP, [0x88] = _C64_IDLE_IMP,
+    [0x18] = _C64_IDLE_IMP, [0x38] = _C64_IDLE_IMP, [0xB8] = _C64_IDLE_IMP,
+    [0x0A] = _C64_IDLE_IMP, [0x4A] = _C64_IDLE_IMP, [0x2A] = _C64_IDLE_IMP, [0x6A] = _C64_IDLE_IMP,
+    // branches and JMP abs
+    [0x10] = _C64_IDLE_REL, [0x30] = _C64_IDLE_REL, [0x50] = _C64_IDLE_REL, [0x70] = _C64_IDLE_REL,
+    [0x90] = _C64_IDLE_REL, [0xB0] = _C64_IDLE_REL, [0xD0] = _C64_IDLE_REL, [0xF0] = _C64_IDLE_REL,
+    [0x4C] = _C64_IDLE_JMP,
+    // STA, STX, STY
+    [0x85] = _C64_IDLE_STA|_C64_IDLE_ZP, [0x95] = _C64_IDLE_STA|_C64_IDLE_ZPX, [0x8D] = _C64_IDLE_STA|_C64_IDLE_ABS,
+    [0x9D] = _C64_IDLE_STA|_C64_IDLE_ABSX, [0x99] = _C64_IDLE_STA|_C64_IDLE_ABSY,
+    [0x86] = _C64_IDLE_STX|_C64_IDLE_ZP, [0x96] = _C64_IDLE_STX|_C64_IDLE_ZPY, [0x8E] = _C64_IDLE_STX|_C64_IDLE_ABS,
+    [0x84] = _C64_IDLE_STY|_C64_IDLE_ZP, [0x94] = _C64_IDLE_STY|_C64_IDLE_ZPX, [0x8C] = _C64_IDLE_STY|_C64_IDLE_ABS,
+};
+
+// true if a CPU access to addr is a plain RAM or ROM access
+static inline bool _c64_idle_mem(const c64_t* sys, uint16_t addr) {
+    const c64_page_t page = (c64_page_t) sys->cpu_page[addr >> 8];
+    return (page == C64_PAGE_MEM) || ((page == C64_PAGE_PORT) && (addr > 1));
+}
+
+// true if the instruction at PC may be part of an idle loop
+static bool _c64_idle_check_op(c64_t* sys) {
+    const m6502_t* cpu = &sys->cpu;
+    const uint16_t pc = cpu->PC;
+    if (!_c64_idle_mem(sys, pc) || !_c64_idle_mem(sys, pc + 2)) {
+        return false;
+    }
+    const uint8_t op = _c64_idle_ops[mem_rd(&sys->mem_cpu, pc)];
+    const uint8_t lo = mem_rd(&sys->mem_cpu, pc + 1);
+    const uint16_t abs = lo | (mem_rd(&sys->mem_cpu, pc + 2) << 8);
+    uint16_t addr;
+    switch (op & 0x0F) {
+        case _C64_IDLE_IMP: case _C64_IDLE_IMM: case _C64_IDLE_REL: case _C64_IDLE_JMP:
+            return true;
+        case _C64_IDLE_ZP:   addr = lo; break;
+        case _C64_IDLE_ZPX:  addr = (lo + cpu->X) & 0xFF; break;
+        case _C64_IDLE_ZPY:  addr = (lo + cpu->Y) & 0xFF; break;
+        case _C64_IDLE_ABS:  addr = abs; break;
+        case _C64_IDLE_ABSX: addr = abs + cpu->X; break;
+        case _C64_IDLE_ABSY: addr = abs + cpu->Y; break;
+        default: return false;
+    }
+    // indexed absolute addressing may do a dummy read before the page is fixed up
+    const uint16_t dummy = (abs & 0xFF00) | (addr & 0x00FF);
+    if (!_c64_idle_mem(sys, addr) || !_c64_idle_mem(sys, dummy)) {
+        return false;
+    }
+    if (op & 0xF0) {
+        // a store must write back the value already in memory
+        uint8_t val;
+        switch (op & 0xF0) {
+            case _C64_IDLE_STA: val = cpu->A; break;
+            case _C64_IDLE_STX: val = cpu->X; break;
+            default:            val = cpu->Y; break;
+        }
+        return val == sys->mem_cpu.page_table[addr >> MEM_PAGE_SHIFT].write_ptr[addr & MEM_PAGE_MASK];
+    }
+    return true;
+}
+
+/*  single-step the CPU through one iteration of a potential idle loop
+    starting at the current instruction, returns true if the CPU is back
+    at the loop head with unchanged registers, *ticks is incremented by
+    the executed ticks
+*/
+static bool _c64_idle_probe(c64_t* sys, uint64_t* pins, uint32_t* ticks, uint32_t max_ticks, const _c64_variant_t* variant) {
+    m6502_t* cpu = &sys->cpu;
+    if (!_c64_dr_can_enter(sys, *pins)) {
+        return false;
+    }
+    const uint16_t pc = cpu->PC;
+    const uint8_t a = cpu->A, x = cpu->X, y = cpu->Y, s = cpu->S, p = cpu->P;
+    for (int i = 0; (i < _C64_IDLE_MAX_INSTRUCTIONS) && (*ticks < max_ticks); i++) {
+        if (!_c64_idle_check_op(sys)) {
+            return false;
+        }
+        *ticks += m6502_exec(cpu, pins, 1, variant->exec_tick, sys);
+        if (cpu->exec_break || !_c64_dr_can_enter(sys, *pins)) {
+            return false;
+        }
+        if (cpu->PC == pc) {
+            return (cpu->A == a) && (cpu->X == x) && (cpu->Y == y) && (cpu->S == s) && (cpu->P == p);
+        }
+    }
+    return false;
+}
+
+/*  BASIC ROM math acceleration for the exec backend.
+
+    Number crunching BASIC programs spend most of their time in the
+    floating point routines of the BASIC ROM. When the exec tick callback
+    sees the opcode fetch of one of the entry points in
+    _c64_basic_accel_check(), m6502_exec() returns and the whole routine
+    runs as translated code on the CPU memory map (m6502_exec_dr()) while
+    the rest of the system is paused, so the results are the ones of the
+    unmodified ROM code by construction. Afterwards the system is caught
+    up for a fixed number of ticks (sys->basic_accel_ticks) instead of the
+    ticks the routine actually took, interrupts are taken after the call.
+
+    The routine is done when the return address which was on top of the
+    stack at the entry point has been pulled by an RTS. When it pulls
+    more from the stack than that (e.g. an error which resets the stack),
+    runs into code the translator rejects (IO access) or runs longer than
+    _C64_BASIC_ACCEL_MAX_TICKS, the executed ticks are charged instead and
+    the CPU continues normally from where translated code stopped.
+
+    The entry points are those of the BASIC V2 ROM, the accelerator is
+    only enabled when the ROM image matches by CRC32.
+*/
+#define _C64_BASIC_ACCEL_MAX_TICKS (50000)
+static uint32_t _c64_basic_accel_run(c64_t* sys, uint64_t* pins, const _c64_variant_t* variant) {
+    m6502_t* cpu = &sys->cpu;
+    cpu->exec_break = false;
+    if (!_c64_dr_can_enter(sys, *pins)) {
+        return 0;
+    }
+    const uint8_t s = cpu->S;
+    const uint16_t ret = ((mem_rd(&sys->mem_cpu, 0x0100 | (uint8_t)(s + 2)) << 8) | mem_rd(&sys->mem_cpu, 0x0100 | (uint8_t)(s + 1))) + 1;
+    uint32_t ticks = 0;
+    bool done = false;
+    while (ticks < _C64_BASIC_ACCEL_MAX_TICKS) {
+        // one instruction at a time to see the return
+        const uint32_t op_ticks = m6502_exec_dr(&sys->dr, cpu, 1);
+        if (0 == op_ticks) {
+            break;
+        }
+        ticks += op_ticks;
+        const uint8_t pulled = cpu->S - s;
+        if ((pulled >= 2) && (pulled < 0x80)) {
+            done = (pulled == 2) && (cpu->PC == ret);
+            break;
+        }
+    }
+    if (0 == ticks) {
+        return 0;
+    }
+    uint32_t charged = ticks;
+    if (done) {
+        charged = (sys->basic_accel_ticks > 0) ? sys->basic_accel_ticks : 1;
+        sys->basic_accel_calls++;
+        if (ticks > charged) {
+            sys->basic_accel_saved += ticks - charged;
+        }
+    }
+    *pins = variant->dr_catch_up(sys, *pins, charged);
+    return charged;
+}
+
+/*  run the instruction-stepped CPU for at least num_ticks, with calls of
+    accelerated BASIC ROM routines taken care of
+*/
+static uint32_t _c64_exec_cpu(c64_t* sys, uint64_t* pins, uint32_t num_ticks, const _c64_variant_t* variant) {
+    uint32_t ticks = m6502_exec(&sys->cpu, pins, num_ticks, variant->exec_tick, sys);
+    while (sys->cpu.exec_break) {
+        ticks += _c64_basic_accel_run(sys, pins, variant);
+        if (ticks < num_ticks) {
+            ticks += m6502_exec(&sys->cpu, pins, num_ticks - ticks, variant->exec_tick, sys);
+        }
+    }
+    return ticks;
+}
+
+/*  run the instruction-stepped CPU in turbo mode for at least num_ticks
+    system ticks, the tick callback stops m6502_exec() at the instruction
+    boundary after the last requested system tick, returns the executed
+    system ticks
+*/
+static uint32_t _c64_exec_turbo(c64_t* sys, uint64_t* pins, uint32_t num_ticks, const _c64_variant_t* variant) {
+    sys->turbo_ticks = 0;
+    sys->turbo_target = num_ticks;
+    // each system tick takes at most cpu_turbo CPU ticks
+    m6502_exec(&sys->cpu, pins, num_ticks * sys->cpu_turbo, variant->exec_tick_turbo, sys);
+    sys->cpu.exec_break = false;
+    return sys->turbo_ticks;
+}
+
+/*  run the exec backend with idle loop skipping, returns the executed ticks,
+    when the probe fails the CPU runs normally for a slice of ticks before
+    the next probe
+*/
+#define _C64_IDLE_SLICE_TICKS (256)
+static uint32_t _c64_exec_idle(c64_t* sys, uint64_t* pins, uint32_t num_ticks, const _c64_variant_t* variant) {
+    uint32_t ticks = 0;
+    while (ticks < num_ticks) {
+        if (_c64_idle_probe(sys, pins, &ticks, num_ticks, variant) && (ticks < num_ticks)) {
+            const uint32_t idle_ticks = variant->run_idle(sys, pins, num_ticks - ticks);
+            sys->idle_ticks += idle_ticks;
+            ticks += idle_ticks;
+        }
+        else if (ticks < num_ticks) {
+            const uint32_t slice = num_ticks - ticks;
+            ticks += _c64_exec_cpu(sys, pins, (slice < _C64_IDLE_SLICE_TICKS) ? slice : _C64_IDLE_SLICE_TICKS, variant);
+        }
+    }
+    return ticks;
+}
+
 static uint8_t _c64_cpu_port_in(void* user_data) {
     c64_t* sys = (c64_t*) user_data;
     /*
@@ -805,6 +1623,21 @@ static uint16_t _c64_vic_fetch(uint16_t addr, void* user_data) {
     return data;
 }
 
+/*
+    Point the VIC-II directly at the four 4 KByte pages of the current
+    16 KByte bank in mem_vic (RAM, or the char ROM at $1000 and $9000)
+    and at the color RAM, so that its fetches don't go through
+    _c64_vic_fetch(). Must be called when vic_bank_select changes.
+*/
+static void _c64_update_vic_bank(c64_t* sys) {
+    const uint8_t* pages[4];
+    for (size_t i = 0; i < 4; i++) {
+        const uint16_t addr = sys->vic_bank_select + (i * 0x1000);
+        pages[i] = sys->mem_vic.page_table[addr >> MEM_PAGE_SHIFT].read_ptr;
+    }
+    m6569_set_bank(&sys->vic, pages, sys->color_ram);
+}
+
 static void _c64_update_memory_map(c64_t* sys) {
     sys->io_mapped = false;
     uint8_t* read_ptr;
@@ -839,10 +1672,39 @@ static void _c64_update_memory_map(c64_t* sys) {
             mem_map_rw(&sys->mem_cpu, 0, 0xD000, 0x1000, sys->rom_char, sys->ram+0xD000);
         }
     }
+
+    // rebuild the CPU address decoding table
+    memset(sys->cpu_page, C64_PAGE_MEM, sizeof(sys->cpu_page));
+    sys->cpu_page[0x00] = C64_PAGE_PORT;
+    if (sys->io_mapped) {
+        memset(&sys->cpu_page[0xD0], C64_PAGE_VIC, 4);
+        memset(&sys->cpu_page[0xD4], C64_PAGE_SID, 4);
+        memset(&sys->cpu_page[0xD8], C64_PAGE_COLOR_RAM, 4);
+        sys->cpu_page[0xDC] = C64_PAGE_CIA1;
+        sys->cpu_page[0xDD] = C64_PAGE_CIA2;
+        memset(&sys->cpu_page[0xDE], C64_PAGE_EXP, 2);
+        if (sys->io1.func) {
+            sys->cpu_page[0xDE] = C64_PAGE_IO1;
+        }
+        if (sys->reu.valid) {
+            sys->cpu_page[0xDF] = C64_PAGE_REU;
+        }
+    }
+
+    // plain memory for translated code, the I/O area is decoded in _c64_tick_bus()
+    m6502dr_map(&sys->dr, &sys->mem_cpu);
+    if (sys->io_mapped) {
+        m6502dr_unmap(&sys->dr, 0xD000, 0x1000);
+    }
+    if (sys->reu.valid) {
+        // CPU writes to FF00 may start an REU transfer
+        m6502dr_unmap(&sys->dr, 0xFF00, 0x100);
+    }
 }
 
 static void _c64_init_memory_map(c64_t* sys) {
     // seperate memory mapping for CPU and VIC-II
+    m6502dr_init(&sys->dr);
     mem_init(&sys->mem_cpu);
     mem_init(&sys->mem_vic);
 
@@ -954,24 +1816,71 @@ uint32_t c64_exec(c64_t* sys, uint32_t micro_seconds) {
     CHIPS_ASSERT(sys && sys->valid);
     uint32_t num_ticks = clk_us_to_ticks(C64_FREQUENCY, micro_seconds);
     uint64_t pins = sys->pins;
-    if (0 == sys->debug.callback.func) {
+    const _c64_variant_t* variant = _c64_variant(sys);
+    if ((0 == sys->debug.callback.func) && (sys->cpu_backend == C64_CPUBACKEND_EXEC)) {
+        /* run the instruction-stepped CPU, this stops at instruction
+           boundaries and may run a few ticks longer than requested,
+           those are subtracted from the next call
+        */
+        if (num_ticks > sys->cpu_ticks_ahead) {
+            const uint32_t ticks = num_ticks - sys->cpu_ticks_ahead;
+            if (_c64_turbo_enabled(sys)) {
+                sys->cpu_ticks_ahead = _c64_exec_turbo(sys, &pins, ticks, variant) - ticks;
+            }
+            else if (sys->idle_skip) {
+                sys->cpu_ticks_ahead = _c64_exec_idle(sys, &pins, ticks, variant) - ticks;
+            }
+            else {
+                sys->cpu_ticks_ahead = _c64_exec_cpu(sys, &pins, ticks, variant) - ticks;
+            }
+        }
+        else {
+            sys->cpu_ticks_ahead -= num_ticks;
+        }
+    }
+    else if ((0 == sys->debug.callback.func) && (sys->cpu_backend == C64_CPUBACKEND_DYNAREC)) {
+        // run translated code where possible
+        pins = variant->run_dr(sys, pins, num_ticks);
+    }
+    else if (0 == sys->debug.callback.func) {
         // run without debug callback
-        for (uint32_t ticks = 0; ticks < num_ticks; ticks++) {
-            pins = _c64_tick(sys, pins);
+        if (_c64_turbo_enabled(sys)) {
+            pins = variant->run_tick_turbo(sys, pins, num_ticks);
+        }
+        else {
+            pins = variant->run_tick(sys, pins, num_ticks);
         }
     }
     else {
         // run with debug callback
         for (uint32_t ticks = 0; (ticks < num_ticks) && !(*sys->debug.stopped); ticks++) {
-            pins = _c64_tick(sys, pins);
+            pins = variant->bus_tick(sys, m6502_tick(&sys->cpu, pins));
             sys->debug.callback.func(sys->debug.callback.user_data, pins);
         }
     }
     sys->pins = pins;
     kbd_update(&sys->kbd, micro_seconds);
+    _c64_cia_sync(sys);
+    _c64_sid_sync(sys, _c64_audio_enabled(sys));
     return num_ticks;
 }
 
+/*  apply skipped CIA ticks so that the CIA state is current, and force a
+    real tick next time, must be called whenever the CIA inputs change
+    outside of _c64_tick_bus()
+*/
+static void _c64_cia_sync(c64_t* sys) {
+    if (sys->cia_1_skipped > 0) {
+        m6526_skip(&sys->cia_1, sys->cia_1_skipped);
+    }
+    if (sys->cia_2_skipped > 0) {
+        m6526_skip(&sys->cia_2, sys->cia_2_skipped);
+    }
+    sys->cia_1_skipped = sys->cia_2_skipped = 0;
+    sys->cia_1_idle = sys->cia_2_idle = 0;
+    sys->cia_1_inp_dirty = true;
+}
+
 void c64_key_down(c64_t* sys, int key_code) {
     CHIPS_ASSERT(sys && sys->valid);
     if (sys->joystick_type == C64_JOYSTICKTYPE_NONE) {
@@ -1003,6 +1912,7 @@ void c64_key_down(c64_t* sys, int key_code) {
             }
         }
     }
+    _c64_cia_sync(sys);
 }
 
 void c64_key_up(c64_t* sys, int key_code) {
@@ -1036,6 +1946,7 @@ void c64_key_up(c64_t* sys, int key_code) {
             }
         }
     }
+    _c64_cia_sync(sys);
 }
 
 void c64_set_joystick_type(c64_t* sys, c64_joystick_type_t type) {
@@ -1052,6 +1963,20 @@ void c64_joystick(c64_t* sys, uint8_t joy1_mask, uint8_t joy2_mask) {
     CHIPS_ASSERT(sys && sys->valid);
     sys->joy_joy1_mask = joy1_mask;
     sys->joy_joy2_mask = joy2_mask;
+    _c64_cia_sync(sys);
+}
+
+void c64_ram_modified(c64_t* sys, uint16_t addr, uint32_t num_bytes) {
+    CHIPS_ASSERT(sys && sys->valid && (num_bytes <= 0x10000));
+    if (num_bytes == 0) {
+        return;
+    }
+    // the range may wrap around at FFFF
+    const uint32_t first = addr >> M6502DR_LINE_SHIFT;
+    const uint32_t last = (addr + num_bytes - 1) >> M6502DR_LINE_SHIFT;
+    for (uint32_t line = first; line <= last; line++) {
+        m6502dr_write(&sys->dr, (uint16_t)(line << M6502DR_LINE_SHIFT));
+    }
 }
 
 bool c64_quickload(c64_t* sys, chips_range_t data) {
@@ -1074,6 +1999,7 @@ bool c64_quickload(c64_t* sys, chips_range_t data) {
     mem_wr16(&sys->mem_cpu, 0x31, end_addr);
     mem_wr16(&sys->mem_cpu, 0x33, end_addr);
     mem_wr16(&sys->mem_cpu, 0xae, end_addr);
+    m6502dr_invalidate(&sys->dr);
 
     return true;
 }
@@ -1144,11 +2070,14 @@ uint32_t c64_save_snapshot(c64_t* sys, c64_t* dst) {
     chips_debug_snapshot_onsave(&dst->debug);
     chips_audio_callback_snapshot_onsave(&dst->audio.callback);
     m6502_snapshot_onsave(&dst->cpu);
+    m6502dr_snapshot_onsave(&dst->dr);
     m6569_snapshot_onsave(&dst->vic);
     mem_snapshot_onsave(&dst->mem_cpu, sys);
     mem_snapshot_onsave(&dst->mem_vic, sys);
     c1530_snapshot_onsave(&dst->c1530);
     c1541_snapshot_onsave(&dst->c1541, sys);
+    reu_snapshot_onsave(&dst->reu);
+    dst->io1 = (c64_io_callback_t){ 0 };
     return C64_SNAPSHOT_VERSION;
 }
 
@@ -1162,12 +2091,17 @@ bool c64_load_snapshot(c64_t* sys, uint32_t version, c64_t* src) {
     chips_debug_snapshot_onload(&im.debug, &sys->debug);
     chips_audio_callback_snapshot_onload(&im.audio.callback, &sys->audio.callback);
     m6502_snapshot_onload(&im.cpu, &sys->cpu);
+    m6502dr_snapshot_onload(&im.dr);
     m6569_snapshot_onload(&im.vic, &sys->vic);
     mem_snapshot_onload(&im.mem_cpu, sys);
     mem_snapshot_onload(&im.mem_vic, sys);
     c1530_snapshot_onload(&im.c1530, &sys->c1530);
     c1541_snapshot_onload(&im.c1541, &sys->c1541, sys);
+    reu_snapshot_onload(&im.reu, &sys->reu);
+    im.io1 = sys->io1;
     *sys = im;
+    _c64_update_memory_map(sys);
+    _c64_update_vic_bank(sys);
     return true;
 }
 
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""
+Generates _m6502_decoder.h, the instruction-stepped m6502_exec(), from the
+cycle-stepped m6502_tick() decoder in m6502.h, so that both decoders run
+the same per-cycle code:
+
+    python3 codegen/m6502_exec_gen.py m6502.h > _m6502_decoder.h
+
+Every 'case (op<<3)|cycle:' body between '// <% decoder' and '// %>' in
+m6502.h becomes one line of straight-line code followed by a system tick:
+
+  - c->IR+=cond (skipped cycles, e.g. page crossing) becomes a forward goto
+  - c->IR-- (JAM) repeats the cycle until the tick budget is used up
+  - _FETCH() ends the instruction, or with a conditional fetch (branches)
+    ends it when SYNC was set
+
+Changes to the prologue, interrupt handling and exit of m6502_exec() go
+into HEADER and FOOTER below, changes to instructions into m6502_tick().
+"""
+import re
+import sys
+
+HEADER = """/* machine generated by codegen/m6502_exec_gen.py from m6502_tick() in m6502.h, don't edit! */
+/*
+    Instruction-stepped 6502/6510 decoder, included by m6502.h in the
+    CHIPS_IMPL section.
+
+    Each instruction is decoded once into straight-line code, registers
+    live in a local copy of the CPU state for the whole instruction, and
+    the tick callback is invoked once per clock cycle with the same pin
+    mask as m6502_tick() would produce, so the bus behaviour is identical
+    to the cycle-stepped decoder (including RDY stalls and the IRQ/NMI
+    pipelines).
+*/
+/* set 16-bit address in 64-bit pin mask */
+#define _SA(addr) pins=(pins&~0xFFFF)|((addr)&0xFFFFULL)
+/* set 16-bit address and 8-bit data in 64-bit pin mask */
+#define _SAD(addr,data) pins=(pins&~0xFFFFFF)|((((data)&0xFF)<<16)&0xFF0000ULL)|((addr)&0xFFFFULL)
+/* fetch next opcode byte */
+#define _FETCH() _SA(c.PC);_ON(M6502_SYNC);
+/* set 8-bit data in 64-bit pin mask */
+#define _SD(data) pins=((pins&~0xFF0000ULL)|(((data&0xFF)<<16)&0xFF0000ULL))
+/* extract 8-bit data from 64-bit pin mask */
+#define _GD() ((uint8_t)((pins&0xFF0000ULL)>>16))
+/* enable control pins */
+#define _ON(m) pins|=(m)
+/* disable control pins */
+#define _OFF(m) pins&=~(m)
+/* a memory read tick */
+#define _RD() _ON(M6502_RW);
+/* a memory write tick */
+#define _WR() _OFF(M6502_RW);
+/* set N and Z flags depending on value */
+#define _NZ(v) c.P=((c.P&~(M6502_NF|M6502_ZF))|((v&0xFF)?(v&M6502_NF):M6502_ZF))
+/* interrupt detection and RDY stall at the start of a cycle (same as m6502_tick), a stalled
+   opcode fetch is an instruction boundary where m6502_exec() returns when the tick budget is used up
+*/
+#define _P() for(;;){if(pins&(M6502_IRQ|M6502_NMI|M6502_RDY|M6502_RES)){if(0!=((pins&(pins^c.PINS))&M6502_NMI)){c.nmi_pip|=0x100;}if((pins&M6502_IRQ)&&(0==(c.P&M6502_IF))){c.irq_pip|=0x100;}if((pins&(M6502_RW|M6502_RDY))==(M6502_RW|M6502_RDY)){if((pins&M6502_SYNC)&&(ticks>=num_ticks)){break;}M6510_SET_PORT(pins,cpu->io_pins);c.PINS=pins;c.irq_pip<<=1;pins=tick(pins,ud);ticks++;continue;}}break;}
+/* finish the current cycle, tick the system, and start the next cycle */
+#define _T() M6510_SET_PORT(pins,cpu->io_pins);c.PINS=pins;c.irq_pip<<=1;c.nmi_pip<<=1;pins=tick(pins,ud);ticks++;_P();_RD();
+
+uint32_t m6502_exec(m6502_t* cpu, uint64_t* pins_ptr, uint32_t num_ticks, m6502_tick_t tick, void* ud) {
+    uint64_t pins = *pins_ptr;
+    uint32_t ticks = 0;
+    /* if not at an instruction boundary, continue cycle-stepped until the next opcode fetch */
+    while (!(pins & M6502_SYNC) && (ticks < num_ticks)) {
+        pins = tick(m6502_tick(cpu, pins), ud);
+        ticks++;
+    }
+    if (!(pins & M6502_SYNC) || cpu->exec_break) {
+        *pins_ptr = pins;
+        return ticks;
+    }
+    /* only the register state is kept in locals, the 6510 IO port state
+       may be modified from within the tick callback
+    */
+    m6502_t c;
+    c.IR = cpu->IR; c.PC = cpu->PC; c.AD = cpu->AD;
+    c.A = cpu->A; c.X = cpu->X; c.Y = cpu->Y; c.S = cpu->S; c.P = cpu->P;
+    c.PINS = cpu->PINS;
+    c.irq_pip = cpu->irq_pip; c.nmi_pip = cpu->nmi_pip;
+    c.brk_flags = cpu->brk_flags;
+    c.bcd_enabled = cpu->bcd_enabled;
+    _P();
+    if ((pins & (M6502_RW|M6502_RDY)) == (M6502_RW|M6502_RDY)) {
+        /* still stalled when the tick budget ran out */
+        goto _exit;
+    }
+    do {
+        /* load new instruction into 'instruction register' and check interrupts, see m6502_tick() */
+        c.IR = _GD()<<3;
+        _OFF(M6502_SYNC);
+        if (0 != (c.irq_pip & 0x400)) {
+            c.brk_flags |= M6502_BRK_IRQ;
+        }
+        if (0 != (c.nmi_pip & 0xFC00)) {
+            c.brk_flags |= M6502_BRK_NMI;
+        }
+        if (0 != (pins & M6502_RES)) {
+            c.brk_flags |= M6502_BRK_RESET;
+            cpu->io_ddr = 0;
+            cpu->io_out = 0;
+            cpu->io_inp = 0;
+            cpu->io_pins = 0;
+        }
+        c.irq_pip &= 0x3FF;
+        c.nmi_pip &= 0x3FF;
+        if (c.brk_flags) {
+            c.IR = 0;
+            c.P &= ~M6502_BF;
+            pins &= ~M6502_RES;
+        }
+        else {
+            c.PC++;
+        }
+        _RD();
+        switch (c.IR>>3) {
+"""
+
+FOOTER = """            default: _M6502_UNREACHABLE;
+        }
+    } while ((ticks < num_ticks) && !cpu->exec_break);
+_exit:
+    cpu->IR = c.IR; cpu->PC = c.PC; cpu->AD = c.AD;
+    cpu->A = c.A; cpu->X = c.X; cpu->Y = c.Y; cpu->S = c.S; cpu->P = c.P;
+    cpu->PINS = c.PINS;
+    cpu->irq_pip = c.irq_pip; cpu->nmi_pip = c.nmi_pip;
+    cpu->brk_flags = c.brk_flags;
+    *pins_ptr = pins;
+    return ticks;
+}
+#undef _SA
+#undef _SAD
+#undef _FETCH
+#undef _SD
+#undef _GD
+#undef _ON
+#undef _OFF
+#undef _RD
+#undef _WR
+#undef _NZ
+#undef _P
+#undef _T
+"""
+
+def parse(src):
+    region = src[src.index('// <% decoder'):src.index('// %>')]
+    ops = {}
+    names = {}
+    cur_name = None
+    for line in region.split('\n'):
+        line = line.strip()
+        m = re.match(r'/\* (.*) \*/$', line)
+        if m:
+            cur_name = m.group(1).strip()
+            continue
+        m = re.match(r'case \(0x([0-9A-F]{2})<<3\)\|(\d): (?:_M6502_LABEL\(0x[0-9A-F]{2},\d\) )?(.*)break;$', line)
+        if m:
+            op = int(m.group(1), 16)
+            names[op] = cur_name
+            ops.setdefault(op, [None] * 8)[int(m.group(2))] = m.group(3)
+    assert len(ops) == 256
+    return ops, names
+
+def conv(body):
+    # m6502_tick() works on the cpu pointer, m6502_exec() on a local copy
+    body = body.replace('c->', 'c.')
+    return re.sub(r'(_m6502_[a-z]+)\(c([,)])', r'\1(&c\2', body)
+
+def gen_cases(ops, names):
+    out = []
+    w = out.append
+    for op in range(256):
+        bodies = ops[op]
+        n = 0
+        while n < 8 and 'assert(false)' not in bodies[n]:
+            n += 1
+        w('        /* %s */' % names[op])
+        w('        case 0x%02X:' % op)
+        # labels needed for skip targets and JAM loops
+        labels = set()
+        for k in range(n):
+            if 'c->IR+=' in bodies[k]:
+                labels.add(k + 2)
+            if 'c->IR--' in bodies[k]:
+                labels.add(k)
+        for k in range(n):
+            b = bodies[k]
+            lbl = ('_%02X_%d: ' % (op, k)) if k in labels else ''
+            if 'c->IR+=' in b:
+                m = re.match(r'(.*)c->IR\+=(.*);$', b)
+                assert m, b
+                w('            %s%s_T();if(%s){goto _%02X_%d;}' % (lbl, conv(m.group(1)), conv(m.group(2)), op, k + 2))
+            elif 'c->IR--' in b:
+                pre = conv(b.replace('c->IR--;', ''))
+                w('            %s%s_T();if(ticks<num_ticks){goto _%02X_%d;}c.IR=(0x%02X<<3)|%d;goto _exit;' % (lbl, pre, op, k, op, k))
+            elif '_FETCH()' in b:
+                if k == n - 1:
+                    w('            %s%s_T();break;' % (lbl, conv(b)))
+                else:
+                    w('            %s%s_T();if(pins&M6502_SYNC){break;}' % (lbl, conv(b)))
+            else:
+                w('            %s%s_T();' % (lbl, conv(b)))
+        assert '_FETCH()' in bodies[n - 1] or 'c->IR--' in bodies[n - 1], (op, bodies[n - 1])
+    return '\n'.join(out) + '\n'
+
+if __name__ == '__main__':
+    ops, names = parse(open(sys.argv[1]).read())
+    sys.stdout.write(HEADER + gen_cases(ops, names) + FOOTER)
@@ -0,0 +1,323 @@
+#pragma once
+/*
+    hostio.h - Paravirtual host file access for docker-c64.
+
+    A device in the expansion port IO1 area (--hostio=DIR) which lets
+    programs running in the emulator open, read, write and seek files in
+    one host directory. Data is copied with a single read()/write() call
+    straight between the file and the 64 KB RAM of the C64, every command
+    completes within the CPU write cycle that issues it.
+
+    Register ABI, the 16 registers are mirrored through DE00..DEFF:
+
+      DE00  W   COMMAND  write a HOSTIO_CMD_* value to run the command
+            R   STATUS   HOSTIO_STATUS_* result of the last command
+      DE01  RW  CHANNEL  file channel 0..7 the command works on
+      DE02  RW  MODE     OPEN: HOSTIO_OPEN_*, SEEK: HOSTIO_SEEK_*
+      DE03  R   ERROR    host errno of the last HOSTIO_STATUS_HOST_ERROR
+      DE04  RW  ADDR lo  C64 address of the file name (OPEN) or the
+      DE05  RW  ADDR hi  data (READ, WRITE), advanced by the bytes copied
+      DE06  RW  LEN lo   length of the file name (OPEN) or the number of
+      DE07  RW  LEN hi   bytes to copy, the bytes copied after READ/WRITE
+      DE08  RW  POS      32-bit little-endian file position, the offset
+      ...                for SEEK (signed for SEEK_CUR/SEEK_END), the new
+      DE0B               position after SEEK, READ and WRITE, the file
+                         size after SIZE
+      DE0C  R   0
+      DE0D  R   0
+      DE0E  R   ID       'H' (0x48)
+      DE0F  R   ID       'I' (0x49)
+
+    Commands:
+
+      OPEN   open the file named by ADDR/LEN on CHANNEL, a file still
+             open on that channel is closed first
+      CLOSE  close CHANNEL
+      READ   read up to LEN bytes into ADDR, STATUS is HOSTIO_STATUS_EOF
+             if the end of the file was reached before LEN bytes
+      WRITE  write LEN bytes from ADDR
+      SEEK   move the file position by POS relative to MODE
+      SIZE   get the file size into POS
+
+    Transfers always access the RAM, independent of the ROM and I/O
+    banking, and wrap around from FFFF to 0000. File names are PETSCII,
+    unshifted letters (41..5A) become lowercase and shifted letters
+    (C1..DA) uppercase, ASCII lowercase letters are taken as they are.
+    Only letters, digits and . _ - + are allowed and a name must not
+    start with a dot, so a program can't leave the directory.
+
+    hostio.s has a small client library for 6502 programs.
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define HOSTIO_NUM_CHANNELS (8)
+#define HOSTIO_MAX_NAME (64)
+#define HOSTIO_NUM_REGS (16)
+
+// register offsets
+#define HOSTIO_REG_CMD      (0x00)  // write: command, read: status
+#define HOSTIO_REG_CHANNEL  (0x01)
+#define HOSTIO_REG_MODE     (0x02)
+#define HOSTIO_REG_ERROR    (0x03)
+#define HOSTIO_REG_ADDR     (0x04)  // 2 bytes
+#define HOSTIO_REG_LEN      (0x06)  // 2 bytes
+#define HOSTIO_REG_POS      (0x08)  // 4 bytes
+#define HOSTIO_REG_ID       (0x0E)  // 2 bytes
+
+// commands
+#define HOSTIO_CMD_OPEN     (0x01)
+#define HOSTIO_CMD_CLOSE    (0x02)
+#define HOSTIO_CMD_READ     (0x03)
+#define HOSTIO_CMD_WRITE    (0x04)
+#define HOSTIO_CMD_SEEK     (0x05)
+#define HOSTIO_CMD_SIZE     (0x06)
+
+// status values
+#define HOSTIO_STATUS_OK            (0x00)
+#define HOSTIO_STATUS_EOF           (0x01)  // READ stopped at the end of the file
+#define HOSTIO_STATUS_NOT_OPEN      (0x02)  // bad channel or no file open on it
+#define HOSTIO_STATUS_BAD_NAME      (0x03)
+#define HOSTIO_STATUS_HOST_ERROR    (0x04)  // ERROR holds the host errno
+#define HOSTIO_STATUS_BAD_COMMAND   (0x05)
+
+// OPEN modes
+#define HOSTIO_OPEN_READ    (0x00)
+#define HOSTIO_OPEN_WRITE   (0x01)  // create or truncate
+#define HOSTIO_OPEN_APPEND  (0x02)  // create, writes go to the end
+#define HOSTIO_OPEN_UPDATE  (0x03)  // read and write, create if missing
+
+// SEEK modes
+#define HOSTIO_SEEK_SET     (0x00)
+#define HOSTIO_SEEK_CUR     (0x01)
+#define HOSTIO_SEEK_END     (0x02)
+
+typedef struct {
+    const char *dir;    // host directory, NULL when the device is off
+    c64_t *sys;         // the C64 whose RAM is accessed
+    int fd[HOSTIO_NUM_CHANNELS];    // -1 for closed channels
+    uint8_t reg[HOSTIO_NUM_REGS];   // register file, reg[0] is the status
+    // statistics
+    long long bytes_read;       // bytes copied from files into C64 RAM
+    long long bytes_written;    // bytes copied from C64 RAM into files
+} hostio_t;
+
+static uint16_t _hostio_reg16(const hostio_t *io, int reg) {
+    return io->reg[reg] | (io->reg[reg + 1] << 8);
+}
+
+static void _hostio_set_reg16(hostio_t *io, int reg, uint16_t val) {
+    io->reg[reg] = val & 0xFF;
+    io->reg[reg + 1] = val >> 8;
+}
+
+static void _hostio_set_pos(hostio_t *io, off_t pos) {
+    for (int i = 0; i < 4; i++) {
+        io->reg[HOSTIO_REG_POS + i] = (uint8_t)(pos >> (i * 8));
+    }
+}
+
+static uint8_t _hostio_host_error(hostio_t *io) {
+    io->reg[HOSTIO_REG_ERROR] = (uint8_t)errno;
+    return HOSTIO_STATUS_HOST_ERROR;
+}
+
+/* convert a PETSCII file name to the host path, false if the name is not allowed */
+static bool _hostio_path(const hostio_t *io, char *path, size_t path_size) {
+    const uint16_t addr = _hostio_reg16(io, HOSTIO_REG_ADDR);
+    const uint16_t len = _hostio_reg16(io, HOSTIO_REG_LEN);
+    if ((len == 0) || (len > HOSTIO_MAX_NAME)) {
+        return false;
+    }
+    char name[HOSTIO_MAX_NAME + 1];
+    for (uint16_t i = 0; i < len; i++) {
+        uint8_t c = io->sys->ram[(uint16_t)(addr + i)];
+        if ((c >= 0x41) && (c <= 0x5A)) {
+            c += 0x20;
+        }
+        else if ((c >= 0xC1) && (c <= 0xDA)) {
+            c -= 0x80;
+        }
+        const bool valid = ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
+                           ((c >= '0') && (c <= '9')) || (c == '.') || (c == '_') || (c == '-') || (c == '+');
+        if (!valid || ((i == 0) && (c == '.'))) {
+            return false;
+        }
+        name[i] = (char)c;
+    }
+    name[len] = 0;
+    return snprintf(path, path_size, "%s/%s", io->dir, name) < (int)path_size;
+}
+
+/* copy between a file and C64 RAM in at most two pieces (the range may wrap around at FFFF) */
+static uint8_t _hostio_transfer(hostio_t *io, int fd, bool to_ram) {
+    const uint16_t addr = _hostio_reg16(io, HOSTIO_REG_ADDR);
+    const uint32_t len = _hostio_reg16(io, HOSTIO_REG_LEN);
+    uint8_t status = HOSTIO_STATUS_OK;
+    uint32_t done = 0;
+    while (done < len) {
+        const uint16_t pos = (uint16_t)(addr + done);
+        uint32_t chunk = len - done;
+        if (chunk > (uint32_t)(0x10000 - pos)) {
+            chunk = (uint32_t)(0x10000 - pos);
+        }
+        ssize_t n = to_ram ? read(fd, &io->sys->ram[pos], chunk) : write(fd, &io->sys->ram[pos], chunk);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            status = _hostio_host_error(io);
+            break;
+        }
+        if (n == 0) {
+            status = to_ram ? HOSTIO_STATUS_EOF : _hostio_host_error(io);
+            break;
+        }
+        done += (uint32_t)n;
+    }
+    if (to_ram) {
+        c64_ram_modified(io->sys, addr, done);
+        io->bytes_read += done;
+    }
+    else {
+        io->bytes_written += done;
+    }
+    _hostio_set_reg16(io, HOSTIO_REG_ADDR, (uint16_t)(addr + done));
+    _hostio_set_reg16(io, HOSTIO_REG_LEN, (uint16_t)done);
+    const off_t file_pos = lseek(fd, 0, SEEK_CUR);
+    if (file_pos >= 0) {
+        _hostio_set_pos(io, file_pos);
+    }
+    return status;
+}
+
+static uint8_t _hostio_command(hostio_t *io, uint8_t cmd) {
+    const uint8_t ch = io->reg[HOSTIO_REG_CHANNEL];
+    if (ch >= HOSTIO_NUM_CHANNELS) {
+        return HOSTIO_STATUS_NOT_OPEN;
+    }
+    const uint8_t mode = io->reg[HOSTIO_REG_MODE];
+    if (cmd == HOSTIO_CMD_OPEN) {
+        char path[4096];
+        if (!_hostio_path(io, path, sizeof(path))) {
+            return HOSTIO_STATUS_BAD_NAME;
+        }
+        static const int flags[4] = {
+            O_RDONLY, O_WRONLY|O_CREAT|O_TRUNC, O_WRONLY|O_CREAT|O_APPEND, O_RDWR|O_CREAT
+        };
+        if (mode > HOSTIO_OPEN_UPDATE) {
+            return HOSTIO_STATUS_BAD_COMMAND;
+        }
+        if (io->fd[ch] != -1) {
+            close(io->fd[ch]);
+        }
+        io->fd[ch] = open(path, flags[mode], 0644);
+        if (io->fd[ch] == -1) {
+            return _hostio_host_error(io);
+        }
+        _hostio_set_pos(io, 0);
+        return HOSTIO_STATUS_OK;
+    }
+    const int fd = io->fd[ch];
+    if (fd == -1) {
+        return HOSTIO_STATUS_NOT_OPEN;
+    }
+    switch (cmd) {
+        case HOSTIO_CMD_CLOSE:
+            io->fd[ch] = -1;
+            return (close(fd) == 0) ? HOSTIO_STATUS_OK : _hostio_host_error(io);
+        case HOSTIO_CMD_READ:
+            return _hostio_transfer(io, fd, true);
+        case HOSTIO_CMD_WRITE:
+            return _hostio_transfer(io, fd, false);
+        case HOSTIO_CMD_SEEK: {
+            static const int whence[3] = { SEEK_SET, SEEK_CUR, SEEK_END };
+            if (mode > HOSTIO_SEEK_END) {
+                return HOSTIO_STATUS_BAD_COMMAND;
+            }
+            // the offset is unsigned from the start, signed otherwise
+            const uint32_t val = io->reg[HOSTIO_REG_POS] | (io->reg[HOSTIO_REG_POS + 1] << 8) |
+                                 (io->reg[HOSTIO_REG_POS + 2] << 16) | ((uint32_t)io->reg[HOSTIO_REG_POS + 3] << 24);
+            const off_t offset = (mode == HOSTIO_SEEK_SET) ? (off_t)val : (off_t)(int32_t)val;
+            const off_t pos = lseek(fd, offset, whence[mode]);
+            if (pos < 0) {
+                return _hostio_host_error(io);
+            }
+            _hostio_set_pos(io, pos);
+            return HOSTIO_STATUS_OK;
+        }
+        case HOSTIO_CMD_SIZE: {
+            struct stat sb;
+            if (fstat(fd, &sb) == -1) {
+                return _hostio_host_error(io);
+            }
+            _hostio_set_pos(io, sb.st_size);
+            return HOSTIO_STATUS_OK;
+        }
+        default:
+            return HOSTIO_STATUS_BAD_COMMAND;
+    }
+}
+
+/* enable the device for the given host directory */
+static bool hostio_open(hostio_t *io, const char *dir, c64_t *sys) {
+    memset(io, 0, sizeof(*io));
+    for (int i = 0; i < HOSTIO_NUM_CHANNELS; i++) {
+        io->fd[i] = -1;
+    }
+    struct stat sb;
+    if ((stat(dir, &sb) == -1) || !S_ISDIR(sb.st_mode)) {
+        fprintf(stderr, "Invalid host I/O directory: %s\n", dir);
+        return false;
+    }
+    io->dir = dir;
+    io->sys = sys;
+    io->reg[HOSTIO_REG_ID] = 'H';
+    io->reg[HOSTIO_REG_ID + 1] = 'I';
+    return true;
+}
+
+/* c64_io_callback_t, called by the emulation with user_data = hostio_t* */
+static uint8_t hostio_access(uint16_t addr, bool rw, uint8_t data, void *user_data) {
+    hostio_t *io = (hostio_t *)user_data;
+    const int reg = addr & (HOSTIO_NUM_REGS - 1);
+    if (rw) {
+        return io->reg[reg];
+    }
+    switch (reg) {
+        case HOSTIO_REG_CMD:
+            io->reg[HOSTIO_REG_CMD] = _hostio_command(io, data);
+            break;
+        case HOSTIO_REG_ERROR:
+        case 0x0C:
+        case 0x0D:
+        case HOSTIO_REG_ID:
+        case HOSTIO_REG_ID + 1:
+            // read-only
+            break;
+        default:
+            io->reg[reg] = data;
+            break;
+    }
+    return data;
+}
+
+/* close all files still open by the guest */
+static void hostio_close(hostio_t *io) {
+    if (!io->dir) {
+        return;
+    }
+    for (int i = 0; i < HOSTIO_NUM_CHANNELS; i++) {
+        if (io->fd[i] != -1) {
+            close(io->fd[i]);
+            io->fd[i] = -1;
+        }
+    }
+    io->dir = NULL;
+}
@@ -0,0 +1,139 @@
+;
+;   hostio.s - 6502 client library for the docker-c64 host I/O device
+;
+;   ca65 syntax, the register ABI is described in hostio.h. Start the
+;   emulator with --hostio=DIR. Every routine returns the device status
+;   in A with the Z flag set when the command succeeded, X and Y are
+;   preserved.
+;
+;   Loading a whole file to $2000:
+;
+;       ldx #<name
+;       ldy #>name
+;       lda #name_end-name
+;       jsr hio_name
+;       lda #HIO_OPEN_READ
+;       ldx #0              ; channel 0
+;       jsr hio_open
+;       bne error
+;       ldx #<$2000
+;       ldy #>$2000
+;       jsr hio_addr
+;       ldx #<$A000         ; up to 40 KB in a single command
+;       ldy #>$A000
+;       jsr hio_len
+;       ldx #0
+;       jsr hio_read        ; HIO_STATUS_EOF when the file is shorter
+;       jsr hio_close
+;       ...
+;   name:   .byte "DATA.BIN"
+;   name_end:
+;
+
+HIO_BASE        = $DE00
+HIO_STATUS      = HIO_BASE+$00  ; read
+HIO_COMMAND     = HIO_BASE+$00  ; write
+HIO_CHANNEL     = HIO_BASE+$01
+HIO_MODE        = HIO_BASE+$02
+HIO_ERROR       = HIO_BASE+$03  ; host errno after HIO_STATUS_HOST_ERROR
+HIO_ADDR        = HIO_BASE+$04  ; 16 bit, advanced by READ and WRITE
+HIO_LEN         = HIO_BASE+$06  ; 16 bit, bytes copied after READ and WRITE
+HIO_POS         = HIO_BASE+$08  ; 32 bit file position
+HIO_ID          = HIO_BASE+$0E  ; "HI"
+
+HIO_CMD_OPEN    = $01
+HIO_CMD_CLOSE   = $02
+HIO_CMD_READ    = $03
+HIO_CMD_WRITE   = $04
+HIO_CMD_SEEK    = $05
+HIO_CMD_SIZE    = $06
+
+HIO_STATUS_OK           = $00
+HIO_STATUS_EOF          = $01
+HIO_STATUS_NOT_OPEN     = $02
+HIO_STATUS_BAD_NAME     = $03
+HIO_STATUS_HOST_ERROR   = $04
+HIO_STATUS_BAD_COMMAND  = $05
+
+HIO_OPEN_READ   = $00
+HIO_OPEN_WRITE  = $01
+HIO_OPEN_APPEND = $02
+HIO_OPEN_UPDATE = $03
+
+HIO_SEEK_SET    = $00
+HIO_SEEK_CUR    = $01
+HIO_SEEK_END    = $02
+
+        .export hio_detect, hio_name, hio_addr, hio_len
+        .export hio_open, hio_close, hio_read, hio_write, hio_seek, hio_size
+
+; carry clear if the device is present
+hio_detect:
+        lda HIO_ID
+        cmp #'H'
+        bne @none
+        lda HIO_ID+1
+        cmp #'I'
+        bne @none
+        clc
+        rts
+@none:  sec
+        rts
+
+; file name for hio_open at X/Y (lo/hi), length in A
+hio_name:
+        sta HIO_LEN
+        lda #0
+        sta HIO_LEN+1
+        ; fall through
+
+; transfer address X/Y (lo/hi) for hio_read and hio_write
+hio_addr:
+        stx HIO_ADDR
+        sty HIO_ADDR+1
+        rts
+
+; transfer length X/Y (lo/hi) for hio_read and hio_write
+hio_len:
+        stx HIO_LEN
+        sty HIO_LEN+1
+        rts
+
+; open the file set with hio_name on channel X, mode HIO_OPEN_* in A
+hio_open:
+        sta HIO_MODE
+        lda #HIO_CMD_OPEN
+        bne hio_cmd
+
+; close channel X
+hio_close:
+        lda #HIO_CMD_CLOSE
+        bne hio_cmd
+
+; read HIO_LEN bytes from channel X to HIO_ADDR
+hio_read:
+        lda #HIO_CMD_READ
+        bne hio_cmd
+
+; write HIO_LEN bytes from HIO_ADDR to channel X
+hio_write:
+        lda #HIO_CMD_WRITE
+        bne hio_cmd
+
+; move the position of channel X by HIO_POS, HIO_SEEK_* in A
+hio_seek:
+        sta HIO_MODE
+        lda #HIO_CMD_SEEK
+        bne hio_cmd
+
+; size of the file on channel X into HIO_POS
+hio_size:
+        lda #HIO_CMD_SIZE
+        ; fall through
+
+; run command A on channel X
+hio_cmd:
+        stx HIO_CHANNEL
+        sta HIO_COMMAND
+        lda HIO_STATUS
+        rts
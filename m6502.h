@@ -7,7 +7,12 @@
     Project repo: https://github.com/floooh/chips/
 
     NOTE: this file is code-generated from m6502.template.h and m6502_gen.py
-    in the 'codegen' directory.
+    in the 'codegen' directory of the chips project. The copy in this repo
+    has local changes (the _M6502_LABEL() markers for M6502_COMPUTED_GOTO,
+    m6502_exec() and exec_break) which are maintained by hand. The
+    m6502_exec() decoder in _m6502_decoder.h is generated from m6502_tick()
+    with codegen/m6502_exec_gen.py in this repo, rerun it after changing
+    an instruction in m6502_tick().
 
     Do this:
     ~~~C
@@ -21,6 +26,16 @@
     CHIPS_ASSERT(c)
     ~~~
 
+    Optionally define the following macro to select how m6502_tick()
+    dispatches to the current instruction cycle:
+    ~~~C
+    M6502_COMPUTED_GOTO
+    ~~~
+        1: jump through a table of label addresses (GCC and Clang only)
+        0: use a regular switch statement (default)
+    The computed goto dispatch has not measured faster than the switch
+    (compare both with the --bench-cpu option of c64.c), so it is opt-in.
+
     ## Emulated Pins
 
     ***********************************
@@ -166,6 +181,24 @@
         is the current state of the CPU pins used to communicate with the
         outside world (see the Overview section above for details).
 
+    ~~~C
+    uint32_t m6502_exec(m6502_t* cpu, uint64_t* pins, uint32_t num_ticks, m6502_tick_t tick, void* user_data)
+    ~~~
+        Alternative to calling m6502_tick() in a loop: run the CPU for at
+        least num_ticks clock cycles and call the tick callback once per
+        cycle with the same pin mask m6502_tick() would have returned. The
+        callback performs the memory access and returns the modified pin
+        mask. m6502_exec() is instruction-stepped, it always returns at an
+        instruction boundary (except when the CPU is stuck in a JAM
+        instruction) and may thus run a few cycles more than requested,
+        the number of executed cycles is returned. 'pins' is the
+        in/out pin mask, as for m6502_tick(). The CPU state remains
+        compatible with m6502_tick(), so both functions may be mixed.
+        The tick callback may set cpu->exec_break to make m6502_exec()
+        return early at the next instruction boundary, for instance when
+        it sees the opcode fetch of a trapped address. The flag stays set
+        (and m6502_exec() returns immediately) until the caller clears it.
+
     ~~~C
     uint64_t m6510_iorq(m6502_t* cpu, uint64_t pins)
     ~~~
@@ -312,6 +345,8 @@ extern "C" {
 
 /* m6510 IO port callback prototypes */
 typedef void (*m6510_out_t)(uint8_t data, void* user_data);
+/* tick callback for m6502_exec(), performs the memory access for one clock cycle */
+typedef uint64_t (*m6502_tick_t)(uint64_t pins, void* user_data);
 typedef uint8_t (*m6510_in_t)(void* user_data);
 
 /* the desc structure provided to m6502_init() */
@@ -335,6 +370,7 @@ typedef struct {
     uint16_t nmi_pip;
     uint8_t brk_flags;  /* M6502_BRK_* */
     uint8_t bcd_enabled;
+    bool exec_break;    /* set in the m6502_exec() tick callback to return at the next instruction boundary */
     /* 6510 IO port state */
     void* user_data;
     m6510_in_t in_cb;
@@ -352,6 +388,8 @@ typedef struct {
 uint64_t m6502_init(m6502_t* cpu, const m6502_desc_t* desc);
 /* execute one tick */
 uint64_t m6502_tick(m6502_t* cpu, uint64_t pins);
+/* execute instructions for at least num_ticks, calling the tick callback once per cycle */
+uint32_t m6502_exec(m6502_t* cpu, uint64_t* pins, uint32_t num_ticks, m6502_tick_t tick, void* user_data);
 /* perform m6510 port IO (only call this if M6510_CHECK_IO(pins) is true) */
 uint64_t m6510_iorq(m6502_t* cpu, uint64_t pins);
 // prepare m6502_t snapshot for saving
@@ -402,6 +440,13 @@ uint16_t m6502_pc(m6502_t* cpu);
     #define CHIPS_ASSERT(c) assert(c)
 #endif
 
+#ifndef M6502_COMPUTED_GOTO
+    #define M6502_COMPUTED_GOTO (0)
+#endif
+#if M6502_COMPUTED_GOTO && !defined(__GNUC__)
+    #error "M6502_COMPUTED_GOTO requires GCC or Clang"
+#endif
+
 #if defined(__GNUC__)
 #define _M6502_UNREACHABLE __builtin_unreachable()
 #elif defined(_MSC_VER)
@@ -708,6 +753,16 @@ void m6502_snapshot_onload(m6502_t* snapshot, m6502_t* sys) {
 /* set N and Z flags depending on value */
 #define _NZ(v) c->P=((c->P&~(M6502_NF|M6502_ZF))|((v&0xFF)?(v&M6502_NF):M6502_ZF))
 
+/* computed-goto dispatch, each instruction cycle gets a label _m6502_<opcode>_<cycle> */
+#if M6502_COMPUTED_GOTO
+#define _M6502_LABEL(op,cycle) _m6502_##op##_##cycle:
+/* the jump table stores 32-bit offsets relative to the first label, this keeps it as compact as a switch table */
+#define _M6502_JUMP_OFS(op,cycle) (int32_t)(&&_m6502_##op##_##cycle - &&_m6502_0x00_0)
+#define _M6502_JUMP_TABLE_OP(op) _M6502_JUMP_OFS(op,0),_M6502_JUMP_OFS(op,1),_M6502_JUMP_OFS(op,2),_M6502_JUMP_OFS(op,3),_M6502_JUMP_OFS(op,4),_M6502_JUMP_OFS(op,5),_M6502_JUMP_OFS(op,6),_M6502_JUMP_OFS(op,7)
+#else
+#define _M6502_LABEL(op,cycle)
+#endif
+
 #if defined(_MSC_VER)
 #pragma warning(push)
 #pragma warning(disable:4244)   /* conversion from 'uint16_t' to 'uint8_t', possible loss of data */
@@ -775,2312 +830,2573 @@ uint64_t m6502_tick(m6502_t* c, uint64_t pins) {
     }
     // reads are default, writes are special
     _RD();
+    #if M6502_COMPUTED_GOTO
+    static const int32_t jump_table[2048] = {
+        _M6502_JUMP_TABLE_OP(0x00),
+        _M6502_JUMP_TABLE_OP(0x01),
+        _M6502_JUMP_TABLE_OP(0x02),
+        _M6502_JUMP_TABLE_OP(0x03),
+        _M6502_JUMP_TABLE_OP(0x04),
+        _M6502_JUMP_TABLE_OP(0x05),
+        _M6502_JUMP_TABLE_OP(0x06),
+        _M6502_JUMP_TABLE_OP(0x07),
+        _M6502_JUMP_TABLE_OP(0x08),
+        _M6502_JUMP_TABLE_OP(0x09),
+        _M6502_JUMP_TABLE_OP(0x0A),
+        _M6502_JUMP_TABLE_OP(0x0B),
+        _M6502_JUMP_TABLE_OP(0x0C),
+        _M6502_JUMP_TABLE_OP(0x0D),
+        _M6502_JUMP_TABLE_OP(0x0E),
+        _M6502_JUMP_TABLE_OP(0x0F),
+        _M6502_JUMP_TABLE_OP(0x10),
+        _M6502_JUMP_TABLE_OP(0x11),
+        _M6502_JUMP_TABLE_OP(0x12),
+        _M6502_JUMP_TABLE_OP(0x13),
+        _M6502_JUMP_TABLE_OP(0x14),
+        _M6502_JUMP_TABLE_OP(0x15),
+        _M6502_JUMP_TABLE_OP(0x16),
+        _M6502_JUMP_TABLE_OP(0x17),
+        _M6502_JUMP_TABLE_OP(0x18),
+        _M6502_JUMP_TABLE_OP(0x19),
+        _M6502_JUMP_TABLE_OP(0x1A),
+        _M6502_JUMP_TABLE_OP(0x1B),
+        _M6502_JUMP_TABLE_OP(0x1C),
+        _M6502_JUMP_TABLE_OP(0x1D),
+        _M6502_JUMP_TABLE_OP(0x1E),
+        _M6502_JUMP_TABLE_OP(0x1F),
+        _M6502_JUMP_TABLE_OP(0x20),
+        _M6502_JUMP_TABLE_OP(0x21),
+        _M6502_JUMP_TABLE_OP(0x22),
+        _M6502_JUMP_TABLE_OP(0x23),
+        _M6502_JUMP_TABLE_OP(0x24),
+        _M6502_JUMP_TABLE_OP(0x25),
+        _M6502_JUMP_TABLE_OP(0x26),
+        _M6502_JUMP_TABLE_OP(0x27),
+        _M6502_JUMP_TABLE_OP(0x28),
+        _M6502_JUMP_TABLE_OP(0x29),
+        _M6502_JUMP_TABLE_OP(0x2A),
+        _M6502_JUMP_TABLE_OP(0x2B),
+        _M6502_JUMP_TABLE_OP(0x2C),
+        _M6502_JUMP_TABLE_OP(0x2D),
+        _M6502_JUMP_TABLE_OP(0x2E),
+        _M6502_JUMP_TABLE_OP(0x2F),
+        _M6502_JUMP_TABLE_OP(0x30),
+        _M6502_JUMP_TABLE_OP(0x31),
+        _M6502_JUMP_TABLE_OP(0x32),
+        _M6502_JUMP_TABLE_OP(0x33),
+        _M6502_JUMP_TABLE_OP(0x34),
+        _M6502_JUMP_TABLE_OP(0x35),
+        _M6502_JUMP_TABLE_OP(0x36),
+        _M6502_JUMP_TABLE_OP(0x37),
+        _M6502_JUMP_TABLE_OP(0x38),
+        _M6502_JUMP_TABLE_OP(0x39),
+        _M6502_JUMP_TABLE_OP(0x3A),
+        _M6502_JUMP_TABLE_OP(0x3B),
+        _M6502_JUMP_TABLE_OP(0x3C),
+        _M6502_JUMP_TABLE_OP(0x3D),
+        _M6502_JUMP_TABLE_OP(0x3E),
+        _M6502_JUMP_TABLE_OP(0x3F),
+        _M6502_JUMP_TABLE_OP(0x40),
+        _M6502_JUMP_TABLE_OP(0x41),
+        _M6502_JUMP_TABLE_OP(0x42),
+        _M6502_JUMP_TABLE_OP(0x43),
+        _M6502_JUMP_TABLE_OP(0x44),
+        _M6502_JUMP_TABLE_OP(0x45),
+        _M6502_JUMP_TABLE_OP(0x46),
+        _M6502_JUMP_TABLE_OP(0x47),
+        _M6502_JUMP_TABLE_OP(0x48),
+        _M6502_JUMP_TABLE_OP(0x49),
+        _M6502_JUMP_TABLE_OP(0x4A),
+        _M6502_JUMP_TABLE_OP(0x4B),
+        _M6502_JUMP_TABLE_OP(0x4C),
+        _M6502_JUMP_TABLE_OP(0x4D),
+        _M6502_JUMP_TABLE_OP(0x4E),
+        _M6502_JUMP_TABLE_OP(0x4F),
+        _M6502_JUMP_TABLE_OP(0x50),
+        _M6502_JUMP_TABLE_OP(0x51),
+        _M6502_JUMP_TABLE_OP(0x52),
+        _M6502_JUMP_TABLE_OP(0x53),
+        _M6502_JUMP_TABLE_OP(0x54),
+        _M6502_JUMP_TABLE_OP(0x55),
+        _M6502_JUMP_TABLE_OP(0x56),
+        _M6502_JUMP_TABLE_OP(0x57),
+        _M6502_JUMP_TABLE_OP(0x58),
+        _M6502_JUMP_TABLE_OP(0x59),
+        _M6502_JUMP_TABLE_OP(0x5A),
+        _M6502_JUMP_TABLE_OP(0x5B),
+        _M6502_JUMP_TABLE_OP(0x5C),
+        _M6502_JUMP_TABLE_OP(0x5D),
+        _M6502_JUMP_TABLE_OP(0x5E),
+        _M6502_JUMP_TABLE_OP(0x5F),
+        _M6502_JUMP_TABLE_OP(0x60),
+        _M6502_JUMP_TABLE_OP(0x61),
+        _M6502_JUMP_TABLE_OP(0x62),
+        _M6502_JUMP_TABLE_OP(0x63),
+        _M6502_JUMP_TABLE_OP(0x64),
+        _M6502_JUMP_TABLE_OP(0x65),
+        _M6502_JUMP_TABLE_OP(0x66),
+        _M6502_JUMP_TABLE_OP(0x67),
+        _M6502_JUMP_TABLE_OP(0x68),
+        _M6502_JUMP_TABLE_OP(0x69),
+        _M6502_JUMP_TABLE_OP(0x6A),
+        _M6502_JUMP_TABLE_OP(0x6B),
+        _M6502_JUMP_TABLE_OP(0x6C),
+        _M6502_JUMP_TABLE_OP(0x6D),
+        _M6502_JUMP_TABLE_OP(0x6E),
+        _M6502_JUMP_TABLE_OP(0x6F),
+        _M6502_JUMP_TABLE_OP(0x70),
+        _M6502_JUMP_TABLE_OP(0x71),
+        _M6502_JUMP_TABLE_OP(0x72),
+        _M6502_JUMP_TABLE_OP(0x73),
+        _M6502_JUMP_TABLE_OP(0x74),
+        _M6502_JUMP_TABLE_OP(0x75),
+        _M6502_JUMP_TABLE_OP(0x76),
+        _M6502_JUMP_TABLE_OP(0x77),
+        _M6502_JUMP_TABLE_OP(0x78),
+        _M6502_JUMP_TABLE_OP(0x79),
+        _M6502_JUMP_TABLE_OP(0x7A),
+        _M6502_JUMP_TABLE_OP(0x7B),
+        _M6502_JUMP_TABLE_OP(0x7C),
+        _M6502_JUMP_TABLE_OP(0x7D),
+        _M6502_JUMP_TABLE_OP(0x7E),
+        _M6502_JUMP_TABLE_OP(0x7F),
+        _M6502_JUMP_TABLE_OP(0x80),
+        _M6502_JUMP_TABLE_OP(0x81),
+        _M6502_JUMP_TABLE_OP(0x82),
+        _M6502_JUMP_TABLE_OP(0x83),
+        _M6502_JUMP_TABLE_OP(0x84),
+        _M6502_JUMP_TABLE_OP(0x85),
+        _M6502_JUMP_TABLE_OP(0x86),
+        _M6502_JUMP_TABLE_OP(0x87),
+        _M6502_JUMP_TABLE_OP(0x88),
+        _M6502_JUMP_TABLE_OP(0x89),
+        _M6502_JUMP_TABLE_OP(0x8A),
+        _M6502_JUMP_TABLE_OP(0x8B),
+        _M6502_JUMP_TABLE_OP(0x8C),
+        _M6502_JUMP_TABLE_OP(0x8D),
+        _M6502_JUMP_TABLE_OP(0x8E),
+        _M6502_JUMP_TABLE_OP(0x8F),
+        _M6502_JUMP_TABLE_OP(0x90),
+        _M6502_JUMP_TABLE_OP(0x91),
+        _M6502_JUMP_TABLE_OP(0x92),
+        _M6502_JUMP_TABLE_OP(0x93),
+        _M6502_JUMP_TABLE_OP(0x94),
+        _M6502_JUMP_TABLE_OP(0x95),
+        _M6502_JUMP_TABLE_OP(0x96),
+        _M6502_JUMP_TABLE_OP(0x97),
+        _M6502_JUMP_TABLE_OP(0x98),
+        _M6502_JUMP_TABLE_OP(0x99),
+        _M6502_JUMP_TABLE_OP(0x9A),
+        _M6502_JUMP_TABLE_OP(0x9B),
+        _M6502_JUMP_TABLE_OP(0x9C),
+        _M6502_JUMP_TABLE_OP(0x9D),
+        _M6502_JUMP_TABLE_OP(0x9E),
+        _M6502_JUMP_TABLE_OP(0x9F),
+        _M6502_JUMP_TABLE_OP(0xA0),
+        _M6502_JUMP_TABLE_OP(0xA1),
+        _M6502_JUMP_TABLE_OP(0xA2),
+        _M6502_JUMP_TABLE_OP(0xA3),
+        _M6502_JUMP_TABLE_OP(0xA4),
+        _M6502_JUMP_TABLE_OP(0xA5),
+        _M6502_JUMP_TABLE_OP(0xA6),
+        _M6502_JUMP_TABLE_OP(0xA7),
+        _M6502_JUMP_TABLE_OP(0xA8),
+        _M6502_JUMP_TABLE_OP(0xA9),
+        _M6502_JUMP_TABLE_OP(0xAA),
+        _M6502_JUMP_TABLE_OP(0xAB),
+        _M6502_JUMP_TABLE_OP(0xAC),
+        _M6502_JUMP_TABLE_OP(0xAD),
+        _M6502_JUMP_TABLE_OP(0xAE),
+        _M6502_JUMP_TABLE_OP(0xAF),
+        _M6502_JUMP_TABLE_OP(0xB0),
+        _M6502_JUMP_TABLE_OP(0xB1),
+        _M6502_JUMP_TABLE_OP(0xB2),
+        _M6502_JUMP_TABLE_OP(0xB3),
+        _M6502_JUMP_TABLE_OP(0xB4),
+        _M6502_JUMP_TABLE_OP(0xB5),
+        _M6502_JUMP_TABLE_OP(0xB6),
+        _M6502_JUMP_TABLE_OP(0xB7),
+        _M6502_JUMP_TABLE_OP(0xB8),
+        _M6502_JUMP_TABLE_OP(0xB9),
+        _M6502_JUMP_TABLE_OP(0xBA),
+        _M6502_JUMP_TABLE_OP(0xBB),
+        _M6502_JUMP_TABLE_OP(0xBC),
+        _M6502_JUMP_TABLE_OP(0xBD),
+        _M6502_JUMP_TABLE_OP(0xBE),
+        _M6502_JUMP_TABLE_OP(0xBF),
+        _M6502_JUMP_TABLE_OP(0xC0),
+        _M6502_JUMP_TABLE_OP(0xC1),
+        _M6502_JUMP_TABLE_OP(0xC2),
+        _M6502_JUMP_TABLE_OP(0xC3),
+        _M6502_JUMP_TABLE_OP(0xC4),
+        _M6502_JUMP_TABLE_OP(0xC5),
+        _M6502_JUMP_TABLE_OP(0xC6),
+        _M6502_JUMP_TABLE_OP(0xC7),
+        _M6502_JUMP_TABLE_OP(0xC8),
+        _M6502_JUMP_TABLE_OP(0xC9),
+        _M6502_JUMP_TABLE_OP(0xCA),
+        _M6502_JUMP_TABLE_OP(0xCB),
+        _M6502_JUMP_TABLE_OP(0xCC),
+        _M6502_JUMP_TABLE_OP(0xCD),
+        _M6502_JUMP_TABLE_OP(0xCE),
+        _M6502_JUMP_TABLE_OP(0xCF),
+        _M6502_JUMP_TABLE_OP(0xD0),
+        _M6502_JUMP_TABLE_OP(0xD1),
+        _M6502_JUMP_TABLE_OP(0xD2),
+        _M6502_JUMP_TABLE_OP(0xD3),
+        _M6502_JUMP_TABLE_OP(0xD4),
+        _M6502_JUMP_TABLE_OP(0xD5),
+        _M6502_JUMP_TABLE_OP(0xD6),
+        _M6502_JUMP_TABLE_OP(0xD7),
+        _M6502_JUMP_TABLE_OP(0xD8),
+        _M6502_JUMP_TABLE_OP(0xD9),
+        _M6502_JUMP_TABLE_OP(0xDA),
+        _M6502_JUMP_TABLE_OP(0xDB),
+        _M6502_JUMP_TABLE_OP(0xDC),
+        _M6502_JUMP_TABLE_OP(0xDD),
+        _M6502_JUMP_TABLE_OP(0xDE),
+        _M6502_JUMP_TABLE_OP(0xDF),
+        _M6502_JUMP_TABLE_OP(0xE0),
+        _M6502_JUMP_TABLE_OP(0xE1),
+        _M6502_JUMP_TABLE_OP(0xE2),
+        _M6502_JUMP_TABLE_OP(0xE3),
+        _M6502_JUMP_TABLE_OP(0xE4),
+        _M6502_JUMP_TABLE_OP(0xE5),
+        _M6502_JUMP_TABLE_OP(0xE6),
+        _M6502_JUMP_TABLE_OP(0xE7),
+        _M6502_JUMP_TABLE_OP(0xE8),
+        _M6502_JUMP_TABLE_OP(0xE9),
+        _M6502_JUMP_TABLE_OP(0xEA),
+        _M6502_JUMP_TABLE_OP(0xEB),
+        _M6502_JUMP_TABLE_OP(0xEC),
+        _M6502_JUMP_TABLE_OP(0xED),
+        _M6502_JUMP_TABLE_OP(0xEE),
+        _M6502_JUMP_TABLE_OP(0xEF),
+        _M6502_JUMP_TABLE_OP(0xF0),
+        _M6502_JUMP_TABLE_OP(0xF1),
+        _M6502_JUMP_TABLE_OP(0xF2),
+        _M6502_JUMP_TABLE_OP(0xF3),
+        _M6502_JUMP_TABLE_OP(0xF4),
+        _M6502_JUMP_TABLE_OP(0xF5),
+        _M6502_JUMP_TABLE_OP(0xF6),
+        _M6502_JUMP_TABLE_OP(0xF7),
+        _M6502_JUMP_TABLE_OP(0xF8),
+        _M6502_JUMP_TABLE_OP(0xF9),
+        _M6502_JUMP_TABLE_OP(0xFA),
+        _M6502_JUMP_TABLE_OP(0xFB),
+        _M6502_JUMP_TABLE_OP(0xFC),
+        _M6502_JUMP_TABLE_OP(0xFD),
+        _M6502_JUMP_TABLE_OP(0xFE),
+        _M6502_JUMP_TABLE_OP(0xFF),
+    };
+    goto *(&&_m6502_0x00_0 + jump_table[c->IR++]);
+    #endif
     switch (c->IR++) {
     // <% decoder
     /* BRK  */
-        case (0x00<<3)|0: _SA(c->PC);break;
-        case (0x00<<3)|1: if(0==(c->brk_flags&(M6502_BRK_IRQ|M6502_BRK_NMI))){c->PC++;}_SAD(0x0100|c->S--,c->PC>>8);if(0==(c->brk_flags&M6502_BRK_RESET)){_WR();}break;
-        case (0x00<<3)|2: _SAD(0x0100|c->S--,c->PC);if(0==(c->brk_flags&M6502_BRK_RESET)){_WR();}break;
-        case (0x00<<3)|3: _SAD(0x0100|c->S--,c->P|M6502_XF);if(c->brk_flags&M6502_BRK_RESET){c->AD=0xFFFC;}else{_WR();if(c->brk_flags&M6502_BRK_NMI){c->AD=0xFFFA;}else{c->AD=0xFFFE;}}break;
-        case (0x00<<3)|4: _SA(c->AD++);c->P|=(M6502_IF|M6502_BF);c->brk_flags=0; /* RES/NMI hijacking */break;
-        case (0x00<<3)|5: _SA(c->AD);c->AD=_GD(); /* NMI "half-hijacking" not possible */break;
-        case (0x00<<3)|6: c->PC=(_GD()<<8)|c->AD;_FETCH();break;
-        case (0x00<<3)|7: assert(false);break;
+        case (0x00<<3)|0: _M6502_LABEL(0x00,0) _SA(c->PC);break;
+        case (0x00<<3)|1: _M6502_LABEL(0x00,1) if(0==(c->brk_flags&(M6502_BRK_IRQ|M6502_BRK_NMI))){c->PC++;}_SAD(0x0100|c->S--,c->PC>>8);if(0==(c->brk_flags&M6502_BRK_RESET)){_WR();}break;
+        case (0x00<<3)|2: _M6502_LABEL(0x00,2) _SAD(0x0100|c->S--,c->PC);if(0==(c->brk_flags&M6502_BRK_RESET)){_WR();}break;
+        case (0x00<<3)|3: _M6502_LABEL(0x00,3) _SAD(0x0100|c->S--,c->P|M6502_XF);if(c->brk_flags&M6502_BRK_RESET){c->AD=0xFFFC;}else{_WR();if(c->brk_flags&M6502_BRK_NMI){c->AD=0xFFFA;}else{c->AD=0xFFFE;}}break;
+        case (0x00<<3)|4: _M6502_LABEL(0x00,4) _SA(c->AD++);c->P|=(M6502_IF|M6502_BF);c->brk_flags=0; /* RES/NMI hijacking */break;
+        case (0x00<<3)|5: _M6502_LABEL(0x00,5) _SA(c->AD);c->AD=_GD(); /* NMI "half-hijacking" not possible */break;
+        case (0x00<<3)|6: _M6502_LABEL(0x00,6) c->PC=(_GD()<<8)|c->AD;_FETCH();break;
+        case (0x00<<3)|7: _M6502_LABEL(0x00,7) assert(false);break;
     /* ORA (zp,X) */
-        case (0x01<<3)|0: _SA(c->PC++);break;
-        case (0x01<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x01<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0x01<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x01<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0x01<<3)|5: c->A|=_GD();_NZ(c->A);_FETCH();break;
-        case (0x01<<3)|6: assert(false);break;
-        case (0x01<<3)|7: assert(false);break;
+        case (0x01<<3)|0: _M6502_LABEL(0x01,0) _SA(c->PC++);break;
+        case (0x01<<3)|1: _M6502_LABEL(0x01,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x01<<3)|2: _M6502_LABEL(0x01,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0x01<<3)|3: _M6502_LABEL(0x01,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x01<<3)|4: _M6502_LABEL(0x01,4) _SA((_GD()<<8)|c->AD);break;
+        case (0x01<<3)|5: _M6502_LABEL(0x01,5) c->A|=_GD();_NZ(c->A);_FETCH();break;
+        case (0x01<<3)|6: _M6502_LABEL(0x01,6) assert(false);break;
+        case (0x01<<3)|7: _M6502_LABEL(0x01,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0x02<<3)|0: _SA(c->PC);break;
-        case (0x02<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0x02<<3)|2: assert(false);break;
-        case (0x02<<3)|3: assert(false);break;
-        case (0x02<<3)|4: assert(false);break;
-        case (0x02<<3)|5: assert(false);break;
-        case (0x02<<3)|6: assert(false);break;
-        case (0x02<<3)|7: assert(false);break;
+        case (0x02<<3)|0: _M6502_LABEL(0x02,0) _SA(c->PC);break;
+        case (0x02<<3)|1: _M6502_LABEL(0x02,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0x02<<3)|2: _M6502_LABEL(0x02,2) assert(false);break;
+        case (0x02<<3)|3: _M6502_LABEL(0x02,3) assert(false);break;
+        case (0x02<<3)|4: _M6502_LABEL(0x02,4) assert(false);break;
+        case (0x02<<3)|5: _M6502_LABEL(0x02,5) assert(false);break;
+        case (0x02<<3)|6: _M6502_LABEL(0x02,6) assert(false);break;
+        case (0x02<<3)|7: _M6502_LABEL(0x02,7) assert(false);break;
     /* SLO (zp,X) (undoc) */
-        case (0x03<<3)|0: _SA(c->PC++);break;
-        case (0x03<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x03<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0x03<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x03<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0x03<<3)|5: c->AD=_GD();_WR();break;
-        case (0x03<<3)|6: c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
-        case (0x03<<3)|7: _FETCH();break;
+        case (0x03<<3)|0: _M6502_LABEL(0x03,0) _SA(c->PC++);break;
+        case (0x03<<3)|1: _M6502_LABEL(0x03,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x03<<3)|2: _M6502_LABEL(0x03,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0x03<<3)|3: _M6502_LABEL(0x03,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x03<<3)|4: _M6502_LABEL(0x03,4) _SA((_GD()<<8)|c->AD);break;
+        case (0x03<<3)|5: _M6502_LABEL(0x03,5) c->AD=_GD();_WR();break;
+        case (0x03<<3)|6: _M6502_LABEL(0x03,6) c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
+        case (0x03<<3)|7: _M6502_LABEL(0x03,7) _FETCH();break;
     /* NOP zp (undoc) */
-        case (0x04<<3)|0: _SA(c->PC++);break;
-        case (0x04<<3)|1: _SA(_GD());break;
-        case (0x04<<3)|2: _FETCH();break;
-        case (0x04<<3)|3: assert(false);break;
-        case (0x04<<3)|4: assert(false);break;
-        case (0x04<<3)|5: assert(false);break;
-        case (0x04<<3)|6: assert(false);break;
-        case (0x04<<3)|7: assert(false);break;
+        case (0x04<<3)|0: _M6502_LABEL(0x04,0) _SA(c->PC++);break;
+        case (0x04<<3)|1: _M6502_LABEL(0x04,1) _SA(_GD());break;
+        case (0x04<<3)|2: _M6502_LABEL(0x04,2) _FETCH();break;
+        case (0x04<<3)|3: _M6502_LABEL(0x04,3) assert(false);break;
+        case (0x04<<3)|4: _M6502_LABEL(0x04,4) assert(false);break;
+        case (0x04<<3)|5: _M6502_LABEL(0x04,5) assert(false);break;
+        case (0x04<<3)|6: _M6502_LABEL(0x04,6) assert(false);break;
+        case (0x04<<3)|7: _M6502_LABEL(0x04,7) assert(false);break;
     /* ORA zp */
-        case (0x05<<3)|0: _SA(c->PC++);break;
-        case (0x05<<3)|1: _SA(_GD());break;
-        case (0x05<<3)|2: c->A|=_GD();_NZ(c->A);_FETCH();break;
-        case (0x05<<3)|3: assert(false);break;
-        case (0x05<<3)|4: assert(false);break;
-        case (0x05<<3)|5: assert(false);break;
-        case (0x05<<3)|6: assert(false);break;
-        case (0x05<<3)|7: assert(false);break;
+        case (0x05<<3)|0: _M6502_LABEL(0x05,0) _SA(c->PC++);break;
+        case (0x05<<3)|1: _M6502_LABEL(0x05,1) _SA(_GD());break;
+        case (0x05<<3)|2: _M6502_LABEL(0x05,2) c->A|=_GD();_NZ(c->A);_FETCH();break;
+        case (0x05<<3)|3: _M6502_LABEL(0x05,3) assert(false);break;
+        case (0x05<<3)|4: _M6502_LABEL(0x05,4) assert(false);break;
+        case (0x05<<3)|5: _M6502_LABEL(0x05,5) assert(false);break;
+        case (0x05<<3)|6: _M6502_LABEL(0x05,6) assert(false);break;
+        case (0x05<<3)|7: _M6502_LABEL(0x05,7) assert(false);break;
     /* ASL zp */
-        case (0x06<<3)|0: _SA(c->PC++);break;
-        case (0x06<<3)|1: _SA(_GD());break;
-        case (0x06<<3)|2: c->AD=_GD();_WR();break;
-        case (0x06<<3)|3: _SD(_m6502_asl(c,c->AD));_WR();break;
-        case (0x06<<3)|4: _FETCH();break;
-        case (0x06<<3)|5: assert(false);break;
-        case (0x06<<3)|6: assert(false);break;
-        case (0x06<<3)|7: assert(false);break;
+        case (0x06<<3)|0: _M6502_LABEL(0x06,0) _SA(c->PC++);break;
+        case (0x06<<3)|1: _M6502_LABEL(0x06,1) _SA(_GD());break;
+        case (0x06<<3)|2: _M6502_LABEL(0x06,2) c->AD=_GD();_WR();break;
+        case (0x06<<3)|3: _M6502_LABEL(0x06,3) _SD(_m6502_asl(c,c->AD));_WR();break;
+        case (0x06<<3)|4: _M6502_LABEL(0x06,4) _FETCH();break;
+        case (0x06<<3)|5: _M6502_LABEL(0x06,5) assert(false);break;
+        case (0x06<<3)|6: _M6502_LABEL(0x06,6) assert(false);break;
+        case (0x06<<3)|7: _M6502_LABEL(0x06,7) assert(false);break;
     /* SLO zp (undoc) */
-        case (0x07<<3)|0: _SA(c->PC++);break;
-        case (0x07<<3)|1: _SA(_GD());break;
-        case (0x07<<3)|2: c->AD=_GD();_WR();break;
-        case (0x07<<3)|3: c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
-        case (0x07<<3)|4: _FETCH();break;
-        case (0x07<<3)|5: assert(false);break;
-        case (0x07<<3)|6: assert(false);break;
-        case (0x07<<3)|7: assert(false);break;
+        case (0x07<<3)|0: _M6502_LABEL(0x07,0) _SA(c->PC++);break;
+        case (0x07<<3)|1: _M6502_LABEL(0x07,1) _SA(_GD());break;
+        case (0x07<<3)|2: _M6502_LABEL(0x07,2) c->AD=_GD();_WR();break;
+        case (0x07<<3)|3: _M6502_LABEL(0x07,3) c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
+        case (0x07<<3)|4: _M6502_LABEL(0x07,4) _FETCH();break;
+        case (0x07<<3)|5: _M6502_LABEL(0x07,5) assert(false);break;
+        case (0x07<<3)|6: _M6502_LABEL(0x07,6) assert(false);break;
+        case (0x07<<3)|7: _M6502_LABEL(0x07,7) assert(false);break;
     /* PHP  */
-        case (0x08<<3)|0: _SA(c->PC);break;
-        case (0x08<<3)|1: _SAD(0x0100|c->S--,c->P|M6502_XF);_WR();break;
-        case (0x08<<3)|2: _FETCH();break;
-        case (0x08<<3)|3: assert(false);break;
-        case (0x08<<3)|4: assert(false);break;
-        case (0x08<<3)|5: assert(false);break;
-        case (0x08<<3)|6: assert(false);break;
-        case (0x08<<3)|7: assert(false);break;
+        case (0x08<<3)|0: _M6502_LABEL(0x08,0) _SA(c->PC);break;
+        case (0x08<<3)|1: _M6502_LABEL(0x08,1) _SAD(0x0100|c->S--,c->P|M6502_XF);_WR();break;
+        case (0x08<<3)|2: _M6502_LABEL(0x08,2) _FETCH();break;
+        case (0x08<<3)|3: _M6502_LABEL(0x08,3) assert(false);break;
+        case (0x08<<3)|4: _M6502_LABEL(0x08,4) assert(false);break;
+        case (0x08<<3)|5: _M6502_LABEL(0x08,5) assert(false);break;
+        case (0x08<<3)|6: _M6502_LABEL(0x08,6) assert(false);break;
+        case (0x08<<3)|7: _M6502_LABEL(0x08,7) assert(false);break;
     /* ORA # */
-        case (0x09<<3)|0: _SA(c->PC++);break;
-        case (0x09<<3)|1: c->A|=_GD();_NZ(c->A);_FETCH();break;
-        case (0x09<<3)|2: assert(false);break;
-        case (0x09<<3)|3: assert(false);break;
-        case (0x09<<3)|4: assert(false);break;
-        case (0x09<<3)|5: assert(false);break;
-        case (0x09<<3)|6: assert(false);break;
-        case (0x09<<3)|7: assert(false);break;
+        case (0x09<<3)|0: _M6502_LABEL(0x09,0) _SA(c->PC++);break;
+        case (0x09<<3)|1: _M6502_LABEL(0x09,1) c->A|=_GD();_NZ(c->A);_FETCH();break;
+        case (0x09<<3)|2: _M6502_LABEL(0x09,2) assert(false);break;
+        case (0x09<<3)|3: _M6502_LABEL(0x09,3) assert(false);break;
+        case (0x09<<3)|4: _M6502_LABEL(0x09,4) assert(false);break;
+        case (0x09<<3)|5: _M6502_LABEL(0x09,5) assert(false);break;
+        case (0x09<<3)|6: _M6502_LABEL(0x09,6) assert(false);break;
+        case (0x09<<3)|7: _M6502_LABEL(0x09,7) assert(false);break;
     /* ASLA  */
-        case (0x0A<<3)|0: _SA(c->PC);break;
-        case (0x0A<<3)|1: c->A=_m6502_asl(c,c->A);_FETCH();break;
-        case (0x0A<<3)|2: assert(false);break;
-        case (0x0A<<3)|3: assert(false);break;
-        case (0x0A<<3)|4: assert(false);break;
-        case (0x0A<<3)|5: assert(false);break;
-        case (0x0A<<3)|6: assert(false);break;
-        case (0x0A<<3)|7: assert(false);break;
+        case (0x0A<<3)|0: _M6502_LABEL(0x0A,0) _SA(c->PC);break;
+        case (0x0A<<3)|1: _M6502_LABEL(0x0A,1) c->A=_m6502_asl(c,c->A);_FETCH();break;
+        case (0x0A<<3)|2: _M6502_LABEL(0x0A,2) assert(false);break;
+        case (0x0A<<3)|3: _M6502_LABEL(0x0A,3) assert(false);break;
+        case (0x0A<<3)|4: _M6502_LABEL(0x0A,4) assert(false);break;
+        case (0x0A<<3)|5: _M6502_LABEL(0x0A,5) assert(false);break;
+        case (0x0A<<3)|6: _M6502_LABEL(0x0A,6) assert(false);break;
+        case (0x0A<<3)|7: _M6502_LABEL(0x0A,7) assert(false);break;
     /* ANC # (undoc) */
-        case (0x0B<<3)|0: _SA(c->PC++);break;
-        case (0x0B<<3)|1: c->A&=_GD();_NZ(c->A);if(c->A&0x80){c->P|=M6502_CF;}else{c->P&=~M6502_CF;}_FETCH();break;
-        case (0x0B<<3)|2: assert(false);break;
-        case (0x0B<<3)|3: assert(false);break;
-        case (0x0B<<3)|4: assert(false);break;
-        case (0x0B<<3)|5: assert(false);break;
-        case (0x0B<<3)|6: assert(false);break;
-        case (0x0B<<3)|7: assert(false);break;
+        case (0x0B<<3)|0: _M6502_LABEL(0x0B,0) _SA(c->PC++);break;
+        case (0x0B<<3)|1: _M6502_LABEL(0x0B,1) c->A&=_GD();_NZ(c->A);if(c->A&0x80){c->P|=M6502_CF;}else{c->P&=~M6502_CF;}_FETCH();break;
+        case (0x0B<<3)|2: _M6502_LABEL(0x0B,2) assert(false);break;
+        case (0x0B<<3)|3: _M6502_LABEL(0x0B,3) assert(false);break;
+        case (0x0B<<3)|4: _M6502_LABEL(0x0B,4) assert(false);break;
+        case (0x0B<<3)|5: _M6502_LABEL(0x0B,5) assert(false);break;
+        case (0x0B<<3)|6: _M6502_LABEL(0x0B,6) assert(false);break;
+        case (0x0B<<3)|7: _M6502_LABEL(0x0B,7) assert(false);break;
     /* NOP abs (undoc) */
-        case (0x0C<<3)|0: _SA(c->PC++);break;
-        case (0x0C<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x0C<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x0C<<3)|3: _FETCH();break;
-        case (0x0C<<3)|4: assert(false);break;
-        case (0x0C<<3)|5: assert(false);break;
-        case (0x0C<<3)|6: assert(false);break;
-        case (0x0C<<3)|7: assert(false);break;
+        case (0x0C<<3)|0: _M6502_LABEL(0x0C,0) _SA(c->PC++);break;
+        case (0x0C<<3)|1: _M6502_LABEL(0x0C,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x0C<<3)|2: _M6502_LABEL(0x0C,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x0C<<3)|3: _M6502_LABEL(0x0C,3) _FETCH();break;
+        case (0x0C<<3)|4: _M6502_LABEL(0x0C,4) assert(false);break;
+        case (0x0C<<3)|5: _M6502_LABEL(0x0C,5) assert(false);break;
+        case (0x0C<<3)|6: _M6502_LABEL(0x0C,6) assert(false);break;
+        case (0x0C<<3)|7: _M6502_LABEL(0x0C,7) assert(false);break;
     /* ORA abs */
-        case (0x0D<<3)|0: _SA(c->PC++);break;
-        case (0x0D<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x0D<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x0D<<3)|3: c->A|=_GD();_NZ(c->A);_FETCH();break;
-        case (0x0D<<3)|4: assert(false);break;
-        case (0x0D<<3)|5: assert(false);break;
-        case (0x0D<<3)|6: assert(false);break;
-        case (0x0D<<3)|7: assert(false);break;
+        case (0x0D<<3)|0: _M6502_LABEL(0x0D,0) _SA(c->PC++);break;
+        case (0x0D<<3)|1: _M6502_LABEL(0x0D,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x0D<<3)|2: _M6502_LABEL(0x0D,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x0D<<3)|3: _M6502_LABEL(0x0D,3) c->A|=_GD();_NZ(c->A);_FETCH();break;
+        case (0x0D<<3)|4: _M6502_LABEL(0x0D,4) assert(false);break;
+        case (0x0D<<3)|5: _M6502_LABEL(0x0D,5) assert(false);break;
+        case (0x0D<<3)|6: _M6502_LABEL(0x0D,6) assert(false);break;
+        case (0x0D<<3)|7: _M6502_LABEL(0x0D,7) assert(false);break;
     /* ASL abs */
-        case (0x0E<<3)|0: _SA(c->PC++);break;
-        case (0x0E<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x0E<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x0E<<3)|3: c->AD=_GD();_WR();break;
-        case (0x0E<<3)|4: _SD(_m6502_asl(c,c->AD));_WR();break;
-        case (0x0E<<3)|5: _FETCH();break;
-        case (0x0E<<3)|6: assert(false);break;
-        case (0x0E<<3)|7: assert(false);break;
+        case (0x0E<<3)|0: _M6502_LABEL(0x0E,0) _SA(c->PC++);break;
+        case (0x0E<<3)|1: _M6502_LABEL(0x0E,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x0E<<3)|2: _M6502_LABEL(0x0E,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x0E<<3)|3: _M6502_LABEL(0x0E,3) c->AD=_GD();_WR();break;
+        case (0x0E<<3)|4: _M6502_LABEL(0x0E,4) _SD(_m6502_asl(c,c->AD));_WR();break;
+        case (0x0E<<3)|5: _M6502_LABEL(0x0E,5) _FETCH();break;
+        case (0x0E<<3)|6: _M6502_LABEL(0x0E,6) assert(false);break;
+        case (0x0E<<3)|7: _M6502_LABEL(0x0E,7) assert(false);break;
     /* SLO abs (undoc) */
-        case (0x0F<<3)|0: _SA(c->PC++);break;
-        case (0x0F<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x0F<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x0F<<3)|3: c->AD=_GD();_WR();break;
-        case (0x0F<<3)|4: c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
-        case (0x0F<<3)|5: _FETCH();break;
-        case (0x0F<<3)|6: assert(false);break;
-        case (0x0F<<3)|7: assert(false);break;
+        case (0x0F<<3)|0: _M6502_LABEL(0x0F,0) _SA(c->PC++);break;
+        case (0x0F<<3)|1: _M6502_LABEL(0x0F,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x0F<<3)|2: _M6502_LABEL(0x0F,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x0F<<3)|3: _M6502_LABEL(0x0F,3) c->AD=_GD();_WR();break;
+        case (0x0F<<3)|4: _M6502_LABEL(0x0F,4) c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
+        case (0x0F<<3)|5: _M6502_LABEL(0x0F,5) _FETCH();break;
+        case (0x0F<<3)|6: _M6502_LABEL(0x0F,6) assert(false);break;
+        case (0x0F<<3)|7: _M6502_LABEL(0x0F,7) assert(false);break;
     /* BPL # */
-        case (0x10<<3)|0: _SA(c->PC++);break;
-        case (0x10<<3)|1: _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x80)!=0x0){_FETCH();};break;
-        case (0x10<<3)|2: _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
-        case (0x10<<3)|3: c->PC=c->AD;_FETCH();break;
-        case (0x10<<3)|4: assert(false);break;
-        case (0x10<<3)|5: assert(false);break;
-        case (0x10<<3)|6: assert(false);break;
-        case (0x10<<3)|7: assert(false);break;
+        case (0x10<<3)|0: _M6502_LABEL(0x10,0) _SA(c->PC++);break;
+        case (0x10<<3)|1: _M6502_LABEL(0x10,1) _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x80)!=0x0){_FETCH();};break;
+        case (0x10<<3)|2: _M6502_LABEL(0x10,2) _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
+        case (0x10<<3)|3: _M6502_LABEL(0x10,3) c->PC=c->AD;_FETCH();break;
+        case (0x10<<3)|4: _M6502_LABEL(0x10,4) assert(false);break;
+        case (0x10<<3)|5: _M6502_LABEL(0x10,5) assert(false);break;
+        case (0x10<<3)|6: _M6502_LABEL(0x10,6) assert(false);break;
+        case (0x10<<3)|7: _M6502_LABEL(0x10,7) assert(false);break;
     /* ORA (zp),Y */
-        case (0x11<<3)|0: _SA(c->PC++);break;
-        case (0x11<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x11<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x11<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0x11<<3)|4: _SA(c->AD+c->Y);break;
-        case (0x11<<3)|5: c->A|=_GD();_NZ(c->A);_FETCH();break;
-        case (0x11<<3)|6: assert(false);break;
-        case (0x11<<3)|7: assert(false);break;
+        case (0x11<<3)|0: _M6502_LABEL(0x11,0) _SA(c->PC++);break;
+        case (0x11<<3)|1: _M6502_LABEL(0x11,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x11<<3)|2: _M6502_LABEL(0x11,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x11<<3)|3: _M6502_LABEL(0x11,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0x11<<3)|4: _M6502_LABEL(0x11,4) _SA(c->AD+c->Y);break;
+        case (0x11<<3)|5: _M6502_LABEL(0x11,5) c->A|=_GD();_NZ(c->A);_FETCH();break;
+        case (0x11<<3)|6: _M6502_LABEL(0x11,6) assert(false);break;
+        case (0x11<<3)|7: _M6502_LABEL(0x11,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0x12<<3)|0: _SA(c->PC);break;
-        case (0x12<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0x12<<3)|2: assert(false);break;
-        case (0x12<<3)|3: assert(false);break;
-        case (0x12<<3)|4: assert(false);break;
-        case (0x12<<3)|5: assert(false);break;
-        case (0x12<<3)|6: assert(false);break;
-        case (0x12<<3)|7: assert(false);break;
+        case (0x12<<3)|0: _M6502_LABEL(0x12,0) _SA(c->PC);break;
+        case (0x12<<3)|1: _M6502_LABEL(0x12,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0x12<<3)|2: _M6502_LABEL(0x12,2) assert(false);break;
+        case (0x12<<3)|3: _M6502_LABEL(0x12,3) assert(false);break;
+        case (0x12<<3)|4: _M6502_LABEL(0x12,4) assert(false);break;
+        case (0x12<<3)|5: _M6502_LABEL(0x12,5) assert(false);break;
+        case (0x12<<3)|6: _M6502_LABEL(0x12,6) assert(false);break;
+        case (0x12<<3)|7: _M6502_LABEL(0x12,7) assert(false);break;
     /* SLO (zp),Y (undoc) */
-        case (0x13<<3)|0: _SA(c->PC++);break;
-        case (0x13<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x13<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x13<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x13<<3)|4: _SA(c->AD+c->Y);break;
-        case (0x13<<3)|5: c->AD=_GD();_WR();break;
-        case (0x13<<3)|6: c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
-        case (0x13<<3)|7: _FETCH();break;
+        case (0x13<<3)|0: _M6502_LABEL(0x13,0) _SA(c->PC++);break;
+        case (0x13<<3)|1: _M6502_LABEL(0x13,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x13<<3)|2: _M6502_LABEL(0x13,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x13<<3)|3: _M6502_LABEL(0x13,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x13<<3)|4: _M6502_LABEL(0x13,4) _SA(c->AD+c->Y);break;
+        case (0x13<<3)|5: _M6502_LABEL(0x13,5) c->AD=_GD();_WR();break;
+        case (0x13<<3)|6: _M6502_LABEL(0x13,6) c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
+        case (0x13<<3)|7: _M6502_LABEL(0x13,7) _FETCH();break;
     /* NOP zp,X (undoc) */
-        case (0x14<<3)|0: _SA(c->PC++);break;
-        case (0x14<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x14<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x14<<3)|3: _FETCH();break;
-        case (0x14<<3)|4: assert(false);break;
-        case (0x14<<3)|5: assert(false);break;
-        case (0x14<<3)|6: assert(false);break;
-        case (0x14<<3)|7: assert(false);break;
+        case (0x14<<3)|0: _M6502_LABEL(0x14,0) _SA(c->PC++);break;
+        case (0x14<<3)|1: _M6502_LABEL(0x14,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x14<<3)|2: _M6502_LABEL(0x14,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x14<<3)|3: _M6502_LABEL(0x14,3) _FETCH();break;
+        case (0x14<<3)|4: _M6502_LABEL(0x14,4) assert(false);break;
+        case (0x14<<3)|5: _M6502_LABEL(0x14,5) assert(false);break;
+        case (0x14<<3)|6: _M6502_LABEL(0x14,6) assert(false);break;
+        case (0x14<<3)|7: _M6502_LABEL(0x14,7) assert(false);break;
     /* ORA zp,X */
-        case (0x15<<3)|0: _SA(c->PC++);break;
-        case (0x15<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x15<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x15<<3)|3: c->A|=_GD();_NZ(c->A);_FETCH();break;
-        case (0x15<<3)|4: assert(false);break;
-        case (0x15<<3)|5: assert(false);break;
-        case (0x15<<3)|6: assert(false);break;
-        case (0x15<<3)|7: assert(false);break;
+        case (0x15<<3)|0: _M6502_LABEL(0x15,0) _SA(c->PC++);break;
+        case (0x15<<3)|1: _M6502_LABEL(0x15,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x15<<3)|2: _M6502_LABEL(0x15,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x15<<3)|3: _M6502_LABEL(0x15,3) c->A|=_GD();_NZ(c->A);_FETCH();break;
+        case (0x15<<3)|4: _M6502_LABEL(0x15,4) assert(false);break;
+        case (0x15<<3)|5: _M6502_LABEL(0x15,5) assert(false);break;
+        case (0x15<<3)|6: _M6502_LABEL(0x15,6) assert(false);break;
+        case (0x15<<3)|7: _M6502_LABEL(0x15,7) assert(false);break;
     /* ASL zp,X */
-        case (0x16<<3)|0: _SA(c->PC++);break;
-        case (0x16<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x16<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x16<<3)|3: c->AD=_GD();_WR();break;
-        case (0x16<<3)|4: _SD(_m6502_asl(c,c->AD));_WR();break;
-        case (0x16<<3)|5: _FETCH();break;
-        case (0x16<<3)|6: assert(false);break;
-        case (0x16<<3)|7: assert(false);break;
+        case (0x16<<3)|0: _M6502_LABEL(0x16,0) _SA(c->PC++);break;
+        case (0x16<<3)|1: _M6502_LABEL(0x16,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x16<<3)|2: _M6502_LABEL(0x16,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x16<<3)|3: _M6502_LABEL(0x16,3) c->AD=_GD();_WR();break;
+        case (0x16<<3)|4: _M6502_LABEL(0x16,4) _SD(_m6502_asl(c,c->AD));_WR();break;
+        case (0x16<<3)|5: _M6502_LABEL(0x16,5) _FETCH();break;
+        case (0x16<<3)|6: _M6502_LABEL(0x16,6) assert(false);break;
+        case (0x16<<3)|7: _M6502_LABEL(0x16,7) assert(false);break;
     /* SLO zp,X (undoc) */
-        case (0x17<<3)|0: _SA(c->PC++);break;
-        case (0x17<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x17<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x17<<3)|3: c->AD=_GD();_WR();break;
-        case (0x17<<3)|4: c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
-        case (0x17<<3)|5: _FETCH();break;
-        case (0x17<<3)|6: assert(false);break;
-        case (0x17<<3)|7: assert(false);break;
+        case (0x17<<3)|0: _M6502_LABEL(0x17,0) _SA(c->PC++);break;
+        case (0x17<<3)|1: _M6502_LABEL(0x17,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x17<<3)|2: _M6502_LABEL(0x17,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x17<<3)|3: _M6502_LABEL(0x17,3) c->AD=_GD();_WR();break;
+        case (0x17<<3)|4: _M6502_LABEL(0x17,4) c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
+        case (0x17<<3)|5: _M6502_LABEL(0x17,5) _FETCH();break;
+        case (0x17<<3)|6: _M6502_LABEL(0x17,6) assert(false);break;
+        case (0x17<<3)|7: _M6502_LABEL(0x17,7) assert(false);break;
     /* CLC  */
-        case (0x18<<3)|0: _SA(c->PC);break;
-        case (0x18<<3)|1: c->P&=~0x1;_FETCH();break;
-        case (0x18<<3)|2: assert(false);break;
-        case (0x18<<3)|3: assert(false);break;
-        case (0x18<<3)|4: assert(false);break;
-        case (0x18<<3)|5: assert(false);break;
-        case (0x18<<3)|6: assert(false);break;
-        case (0x18<<3)|7: assert(false);break;
+        case (0x18<<3)|0: _M6502_LABEL(0x18,0) _SA(c->PC);break;
+        case (0x18<<3)|1: _M6502_LABEL(0x18,1) c->P&=~0x1;_FETCH();break;
+        case (0x18<<3)|2: _M6502_LABEL(0x18,2) assert(false);break;
+        case (0x18<<3)|3: _M6502_LABEL(0x18,3) assert(false);break;
+        case (0x18<<3)|4: _M6502_LABEL(0x18,4) assert(false);break;
+        case (0x18<<3)|5: _M6502_LABEL(0x18,5) assert(false);break;
+        case (0x18<<3)|6: _M6502_LABEL(0x18,6) assert(false);break;
+        case (0x18<<3)|7: _M6502_LABEL(0x18,7) assert(false);break;
     /* ORA abs,Y */
-        case (0x19<<3)|0: _SA(c->PC++);break;
-        case (0x19<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x19<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0x19<<3)|3: _SA(c->AD+c->Y);break;
-        case (0x19<<3)|4: c->A|=_GD();_NZ(c->A);_FETCH();break;
-        case (0x19<<3)|5: assert(false);break;
-        case (0x19<<3)|6: assert(false);break;
-        case (0x19<<3)|7: assert(false);break;
+        case (0x19<<3)|0: _M6502_LABEL(0x19,0) _SA(c->PC++);break;
+        case (0x19<<3)|1: _M6502_LABEL(0x19,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x19<<3)|2: _M6502_LABEL(0x19,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0x19<<3)|3: _M6502_LABEL(0x19,3) _SA(c->AD+c->Y);break;
+        case (0x19<<3)|4: _M6502_LABEL(0x19,4) c->A|=_GD();_NZ(c->A);_FETCH();break;
+        case (0x19<<3)|5: _M6502_LABEL(0x19,5) assert(false);break;
+        case (0x19<<3)|6: _M6502_LABEL(0x19,6) assert(false);break;
+        case (0x19<<3)|7: _M6502_LABEL(0x19,7) assert(false);break;
     /* NOP  (undoc) */
-        case (0x1A<<3)|0: _SA(c->PC);break;
-        case (0x1A<<3)|1: _FETCH();break;
-        case (0x1A<<3)|2: assert(false);break;
-        case (0x1A<<3)|3: assert(false);break;
-        case (0x1A<<3)|4: assert(false);break;
-        case (0x1A<<3)|5: assert(false);break;
-        case (0x1A<<3)|6: assert(false);break;
-        case (0x1A<<3)|7: assert(false);break;
+        case (0x1A<<3)|0: _M6502_LABEL(0x1A,0) _SA(c->PC);break;
+        case (0x1A<<3)|1: _M6502_LABEL(0x1A,1) _FETCH();break;
+        case (0x1A<<3)|2: _M6502_LABEL(0x1A,2) assert(false);break;
+        case (0x1A<<3)|3: _M6502_LABEL(0x1A,3) assert(false);break;
+        case (0x1A<<3)|4: _M6502_LABEL(0x1A,4) assert(false);break;
+        case (0x1A<<3)|5: _M6502_LABEL(0x1A,5) assert(false);break;
+        case (0x1A<<3)|6: _M6502_LABEL(0x1A,6) assert(false);break;
+        case (0x1A<<3)|7: _M6502_LABEL(0x1A,7) assert(false);break;
     /* SLO abs,Y (undoc) */
-        case (0x1B<<3)|0: _SA(c->PC++);break;
-        case (0x1B<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x1B<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x1B<<3)|3: _SA(c->AD+c->Y);break;
-        case (0x1B<<3)|4: c->AD=_GD();_WR();break;
-        case (0x1B<<3)|5: c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
-        case (0x1B<<3)|6: _FETCH();break;
-        case (0x1B<<3)|7: assert(false);break;
+        case (0x1B<<3)|0: _M6502_LABEL(0x1B,0) _SA(c->PC++);break;
+        case (0x1B<<3)|1: _M6502_LABEL(0x1B,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x1B<<3)|2: _M6502_LABEL(0x1B,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x1B<<3)|3: _M6502_LABEL(0x1B,3) _SA(c->AD+c->Y);break;
+        case (0x1B<<3)|4: _M6502_LABEL(0x1B,4) c->AD=_GD();_WR();break;
+        case (0x1B<<3)|5: _M6502_LABEL(0x1B,5) c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
+        case (0x1B<<3)|6: _M6502_LABEL(0x1B,6) _FETCH();break;
+        case (0x1B<<3)|7: _M6502_LABEL(0x1B,7) assert(false);break;
     /* NOP abs,X (undoc) */
-        case (0x1C<<3)|0: _SA(c->PC++);break;
-        case (0x1C<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x1C<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0x1C<<3)|3: _SA(c->AD+c->X);break;
-        case (0x1C<<3)|4: _FETCH();break;
-        case (0x1C<<3)|5: assert(false);break;
-        case (0x1C<<3)|6: assert(false);break;
-        case (0x1C<<3)|7: assert(false);break;
+        case (0x1C<<3)|0: _M6502_LABEL(0x1C,0) _SA(c->PC++);break;
+        case (0x1C<<3)|1: _M6502_LABEL(0x1C,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x1C<<3)|2: _M6502_LABEL(0x1C,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0x1C<<3)|3: _M6502_LABEL(0x1C,3) _SA(c->AD+c->X);break;
+        case (0x1C<<3)|4: _M6502_LABEL(0x1C,4) _FETCH();break;
+        case (0x1C<<3)|5: _M6502_LABEL(0x1C,5) assert(false);break;
+        case (0x1C<<3)|6: _M6502_LABEL(0x1C,6) assert(false);break;
+        case (0x1C<<3)|7: _M6502_LABEL(0x1C,7) assert(false);break;
     /* ORA abs,X */
-        case (0x1D<<3)|0: _SA(c->PC++);break;
-        case (0x1D<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x1D<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0x1D<<3)|3: _SA(c->AD+c->X);break;
-        case (0x1D<<3)|4: c->A|=_GD();_NZ(c->A);_FETCH();break;
-        case (0x1D<<3)|5: assert(false);break;
-        case (0x1D<<3)|6: assert(false);break;
-        case (0x1D<<3)|7: assert(false);break;
+        case (0x1D<<3)|0: _M6502_LABEL(0x1D,0) _SA(c->PC++);break;
+        case (0x1D<<3)|1: _M6502_LABEL(0x1D,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x1D<<3)|2: _M6502_LABEL(0x1D,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0x1D<<3)|3: _M6502_LABEL(0x1D,3) _SA(c->AD+c->X);break;
+        case (0x1D<<3)|4: _M6502_LABEL(0x1D,4) c->A|=_GD();_NZ(c->A);_FETCH();break;
+        case (0x1D<<3)|5: _M6502_LABEL(0x1D,5) assert(false);break;
+        case (0x1D<<3)|6: _M6502_LABEL(0x1D,6) assert(false);break;
+        case (0x1D<<3)|7: _M6502_LABEL(0x1D,7) assert(false);break;
     /* ASL abs,X */
-        case (0x1E<<3)|0: _SA(c->PC++);break;
-        case (0x1E<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x1E<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0x1E<<3)|3: _SA(c->AD+c->X);break;
-        case (0x1E<<3)|4: c->AD=_GD();_WR();break;
-        case (0x1E<<3)|5: _SD(_m6502_asl(c,c->AD));_WR();break;
-        case (0x1E<<3)|6: _FETCH();break;
-        case (0x1E<<3)|7: assert(false);break;
+        case (0x1E<<3)|0: _M6502_LABEL(0x1E,0) _SA(c->PC++);break;
+        case (0x1E<<3)|1: _M6502_LABEL(0x1E,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x1E<<3)|2: _M6502_LABEL(0x1E,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0x1E<<3)|3: _M6502_LABEL(0x1E,3) _SA(c->AD+c->X);break;
+        case (0x1E<<3)|4: _M6502_LABEL(0x1E,4) c->AD=_GD();_WR();break;
+        case (0x1E<<3)|5: _M6502_LABEL(0x1E,5) _SD(_m6502_asl(c,c->AD));_WR();break;
+        case (0x1E<<3)|6: _M6502_LABEL(0x1E,6) _FETCH();break;
+        case (0x1E<<3)|7: _M6502_LABEL(0x1E,7) assert(false);break;
     /* SLO abs,X (undoc) */
-        case (0x1F<<3)|0: _SA(c->PC++);break;
-        case (0x1F<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x1F<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0x1F<<3)|3: _SA(c->AD+c->X);break;
-        case (0x1F<<3)|4: c->AD=_GD();_WR();break;
-        case (0x1F<<3)|5: c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
-        case (0x1F<<3)|6: _FETCH();break;
-        case (0x1F<<3)|7: assert(false);break;
+        case (0x1F<<3)|0: _M6502_LABEL(0x1F,0) _SA(c->PC++);break;
+        case (0x1F<<3)|1: _M6502_LABEL(0x1F,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x1F<<3)|2: _M6502_LABEL(0x1F,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0x1F<<3)|3: _M6502_LABEL(0x1F,3) _SA(c->AD+c->X);break;
+        case (0x1F<<3)|4: _M6502_LABEL(0x1F,4) c->AD=_GD();_WR();break;
+        case (0x1F<<3)|5: _M6502_LABEL(0x1F,5) c->AD=_m6502_asl(c,c->AD);_SD(c->AD);c->A|=c->AD;_NZ(c->A);_WR();break;
+        case (0x1F<<3)|6: _M6502_LABEL(0x1F,6) _FETCH();break;
+        case (0x1F<<3)|7: _M6502_LABEL(0x1F,7) assert(false);break;
     /* JSR  */
-        case (0x20<<3)|0: _SA(c->PC++);break;
-        case (0x20<<3)|1: _SA(0x0100|c->S);c->AD=_GD();break;
-        case (0x20<<3)|2: _SAD(0x0100|c->S--,c->PC>>8);_WR();break;
-        case (0x20<<3)|3: _SAD(0x0100|c->S--,c->PC);_WR();break;
-        case (0x20<<3)|4: _SA(c->PC);break;
-        case (0x20<<3)|5: c->PC=(_GD()<<8)|c->AD;_FETCH();break;
-        case (0x20<<3)|6: assert(false);break;
-        case (0x20<<3)|7: assert(false);break;
+        case (0x20<<3)|0: _M6502_LABEL(0x20,0) _SA(c->PC++);break;
+        case (0x20<<3)|1: _M6502_LABEL(0x20,1) _SA(0x0100|c->S);c->AD=_GD();break;
+        case (0x20<<3)|2: _M6502_LABEL(0x20,2) _SAD(0x0100|c->S--,c->PC>>8);_WR();break;
+        case (0x20<<3)|3: _M6502_LABEL(0x20,3) _SAD(0x0100|c->S--,c->PC);_WR();break;
+        case (0x20<<3)|4: _M6502_LABEL(0x20,4) _SA(c->PC);break;
+        case (0x20<<3)|5: _M6502_LABEL(0x20,5) c->PC=(_GD()<<8)|c->AD;_FETCH();break;
+        case (0x20<<3)|6: _M6502_LABEL(0x20,6) assert(false);break;
+        case (0x20<<3)|7: _M6502_LABEL(0x20,7) assert(false);break;
     /* AND (zp,X) */
-        case (0x21<<3)|0: _SA(c->PC++);break;
-        case (0x21<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x21<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0x21<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x21<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0x21<<3)|5: c->A&=_GD();_NZ(c->A);_FETCH();break;
-        case (0x21<<3)|6: assert(false);break;
-        case (0x21<<3)|7: assert(false);break;
+        case (0x21<<3)|0: _M6502_LABEL(0x21,0) _SA(c->PC++);break;
+        case (0x21<<3)|1: _M6502_LABEL(0x21,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x21<<3)|2: _M6502_LABEL(0x21,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0x21<<3)|3: _M6502_LABEL(0x21,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x21<<3)|4: _M6502_LABEL(0x21,4) _SA((_GD()<<8)|c->AD);break;
+        case (0x21<<3)|5: _M6502_LABEL(0x21,5) c->A&=_GD();_NZ(c->A);_FETCH();break;
+        case (0x21<<3)|6: _M6502_LABEL(0x21,6) assert(false);break;
+        case (0x21<<3)|7: _M6502_LABEL(0x21,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0x22<<3)|0: _SA(c->PC);break;
-        case (0x22<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0x22<<3)|2: assert(false);break;
-        case (0x22<<3)|3: assert(false);break;
-        case (0x22<<3)|4: assert(false);break;
-        case (0x22<<3)|5: assert(false);break;
-        case (0x22<<3)|6: assert(false);break;
-        case (0x22<<3)|7: assert(false);break;
+        case (0x22<<3)|0: _M6502_LABEL(0x22,0) _SA(c->PC);break;
+        case (0x22<<3)|1: _M6502_LABEL(0x22,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0x22<<3)|2: _M6502_LABEL(0x22,2) assert(false);break;
+        case (0x22<<3)|3: _M6502_LABEL(0x22,3) assert(false);break;
+        case (0x22<<3)|4: _M6502_LABEL(0x22,4) assert(false);break;
+        case (0x22<<3)|5: _M6502_LABEL(0x22,5) assert(false);break;
+        case (0x22<<3)|6: _M6502_LABEL(0x22,6) assert(false);break;
+        case (0x22<<3)|7: _M6502_LABEL(0x22,7) assert(false);break;
     /* RLA (zp,X) (undoc) */
-        case (0x23<<3)|0: _SA(c->PC++);break;
-        case (0x23<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x23<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0x23<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x23<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0x23<<3)|5: c->AD=_GD();_WR();break;
-        case (0x23<<3)|6: c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
-        case (0x23<<3)|7: _FETCH();break;
+        case (0x23<<3)|0: _M6502_LABEL(0x23,0) _SA(c->PC++);break;
+        case (0x23<<3)|1: _M6502_LABEL(0x23,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x23<<3)|2: _M6502_LABEL(0x23,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0x23<<3)|3: _M6502_LABEL(0x23,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x23<<3)|4: _M6502_LABEL(0x23,4) _SA((_GD()<<8)|c->AD);break;
+        case (0x23<<3)|5: _M6502_LABEL(0x23,5) c->AD=_GD();_WR();break;
+        case (0x23<<3)|6: _M6502_LABEL(0x23,6) c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
+        case (0x23<<3)|7: _M6502_LABEL(0x23,7) _FETCH();break;
     /* BIT zp */
-        case (0x24<<3)|0: _SA(c->PC++);break;
-        case (0x24<<3)|1: _SA(_GD());break;
-        case (0x24<<3)|2: _m6502_bit(c,_GD());_FETCH();break;
-        case (0x24<<3)|3: assert(false);break;
-        case (0x24<<3)|4: assert(false);break;
-        case (0x24<<3)|5: assert(false);break;
-        case (0x24<<3)|6: assert(false);break;
-        case (0x24<<3)|7: assert(false);break;
+        case (0x24<<3)|0: _M6502_LABEL(0x24,0) _SA(c->PC++);break;
+        case (0x24<<3)|1: _M6502_LABEL(0x24,1) _SA(_GD());break;
+        case (0x24<<3)|2: _M6502_LABEL(0x24,2) _m6502_bit(c,_GD());_FETCH();break;
+        case (0x24<<3)|3: _M6502_LABEL(0x24,3) assert(false);break;
+        case (0x24<<3)|4: _M6502_LABEL(0x24,4) assert(false);break;
+        case (0x24<<3)|5: _M6502_LABEL(0x24,5) assert(false);break;
+        case (0x24<<3)|6: _M6502_LABEL(0x24,6) assert(false);break;
+        case (0x24<<3)|7: _M6502_LABEL(0x24,7) assert(false);break;
     /* AND zp */
-        case (0x25<<3)|0: _SA(c->PC++);break;
-        case (0x25<<3)|1: _SA(_GD());break;
-        case (0x25<<3)|2: c->A&=_GD();_NZ(c->A);_FETCH();break;
-        case (0x25<<3)|3: assert(false);break;
-        case (0x25<<3)|4: assert(false);break;
-        case (0x25<<3)|5: assert(false);break;
-        case (0x25<<3)|6: assert(false);break;
-        case (0x25<<3)|7: assert(false);break;
+        case (0x25<<3)|0: _M6502_LABEL(0x25,0) _SA(c->PC++);break;
+        case (0x25<<3)|1: _M6502_LABEL(0x25,1) _SA(_GD());break;
+        case (0x25<<3)|2: _M6502_LABEL(0x25,2) c->A&=_GD();_NZ(c->A);_FETCH();break;
+        case (0x25<<3)|3: _M6502_LABEL(0x25,3) assert(false);break;
+        case (0x25<<3)|4: _M6502_LABEL(0x25,4) assert(false);break;
+        case (0x25<<3)|5: _M6502_LABEL(0x25,5) assert(false);break;
+        case (0x25<<3)|6: _M6502_LABEL(0x25,6) assert(false);break;
+        case (0x25<<3)|7: _M6502_LABEL(0x25,7) assert(false);break;
     /* ROL zp */
-        case (0x26<<3)|0: _SA(c->PC++);break;
-        case (0x26<<3)|1: _SA(_GD());break;
-        case (0x26<<3)|2: c->AD=_GD();_WR();break;
-        case (0x26<<3)|3: _SD(_m6502_rol(c,c->AD));_WR();break;
-        case (0x26<<3)|4: _FETCH();break;
-        case (0x26<<3)|5: assert(false);break;
-        case (0x26<<3)|6: assert(false);break;
-        case (0x26<<3)|7: assert(false);break;
+        case (0x26<<3)|0: _M6502_LABEL(0x26,0) _SA(c->PC++);break;
+        case (0x26<<3)|1: _M6502_LABEL(0x26,1) _SA(_GD());break;
+        case (0x26<<3)|2: _M6502_LABEL(0x26,2) c->AD=_GD();_WR();break;
+        case (0x26<<3)|3: _M6502_LABEL(0x26,3) _SD(_m6502_rol(c,c->AD));_WR();break;
+        case (0x26<<3)|4: _M6502_LABEL(0x26,4) _FETCH();break;
+        case (0x26<<3)|5: _M6502_LABEL(0x26,5) assert(false);break;
+        case (0x26<<3)|6: _M6502_LABEL(0x26,6) assert(false);break;
+        case (0x26<<3)|7: _M6502_LABEL(0x26,7) assert(false);break;
     /* RLA zp (undoc) */
-        case (0x27<<3)|0: _SA(c->PC++);break;
-        case (0x27<<3)|1: _SA(_GD());break;
-        case (0x27<<3)|2: c->AD=_GD();_WR();break;
-        case (0x27<<3)|3: c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
-        case (0x27<<3)|4: _FETCH();break;
-        case (0x27<<3)|5: assert(false);break;
-        case (0x27<<3)|6: assert(false);break;
-        case (0x27<<3)|7: assert(false);break;
+        case (0x27<<3)|0: _M6502_LABEL(0x27,0) _SA(c->PC++);break;
+        case (0x27<<3)|1: _M6502_LABEL(0x27,1) _SA(_GD());break;
+        case (0x27<<3)|2: _M6502_LABEL(0x27,2) c->AD=_GD();_WR();break;
+        case (0x27<<3)|3: _M6502_LABEL(0x27,3) c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
+        case (0x27<<3)|4: _M6502_LABEL(0x27,4) _FETCH();break;
+        case (0x27<<3)|5: _M6502_LABEL(0x27,5) assert(false);break;
+        case (0x27<<3)|6: _M6502_LABEL(0x27,6) assert(false);break;
+        case (0x27<<3)|7: _M6502_LABEL(0x27,7) assert(false);break;
     /* PLP  */
-        case (0x28<<3)|0: _SA(c->PC);break;
-        case (0x28<<3)|1: _SA(0x0100|c->S++);break;
-        case (0x28<<3)|2: _SA(0x0100|c->S);break;
-        case (0x28<<3)|3: c->P=(_GD()|M6502_BF)&~M6502_XF;_FETCH();break;
-        case (0x28<<3)|4: assert(false);break;
-        case (0x28<<3)|5: assert(false);break;
-        case (0x28<<3)|6: assert(false);break;
-        case (0x28<<3)|7: assert(false);break;
+        case (0x28<<3)|0: _M6502_LABEL(0x28,0) _SA(c->PC);break;
+        case (0x28<<3)|1: _M6502_LABEL(0x28,1) _SA(0x0100|c->S++);break;
+        case (0x28<<3)|2: _M6502_LABEL(0x28,2) _SA(0x0100|c->S);break;
+        case (0x28<<3)|3: _M6502_LABEL(0x28,3) c->P=(_GD()|M6502_BF)&~M6502_XF;_FETCH();break;
+        case (0x28<<3)|4: _M6502_LABEL(0x28,4) assert(false);break;
+        case (0x28<<3)|5: _M6502_LABEL(0x28,5) assert(false);break;
+        case (0x28<<3)|6: _M6502_LABEL(0x28,6) assert(false);break;
+        case (0x28<<3)|7: _M6502_LABEL(0x28,7) assert(false);break;
     /* AND # */
-        case (0x29<<3)|0: _SA(c->PC++);break;
-        case (0x29<<3)|1: c->A&=_GD();_NZ(c->A);_FETCH();break;
-        case (0x29<<3)|2: assert(false);break;
-        case (0x29<<3)|3: assert(false);break;
-        case (0x29<<3)|4: assert(false);break;
-        case (0x29<<3)|5: assert(false);break;
-        case (0x29<<3)|6: assert(false);break;
-        case (0x29<<3)|7: assert(false);break;
+        case (0x29<<3)|0: _M6502_LABEL(0x29,0) _SA(c->PC++);break;
+        case (0x29<<3)|1: _M6502_LABEL(0x29,1) c->A&=_GD();_NZ(c->A);_FETCH();break;
+        case (0x29<<3)|2: _M6502_LABEL(0x29,2) assert(false);break;
+        case (0x29<<3)|3: _M6502_LABEL(0x29,3) assert(false);break;
+        case (0x29<<3)|4: _M6502_LABEL(0x29,4) assert(false);break;
+        case (0x29<<3)|5: _M6502_LABEL(0x29,5) assert(false);break;
+        case (0x29<<3)|6: _M6502_LABEL(0x29,6) assert(false);break;
+        case (0x29<<3)|7: _M6502_LABEL(0x29,7) assert(false);break;
     /* ROLA  */
-        case (0x2A<<3)|0: _SA(c->PC);break;
-        case (0x2A<<3)|1: c->A=_m6502_rol(c,c->A);_FETCH();break;
-        case (0x2A<<3)|2: assert(false);break;
-        case (0x2A<<3)|3: assert(false);break;
-        case (0x2A<<3)|4: assert(false);break;
-        case (0x2A<<3)|5: assert(false);break;
-        case (0x2A<<3)|6: assert(false);break;
-        case (0x2A<<3)|7: assert(false);break;
+        case (0x2A<<3)|0: _M6502_LABEL(0x2A,0) _SA(c->PC);break;
+        case (0x2A<<3)|1: _M6502_LABEL(0x2A,1) c->A=_m6502_rol(c,c->A);_FETCH();break;
+        case (0x2A<<3)|2: _M6502_LABEL(0x2A,2) assert(false);break;
+        case (0x2A<<3)|3: _M6502_LABEL(0x2A,3) assert(false);break;
+        case (0x2A<<3)|4: _M6502_LABEL(0x2A,4) assert(false);break;
+        case (0x2A<<3)|5: _M6502_LABEL(0x2A,5) assert(false);break;
+        case (0x2A<<3)|6: _M6502_LABEL(0x2A,6) assert(false);break;
+        case (0x2A<<3)|7: _M6502_LABEL(0x2A,7) assert(false);break;
     /* ANC # (undoc) */
-        case (0x2B<<3)|0: _SA(c->PC++);break;
-        case (0x2B<<3)|1: c->A&=_GD();_NZ(c->A);if(c->A&0x80){c->P|=M6502_CF;}else{c->P&=~M6502_CF;}_FETCH();break;
-        case (0x2B<<3)|2: assert(false);break;
-        case (0x2B<<3)|3: assert(false);break;
-        case (0x2B<<3)|4: assert(false);break;
-        case (0x2B<<3)|5: assert(false);break;
-        case (0x2B<<3)|6: assert(false);break;
-        case (0x2B<<3)|7: assert(false);break;
+        case (0x2B<<3)|0: _M6502_LABEL(0x2B,0) _SA(c->PC++);break;
+        case (0x2B<<3)|1: _M6502_LABEL(0x2B,1) c->A&=_GD();_NZ(c->A);if(c->A&0x80){c->P|=M6502_CF;}else{c->P&=~M6502_CF;}_FETCH();break;
+        case (0x2B<<3)|2: _M6502_LABEL(0x2B,2) assert(false);break;
+        case (0x2B<<3)|3: _M6502_LABEL(0x2B,3) assert(false);break;
+        case (0x2B<<3)|4: _M6502_LABEL(0x2B,4) assert(false);break;
+        case (0x2B<<3)|5: _M6502_LABEL(0x2B,5) assert(false);break;
+        case (0x2B<<3)|6: _M6502_LABEL(0x2B,6) assert(false);break;
+        case (0x2B<<3)|7: _M6502_LABEL(0x2B,7) assert(false);break;
     /* BIT abs */
-        case (0x2C<<3)|0: _SA(c->PC++);break;
-        case (0x2C<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x2C<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x2C<<3)|3: _m6502_bit(c,_GD());_FETCH();break;
-        case (0x2C<<3)|4: assert(false);break;
-        case (0x2C<<3)|5: assert(false);break;
-        case (0x2C<<3)|6: assert(false);break;
-        case (0x2C<<3)|7: assert(false);break;
+        case (0x2C<<3)|0: _M6502_LABEL(0x2C,0) _SA(c->PC++);break;
+        case (0x2C<<3)|1: _M6502_LABEL(0x2C,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x2C<<3)|2: _M6502_LABEL(0x2C,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x2C<<3)|3: _M6502_LABEL(0x2C,3) _m6502_bit(c,_GD());_FETCH();break;
+        case (0x2C<<3)|4: _M6502_LABEL(0x2C,4) assert(false);break;
+        case (0x2C<<3)|5: _M6502_LABEL(0x2C,5) assert(false);break;
+        case (0x2C<<3)|6: _M6502_LABEL(0x2C,6) assert(false);break;
+        case (0x2C<<3)|7: _M6502_LABEL(0x2C,7) assert(false);break;
     /* AND abs */
-        case (0x2D<<3)|0: _SA(c->PC++);break;
-        case (0x2D<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x2D<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x2D<<3)|3: c->A&=_GD();_NZ(c->A);_FETCH();break;
-        case (0x2D<<3)|4: assert(false);break;
-        case (0x2D<<3)|5: assert(false);break;
-        case (0x2D<<3)|6: assert(false);break;
-        case (0x2D<<3)|7: assert(false);break;
+        case (0x2D<<3)|0: _M6502_LABEL(0x2D,0) _SA(c->PC++);break;
+        case (0x2D<<3)|1: _M6502_LABEL(0x2D,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x2D<<3)|2: _M6502_LABEL(0x2D,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x2D<<3)|3: _M6502_LABEL(0x2D,3) c->A&=_GD();_NZ(c->A);_FETCH();break;
+        case (0x2D<<3)|4: _M6502_LABEL(0x2D,4) assert(false);break;
+        case (0x2D<<3)|5: _M6502_LABEL(0x2D,5) assert(false);break;
+        case (0x2D<<3)|6: _M6502_LABEL(0x2D,6) assert(false);break;
+        case (0x2D<<3)|7: _M6502_LABEL(0x2D,7) assert(false);break;
     /* ROL abs */
-        case (0x2E<<3)|0: _SA(c->PC++);break;
-        case (0x2E<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x2E<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x2E<<3)|3: c->AD=_GD();_WR();break;
-        case (0x2E<<3)|4: _SD(_m6502_rol(c,c->AD));_WR();break;
-        case (0x2E<<3)|5: _FETCH();break;
-        case (0x2E<<3)|6: assert(false);break;
-        case (0x2E<<3)|7: assert(false);break;
+        case (0x2E<<3)|0: _M6502_LABEL(0x2E,0) _SA(c->PC++);break;
+        case (0x2E<<3)|1: _M6502_LABEL(0x2E,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x2E<<3)|2: _M6502_LABEL(0x2E,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x2E<<3)|3: _M6502_LABEL(0x2E,3) c->AD=_GD();_WR();break;
+        case (0x2E<<3)|4: _M6502_LABEL(0x2E,4) _SD(_m6502_rol(c,c->AD));_WR();break;
+        case (0x2E<<3)|5: _M6502_LABEL(0x2E,5) _FETCH();break;
+        case (0x2E<<3)|6: _M6502_LABEL(0x2E,6) assert(false);break;
+        case (0x2E<<3)|7: _M6502_LABEL(0x2E,7) assert(false);break;
     /* RLA abs (undoc) */
-        case (0x2F<<3)|0: _SA(c->PC++);break;
-        case (0x2F<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x2F<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x2F<<3)|3: c->AD=_GD();_WR();break;
-        case (0x2F<<3)|4: c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
-        case (0x2F<<3)|5: _FETCH();break;
-        case (0x2F<<3)|6: assert(false);break;
-        case (0x2F<<3)|7: assert(false);break;
+        case (0x2F<<3)|0: _M6502_LABEL(0x2F,0) _SA(c->PC++);break;
+        case (0x2F<<3)|1: _M6502_LABEL(0x2F,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x2F<<3)|2: _M6502_LABEL(0x2F,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x2F<<3)|3: _M6502_LABEL(0x2F,3) c->AD=_GD();_WR();break;
+        case (0x2F<<3)|4: _M6502_LABEL(0x2F,4) c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
+        case (0x2F<<3)|5: _M6502_LABEL(0x2F,5) _FETCH();break;
+        case (0x2F<<3)|6: _M6502_LABEL(0x2F,6) assert(false);break;
+        case (0x2F<<3)|7: _M6502_LABEL(0x2F,7) assert(false);break;
     /* BMI # */
-        case (0x30<<3)|0: _SA(c->PC++);break;
-        case (0x30<<3)|1: _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x80)!=0x80){_FETCH();};break;
-        case (0x30<<3)|2: _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
-        case (0x30<<3)|3: c->PC=c->AD;_FETCH();break;
-        case (0x30<<3)|4: assert(false);break;
-        case (0x30<<3)|5: assert(false);break;
-        case (0x30<<3)|6: assert(false);break;
-        case (0x30<<3)|7: assert(false);break;
+        case (0x30<<3)|0: _M6502_LABEL(0x30,0) _SA(c->PC++);break;
+        case (0x30<<3)|1: _M6502_LABEL(0x30,1) _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x80)!=0x80){_FETCH();};break;
+        case (0x30<<3)|2: _M6502_LABEL(0x30,2) _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
+        case (0x30<<3)|3: _M6502_LABEL(0x30,3) c->PC=c->AD;_FETCH();break;
+        case (0x30<<3)|4: _M6502_LABEL(0x30,4) assert(false);break;
+        case (0x30<<3)|5: _M6502_LABEL(0x30,5) assert(false);break;
+        case (0x30<<3)|6: _M6502_LABEL(0x30,6) assert(false);break;
+        case (0x30<<3)|7: _M6502_LABEL(0x30,7) assert(false);break;
     /* AND (zp),Y */
-        case (0x31<<3)|0: _SA(c->PC++);break;
-        case (0x31<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x31<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x31<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0x31<<3)|4: _SA(c->AD+c->Y);break;
-        case (0x31<<3)|5: c->A&=_GD();_NZ(c->A);_FETCH();break;
-        case (0x31<<3)|6: assert(false);break;
-        case (0x31<<3)|7: assert(false);break;
+        case (0x31<<3)|0: _M6502_LABEL(0x31,0) _SA(c->PC++);break;
+        case (0x31<<3)|1: _M6502_LABEL(0x31,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x31<<3)|2: _M6502_LABEL(0x31,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x31<<3)|3: _M6502_LABEL(0x31,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0x31<<3)|4: _M6502_LABEL(0x31,4) _SA(c->AD+c->Y);break;
+        case (0x31<<3)|5: _M6502_LABEL(0x31,5) c->A&=_GD();_NZ(c->A);_FETCH();break;
+        case (0x31<<3)|6: _M6502_LABEL(0x31,6) assert(false);break;
+        case (0x31<<3)|7: _M6502_LABEL(0x31,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0x32<<3)|0: _SA(c->PC);break;
-        case (0x32<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0x32<<3)|2: assert(false);break;
-        case (0x32<<3)|3: assert(false);break;
-        case (0x32<<3)|4: assert(false);break;
-        case (0x32<<3)|5: assert(false);break;
-        case (0x32<<3)|6: assert(false);break;
-        case (0x32<<3)|7: assert(false);break;
+        case (0x32<<3)|0: _M6502_LABEL(0x32,0) _SA(c->PC);break;
+        case (0x32<<3)|1: _M6502_LABEL(0x32,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0x32<<3)|2: _M6502_LABEL(0x32,2) assert(false);break;
+        case (0x32<<3)|3: _M6502_LABEL(0x32,3) assert(false);break;
+        case (0x32<<3)|4: _M6502_LABEL(0x32,4) assert(false);break;
+        case (0x32<<3)|5: _M6502_LABEL(0x32,5) assert(false);break;
+        case (0x32<<3)|6: _M6502_LABEL(0x32,6) assert(false);break;
+        case (0x32<<3)|7: _M6502_LABEL(0x32,7) assert(false);break;
     /* RLA (zp),Y (undoc) */
-        case (0x33<<3)|0: _SA(c->PC++);break;
-        case (0x33<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x33<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x33<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x33<<3)|4: _SA(c->AD+c->Y);break;
-        case (0x33<<3)|5: c->AD=_GD();_WR();break;
-        case (0x33<<3)|6: c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
-        case (0x33<<3)|7: _FETCH();break;
+        case (0x33<<3)|0: _M6502_LABEL(0x33,0) _SA(c->PC++);break;
+        case (0x33<<3)|1: _M6502_LABEL(0x33,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x33<<3)|2: _M6502_LABEL(0x33,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x33<<3)|3: _M6502_LABEL(0x33,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x33<<3)|4: _M6502_LABEL(0x33,4) _SA(c->AD+c->Y);break;
+        case (0x33<<3)|5: _M6502_LABEL(0x33,5) c->AD=_GD();_WR();break;
+        case (0x33<<3)|6: _M6502_LABEL(0x33,6) c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
+        case (0x33<<3)|7: _M6502_LABEL(0x33,7) _FETCH();break;
     /* NOP zp,X (undoc) */
-        case (0x34<<3)|0: _SA(c->PC++);break;
-        case (0x34<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x34<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x34<<3)|3: _FETCH();break;
-        case (0x34<<3)|4: assert(false);break;
-        case (0x34<<3)|5: assert(false);break;
-        case (0x34<<3)|6: assert(false);break;
-        case (0x34<<3)|7: assert(false);break;
+        case (0x34<<3)|0: _M6502_LABEL(0x34,0) _SA(c->PC++);break;
+        case (0x34<<3)|1: _M6502_LABEL(0x34,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x34<<3)|2: _M6502_LABEL(0x34,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x34<<3)|3: _M6502_LABEL(0x34,3) _FETCH();break;
+        case (0x34<<3)|4: _M6502_LABEL(0x34,4) assert(false);break;
+        case (0x34<<3)|5: _M6502_LABEL(0x34,5) assert(false);break;
+        case (0x34<<3)|6: _M6502_LABEL(0x34,6) assert(false);break;
+        case (0x34<<3)|7: _M6502_LABEL(0x34,7) assert(false);break;
     /* AND zp,X */
-        case (0x35<<3)|0: _SA(c->PC++);break;
-        case (0x35<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x35<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x35<<3)|3: c->A&=_GD();_NZ(c->A);_FETCH();break;
-        case (0x35<<3)|4: assert(false);break;
-        case (0x35<<3)|5: assert(false);break;
-        case (0x35<<3)|6: assert(false);break;
-        case (0x35<<3)|7: assert(false);break;
+        case (0x35<<3)|0: _M6502_LABEL(0x35,0) _SA(c->PC++);break;
+        case (0x35<<3)|1: _M6502_LABEL(0x35,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x35<<3)|2: _M6502_LABEL(0x35,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x35<<3)|3: _M6502_LABEL(0x35,3) c->A&=_GD();_NZ(c->A);_FETCH();break;
+        case (0x35<<3)|4: _M6502_LABEL(0x35,4) assert(false);break;
+        case (0x35<<3)|5: _M6502_LABEL(0x35,5) assert(false);break;
+        case (0x35<<3)|6: _M6502_LABEL(0x35,6) assert(false);break;
+        case (0x35<<3)|7: _M6502_LABEL(0x35,7) assert(false);break;
     /* ROL zp,X */
-        case (0x36<<3)|0: _SA(c->PC++);break;
-        case (0x36<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x36<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x36<<3)|3: c->AD=_GD();_WR();break;
-        case (0x36<<3)|4: _SD(_m6502_rol(c,c->AD));_WR();break;
-        case (0x36<<3)|5: _FETCH();break;
-        case (0x36<<3)|6: assert(false);break;
-        case (0x36<<3)|7: assert(false);break;
+        case (0x36<<3)|0: _M6502_LABEL(0x36,0) _SA(c->PC++);break;
+        case (0x36<<3)|1: _M6502_LABEL(0x36,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x36<<3)|2: _M6502_LABEL(0x36,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x36<<3)|3: _M6502_LABEL(0x36,3) c->AD=_GD();_WR();break;
+        case (0x36<<3)|4: _M6502_LABEL(0x36,4) _SD(_m6502_rol(c,c->AD));_WR();break;
+        case (0x36<<3)|5: _M6502_LABEL(0x36,5) _FETCH();break;
+        case (0x36<<3)|6: _M6502_LABEL(0x36,6) assert(false);break;
+        case (0x36<<3)|7: _M6502_LABEL(0x36,7) assert(false);break;
     /* RLA zp,X (undoc) */
-        case (0x37<<3)|0: _SA(c->PC++);break;
-        case (0x37<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x37<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x37<<3)|3: c->AD=_GD();_WR();break;
-        case (0x37<<3)|4: c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
-        case (0x37<<3)|5: _FETCH();break;
-        case (0x37<<3)|6: assert(false);break;
-        case (0x37<<3)|7: assert(false);break;
+        case (0x37<<3)|0: _M6502_LABEL(0x37,0) _SA(c->PC++);break;
+        case (0x37<<3)|1: _M6502_LABEL(0x37,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x37<<3)|2: _M6502_LABEL(0x37,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x37<<3)|3: _M6502_LABEL(0x37,3) c->AD=_GD();_WR();break;
+        case (0x37<<3)|4: _M6502_LABEL(0x37,4) c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
+        case (0x37<<3)|5: _M6502_LABEL(0x37,5) _FETCH();break;
+        case (0x37<<3)|6: _M6502_LABEL(0x37,6) assert(false);break;
+        case (0x37<<3)|7: _M6502_LABEL(0x37,7) assert(false);break;
     /* SEC  */
-        case (0x38<<3)|0: _SA(c->PC);break;
-        case (0x38<<3)|1: c->P|=0x1;_FETCH();break;
-        case (0x38<<3)|2: assert(false);break;
-        case (0x38<<3)|3: assert(false);break;
-        case (0x38<<3)|4: assert(false);break;
-        case (0x38<<3)|5: assert(false);break;
-        case (0x38<<3)|6: assert(false);break;
-        case (0x38<<3)|7: assert(false);break;
+        case (0x38<<3)|0: _M6502_LABEL(0x38,0) _SA(c->PC);break;
+        case (0x38<<3)|1: _M6502_LABEL(0x38,1) c->P|=0x1;_FETCH();break;
+        case (0x38<<3)|2: _M6502_LABEL(0x38,2) assert(false);break;
+        case (0x38<<3)|3: _M6502_LABEL(0x38,3) assert(false);break;
+        case (0x38<<3)|4: _M6502_LABEL(0x38,4) assert(false);break;
+        case (0x38<<3)|5: _M6502_LABEL(0x38,5) assert(false);break;
+        case (0x38<<3)|6: _M6502_LABEL(0x38,6) assert(false);break;
+        case (0x38<<3)|7: _M6502_LABEL(0x38,7) assert(false);break;
     /* AND abs,Y */
-        case (0x39<<3)|0: _SA(c->PC++);break;
-        case (0x39<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x39<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0x39<<3)|3: _SA(c->AD+c->Y);break;
-        case (0x39<<3)|4: c->A&=_GD();_NZ(c->A);_FETCH();break;
-        case (0x39<<3)|5: assert(false);break;
-        case (0x39<<3)|6: assert(false);break;
-        case (0x39<<3)|7: assert(false);break;
+        case (0x39<<3)|0: _M6502_LABEL(0x39,0) _SA(c->PC++);break;
+        case (0x39<<3)|1: _M6502_LABEL(0x39,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x39<<3)|2: _M6502_LABEL(0x39,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0x39<<3)|3: _M6502_LABEL(0x39,3) _SA(c->AD+c->Y);break;
+        case (0x39<<3)|4: _M6502_LABEL(0x39,4) c->A&=_GD();_NZ(c->A);_FETCH();break;
+        case (0x39<<3)|5: _M6502_LABEL(0x39,5) assert(false);break;
+        case (0x39<<3)|6: _M6502_LABEL(0x39,6) assert(false);break;
+        case (0x39<<3)|7: _M6502_LABEL(0x39,7) assert(false);break;
     /* NOP  (undoc) */
-        case (0x3A<<3)|0: _SA(c->PC);break;
-        case (0x3A<<3)|1: _FETCH();break;
-        case (0x3A<<3)|2: assert(false);break;
-        case (0x3A<<3)|3: assert(false);break;
-        case (0x3A<<3)|4: assert(false);break;
-        case (0x3A<<3)|5: assert(false);break;
-        case (0x3A<<3)|6: assert(false);break;
-        case (0x3A<<3)|7: assert(false);break;
+        case (0x3A<<3)|0: _M6502_LABEL(0x3A,0) _SA(c->PC);break;
+        case (0x3A<<3)|1: _M6502_LABEL(0x3A,1) _FETCH();break;
+        case (0x3A<<3)|2: _M6502_LABEL(0x3A,2) assert(false);break;
+        case (0x3A<<3)|3: _M6502_LABEL(0x3A,3) assert(false);break;
+        case (0x3A<<3)|4: _M6502_LABEL(0x3A,4) assert(false);break;
+        case (0x3A<<3)|5: _M6502_LABEL(0x3A,5) assert(false);break;
+        case (0x3A<<3)|6: _M6502_LABEL(0x3A,6) assert(false);break;
+        case (0x3A<<3)|7: _M6502_LABEL(0x3A,7) assert(false);break;
     /* RLA abs,Y (undoc) */
-        case (0x3B<<3)|0: _SA(c->PC++);break;
-        case (0x3B<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x3B<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x3B<<3)|3: _SA(c->AD+c->Y);break;
-        case (0x3B<<3)|4: c->AD=_GD();_WR();break;
-        case (0x3B<<3)|5: c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
-        case (0x3B<<3)|6: _FETCH();break;
-        case (0x3B<<3)|7: assert(false);break;
+        case (0x3B<<3)|0: _M6502_LABEL(0x3B,0) _SA(c->PC++);break;
+        case (0x3B<<3)|1: _M6502_LABEL(0x3B,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x3B<<3)|2: _M6502_LABEL(0x3B,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x3B<<3)|3: _M6502_LABEL(0x3B,3) _SA(c->AD+c->Y);break;
+        case (0x3B<<3)|4: _M6502_LABEL(0x3B,4) c->AD=_GD();_WR();break;
+        case (0x3B<<3)|5: _M6502_LABEL(0x3B,5) c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
+        case (0x3B<<3)|6: _M6502_LABEL(0x3B,6) _FETCH();break;
+        case (0x3B<<3)|7: _M6502_LABEL(0x3B,7) assert(false);break;
     /* NOP abs,X (undoc) */
-        case (0x3C<<3)|0: _SA(c->PC++);break;
-        case (0x3C<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x3C<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0x3C<<3)|3: _SA(c->AD+c->X);break;
-        case (0x3C<<3)|4: _FETCH();break;
-        case (0x3C<<3)|5: assert(false);break;
-        case (0x3C<<3)|6: assert(false);break;
-        case (0x3C<<3)|7: assert(false);break;
+        case (0x3C<<3)|0: _M6502_LABEL(0x3C,0) _SA(c->PC++);break;
+        case (0x3C<<3)|1: _M6502_LABEL(0x3C,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x3C<<3)|2: _M6502_LABEL(0x3C,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0x3C<<3)|3: _M6502_LABEL(0x3C,3) _SA(c->AD+c->X);break;
+        case (0x3C<<3)|4: _M6502_LABEL(0x3C,4) _FETCH();break;
+        case (0x3C<<3)|5: _M6502_LABEL(0x3C,5) assert(false);break;
+        case (0x3C<<3)|6: _M6502_LABEL(0x3C,6) assert(false);break;
+        case (0x3C<<3)|7: _M6502_LABEL(0x3C,7) assert(false);break;
     /* AND abs,X */
-        case (0x3D<<3)|0: _SA(c->PC++);break;
-        case (0x3D<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x3D<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0x3D<<3)|3: _SA(c->AD+c->X);break;
-        case (0x3D<<3)|4: c->A&=_GD();_NZ(c->A);_FETCH();break;
-        case (0x3D<<3)|5: assert(false);break;
-        case (0x3D<<3)|6: assert(false);break;
-        case (0x3D<<3)|7: assert(false);break;
+        case (0x3D<<3)|0: _M6502_LABEL(0x3D,0) _SA(c->PC++);break;
+        case (0x3D<<3)|1: _M6502_LABEL(0x3D,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x3D<<3)|2: _M6502_LABEL(0x3D,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0x3D<<3)|3: _M6502_LABEL(0x3D,3) _SA(c->AD+c->X);break;
+        case (0x3D<<3)|4: _M6502_LABEL(0x3D,4) c->A&=_GD();_NZ(c->A);_FETCH();break;
+        case (0x3D<<3)|5: _M6502_LABEL(0x3D,5) assert(false);break;
+        case (0x3D<<3)|6: _M6502_LABEL(0x3D,6) assert(false);break;
+        case (0x3D<<3)|7: _M6502_LABEL(0x3D,7) assert(false);break;
     /* ROL abs,X */
-        case (0x3E<<3)|0: _SA(c->PC++);break;
-        case (0x3E<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x3E<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0x3E<<3)|3: _SA(c->AD+c->X);break;
-        case (0x3E<<3)|4: c->AD=_GD();_WR();break;
-        case (0x3E<<3)|5: _SD(_m6502_rol(c,c->AD));_WR();break;
-        case (0x3E<<3)|6: _FETCH();break;
-        case (0x3E<<3)|7: assert(false);break;
+        case (0x3E<<3)|0: _M6502_LABEL(0x3E,0) _SA(c->PC++);break;
+        case (0x3E<<3)|1: _M6502_LABEL(0x3E,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x3E<<3)|2: _M6502_LABEL(0x3E,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0x3E<<3)|3: _M6502_LABEL(0x3E,3) _SA(c->AD+c->X);break;
+        case (0x3E<<3)|4: _M6502_LABEL(0x3E,4) c->AD=_GD();_WR();break;
+        case (0x3E<<3)|5: _M6502_LABEL(0x3E,5) _SD(_m6502_rol(c,c->AD));_WR();break;
+        case (0x3E<<3)|6: _M6502_LABEL(0x3E,6) _FETCH();break;
+        case (0x3E<<3)|7: _M6502_LABEL(0x3E,7) assert(false);break;
     /* RLA abs,X (undoc) */
-        case (0x3F<<3)|0: _SA(c->PC++);break;
-        case (0x3F<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x3F<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0x3F<<3)|3: _SA(c->AD+c->X);break;
-        case (0x3F<<3)|4: c->AD=_GD();_WR();break;
-        case (0x3F<<3)|5: c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
-        case (0x3F<<3)|6: _FETCH();break;
-        case (0x3F<<3)|7: assert(false);break;
+        case (0x3F<<3)|0: _M6502_LABEL(0x3F,0) _SA(c->PC++);break;
+        case (0x3F<<3)|1: _M6502_LABEL(0x3F,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x3F<<3)|2: _M6502_LABEL(0x3F,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0x3F<<3)|3: _M6502_LABEL(0x3F,3) _SA(c->AD+c->X);break;
+        case (0x3F<<3)|4: _M6502_LABEL(0x3F,4) c->AD=_GD();_WR();break;
+        case (0x3F<<3)|5: _M6502_LABEL(0x3F,5) c->AD=_m6502_rol(c,c->AD);_SD(c->AD);c->A&=c->AD;_NZ(c->A);_WR();break;
+        case (0x3F<<3)|6: _M6502_LABEL(0x3F,6) _FETCH();break;
+        case (0x3F<<3)|7: _M6502_LABEL(0x3F,7) assert(false);break;
     /* RTI  */
-        case (0x40<<3)|0: _SA(c->PC);break;
-        case (0x40<<3)|1: _SA(0x0100|c->S++);break;
-        case (0x40<<3)|2: _SA(0x0100|c->S++);break;
-        case (0x40<<3)|3: _SA(0x0100|c->S++);c->P=(_GD()|M6502_BF)&~M6502_XF;break;
-        case (0x40<<3)|4: _SA(0x0100|c->S);c->AD=_GD();break;
-        case (0x40<<3)|5: c->PC=(_GD()<<8)|c->AD;_FETCH();break;
-        case (0x40<<3)|6: assert(false);break;
-        case (0x40<<3)|7: assert(false);break;
+        case (0x40<<3)|0: _M6502_LABEL(0x40,0) _SA(c->PC);break;
+        case (0x40<<3)|1: _M6502_LABEL(0x40,1) _SA(0x0100|c->S++);break;
+        case (0x40<<3)|2: _M6502_LABEL(0x40,2) _SA(0x0100|c->S++);break;
+        case (0x40<<3)|3: _M6502_LABEL(0x40,3) _SA(0x0100|c->S++);c->P=(_GD()|M6502_BF)&~M6502_XF;break;
+        case (0x40<<3)|4: _M6502_LABEL(0x40,4) _SA(0x0100|c->S);c->AD=_GD();break;
+        case (0x40<<3)|5: _M6502_LABEL(0x40,5) c->PC=(_GD()<<8)|c->AD;_FETCH();break;
+        case (0x40<<3)|6: _M6502_LABEL(0x40,6) assert(false);break;
+        case (0x40<<3)|7: _M6502_LABEL(0x40,7) assert(false);break;
     /* EOR (zp,X) */
-        case (0x41<<3)|0: _SA(c->PC++);break;
-        case (0x41<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x41<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0x41<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x41<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0x41<<3)|5: c->A^=_GD();_NZ(c->A);_FETCH();break;
-        case (0x41<<3)|6: assert(false);break;
-        case (0x41<<3)|7: assert(false);break;
+        case (0x41<<3)|0: _M6502_LABEL(0x41,0) _SA(c->PC++);break;
+        case (0x41<<3)|1: _M6502_LABEL(0x41,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x41<<3)|2: _M6502_LABEL(0x41,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0x41<<3)|3: _M6502_LABEL(0x41,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x41<<3)|4: _M6502_LABEL(0x41,4) _SA((_GD()<<8)|c->AD);break;
+        case (0x41<<3)|5: _M6502_LABEL(0x41,5) c->A^=_GD();_NZ(c->A);_FETCH();break;
+        case (0x41<<3)|6: _M6502_LABEL(0x41,6) assert(false);break;
+        case (0x41<<3)|7: _M6502_LABEL(0x41,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0x42<<3)|0: _SA(c->PC);break;
-        case (0x42<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0x42<<3)|2: assert(false);break;
-        case (0x42<<3)|3: assert(false);break;
-        case (0x42<<3)|4: assert(false);break;
-        case (0x42<<3)|5: assert(false);break;
-        case (0x42<<3)|6: assert(false);break;
-        case (0x42<<3)|7: assert(false);break;
+        case (0x42<<3)|0: _M6502_LABEL(0x42,0) _SA(c->PC);break;
+        case (0x42<<3)|1: _M6502_LABEL(0x42,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0x42<<3)|2: _M6502_LABEL(0x42,2) assert(false);break;
+        case (0x42<<3)|3: _M6502_LABEL(0x42,3) assert(false);break;
+        case (0x42<<3)|4: _M6502_LABEL(0x42,4) assert(false);break;
+        case (0x42<<3)|5: _M6502_LABEL(0x42,5) assert(false);break;
+        case (0x42<<3)|6: _M6502_LABEL(0x42,6) assert(false);break;
+        case (0x42<<3)|7: _M6502_LABEL(0x42,7) assert(false);break;
     /* SRE (zp,X) (undoc) */
-        case (0x43<<3)|0: _SA(c->PC++);break;
-        case (0x43<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x43<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0x43<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x43<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0x43<<3)|5: c->AD=_GD();_WR();break;
-        case (0x43<<3)|6: c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
-        case (0x43<<3)|7: _FETCH();break;
+        case (0x43<<3)|0: _M6502_LABEL(0x43,0) _SA(c->PC++);break;
+        case (0x43<<3)|1: _M6502_LABEL(0x43,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x43<<3)|2: _M6502_LABEL(0x43,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0x43<<3)|3: _M6502_LABEL(0x43,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x43<<3)|4: _M6502_LABEL(0x43,4) _SA((_GD()<<8)|c->AD);break;
+        case (0x43<<3)|5: _M6502_LABEL(0x43,5) c->AD=_GD();_WR();break;
+        case (0x43<<3)|6: _M6502_LABEL(0x43,6) c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
+        case (0x43<<3)|7: _M6502_LABEL(0x43,7) _FETCH();break;
     /* NOP zp (undoc) */
-        case (0x44<<3)|0: _SA(c->PC++);break;
-        case (0x44<<3)|1: _SA(_GD());break;
-        case (0x44<<3)|2: _FETCH();break;
-        case (0x44<<3)|3: assert(false);break;
-        case (0x44<<3)|4: assert(false);break;
-        case (0x44<<3)|5: assert(false);break;
-        case (0x44<<3)|6: assert(false);break;
-        case (0x44<<3)|7: assert(false);break;
+        case (0x44<<3)|0: _M6502_LABEL(0x44,0) _SA(c->PC++);break;
+        case (0x44<<3)|1: _M6502_LABEL(0x44,1) _SA(_GD());break;
+        case (0x44<<3)|2: _M6502_LABEL(0x44,2) _FETCH();break;
+        case (0x44<<3)|3: _M6502_LABEL(0x44,3) assert(false);break;
+        case (0x44<<3)|4: _M6502_LABEL(0x44,4) assert(false);break;
+        case (0x44<<3)|5: _M6502_LABEL(0x44,5) assert(false);break;
+        case (0x44<<3)|6: _M6502_LABEL(0x44,6) assert(false);break;
+        case (0x44<<3)|7: _M6502_LABEL(0x44,7) assert(false);break;
     /* EOR zp */
-        case (0x45<<3)|0: _SA(c->PC++);break;
-        case (0x45<<3)|1: _SA(_GD());break;
-        case (0x45<<3)|2: c->A^=_GD();_NZ(c->A);_FETCH();break;
-        case (0x45<<3)|3: assert(false);break;
-        case (0x45<<3)|4: assert(false);break;
-        case (0x45<<3)|5: assert(false);break;
-        case (0x45<<3)|6: assert(false);break;
-        case (0x45<<3)|7: assert(false);break;
+        case (0x45<<3)|0: _M6502_LABEL(0x45,0) _SA(c->PC++);break;
+        case (0x45<<3)|1: _M6502_LABEL(0x45,1) _SA(_GD());break;
+        case (0x45<<3)|2: _M6502_LABEL(0x45,2) c->A^=_GD();_NZ(c->A);_FETCH();break;
+        case (0x45<<3)|3: _M6502_LABEL(0x45,3) assert(false);break;
+        case (0x45<<3)|4: _M6502_LABEL(0x45,4) assert(false);break;
+        case (0x45<<3)|5: _M6502_LABEL(0x45,5) assert(false);break;
+        case (0x45<<3)|6: _M6502_LABEL(0x45,6) assert(false);break;
+        case (0x45<<3)|7: _M6502_LABEL(0x45,7) assert(false);break;
     /* LSR zp */
-        case (0x46<<3)|0: _SA(c->PC++);break;
-        case (0x46<<3)|1: _SA(_GD());break;
-        case (0x46<<3)|2: c->AD=_GD();_WR();break;
-        case (0x46<<3)|3: _SD(_m6502_lsr(c,c->AD));_WR();break;
-        case (0x46<<3)|4: _FETCH();break;
-        case (0x46<<3)|5: assert(false);break;
-        case (0x46<<3)|6: assert(false);break;
-        case (0x46<<3)|7: assert(false);break;
+        case (0x46<<3)|0: _M6502_LABEL(0x46,0) _SA(c->PC++);break;
+        case (0x46<<3)|1: _M6502_LABEL(0x46,1) _SA(_GD());break;
+        case (0x46<<3)|2: _M6502_LABEL(0x46,2) c->AD=_GD();_WR();break;
+        case (0x46<<3)|3: _M6502_LABEL(0x46,3) _SD(_m6502_lsr(c,c->AD));_WR();break;
+        case (0x46<<3)|4: _M6502_LABEL(0x46,4) _FETCH();break;
+        case (0x46<<3)|5: _M6502_LABEL(0x46,5) assert(false);break;
+        case (0x46<<3)|6: _M6502_LABEL(0x46,6) assert(false);break;
+        case (0x46<<3)|7: _M6502_LABEL(0x46,7) assert(false);break;
     /* SRE zp (undoc) */
-        case (0x47<<3)|0: _SA(c->PC++);break;
-        case (0x47<<3)|1: _SA(_GD());break;
-        case (0x47<<3)|2: c->AD=_GD();_WR();break;
-        case (0x47<<3)|3: c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
-        case (0x47<<3)|4: _FETCH();break;
-        case (0x47<<3)|5: assert(false);break;
-        case (0x47<<3)|6: assert(false);break;
-        case (0x47<<3)|7: assert(false);break;
+        case (0x47<<3)|0: _M6502_LABEL(0x47,0) _SA(c->PC++);break;
+        case (0x47<<3)|1: _M6502_LABEL(0x47,1) _SA(_GD());break;
+        case (0x47<<3)|2: _M6502_LABEL(0x47,2) c->AD=_GD();_WR();break;
+        case (0x47<<3)|3: _M6502_LABEL(0x47,3) c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
+        case (0x47<<3)|4: _M6502_LABEL(0x47,4) _FETCH();break;
+        case (0x47<<3)|5: _M6502_LABEL(0x47,5) assert(false);break;
+        case (0x47<<3)|6: _M6502_LABEL(0x47,6) assert(false);break;
+        case (0x47<<3)|7: _M6502_LABEL(0x47,7) assert(false);break;
     /* PHA  */
-        case (0x48<<3)|0: _SA(c->PC);break;
-        case (0x48<<3)|1: _SAD(0x0100|c->S--,c->A);_WR();break;
-        case (0x48<<3)|2: _FETCH();break;
-        case (0x48<<3)|3: assert(false);break;
-        case (0x48<<3)|4: assert(false);break;
-        case (0x48<<3)|5: assert(false);break;
-        case (0x48<<3)|6: assert(false);break;
-        case (0x48<<3)|7: assert(false);break;
+        case (0x48<<3)|0: _M6502_LABEL(0x48,0) _SA(c->PC);break;
+        case (0x48<<3)|1: _M6502_LABEL(0x48,1) _SAD(0x0100|c->S--,c->A);_WR();break;
+        case (0x48<<3)|2: _M6502_LABEL(0x48,2) _FETCH();break;
+        case (0x48<<3)|3: _M6502_LABEL(0x48,3) assert(false);break;
+        case (0x48<<3)|4: _M6502_LABEL(0x48,4) assert(false);break;
+        case (0x48<<3)|5: _M6502_LABEL(0x48,5) assert(false);break;
+        case (0x48<<3)|6: _M6502_LABEL(0x48,6) assert(false);break;
+        case (0x48<<3)|7: _M6502_LABEL(0x48,7) assert(false);break;
     /* EOR # */
-        case (0x49<<3)|0: _SA(c->PC++);break;
-        case (0x49<<3)|1: c->A^=_GD();_NZ(c->A);_FETCH();break;
-        case (0x49<<3)|2: assert(false);break;
-        case (0x49<<3)|3: assert(false);break;
-        case (0x49<<3)|4: assert(false);break;
-        case (0x49<<3)|5: assert(false);break;
-        case (0x49<<3)|6: assert(false);break;
-        case (0x49<<3)|7: assert(false);break;
+        case (0x49<<3)|0: _M6502_LABEL(0x49,0) _SA(c->PC++);break;
+        case (0x49<<3)|1: _M6502_LABEL(0x49,1) c->A^=_GD();_NZ(c->A);_FETCH();break;
+        case (0x49<<3)|2: _M6502_LABEL(0x49,2) assert(false);break;
+        case (0x49<<3)|3: _M6502_LABEL(0x49,3) assert(false);break;
+        case (0x49<<3)|4: _M6502_LABEL(0x49,4) assert(false);break;
+        case (0x49<<3)|5: _M6502_LABEL(0x49,5) assert(false);break;
+        case (0x49<<3)|6: _M6502_LABEL(0x49,6) assert(false);break;
+        case (0x49<<3)|7: _M6502_LABEL(0x49,7) assert(false);break;
     /* LSRA  */
-        case (0x4A<<3)|0: _SA(c->PC);break;
-        case (0x4A<<3)|1: c->A=_m6502_lsr(c,c->A);_FETCH();break;
-        case (0x4A<<3)|2: assert(false);break;
-        case (0x4A<<3)|3: assert(false);break;
-        case (0x4A<<3)|4: assert(false);break;
-        case (0x4A<<3)|5: assert(false);break;
-        case (0x4A<<3)|6: assert(false);break;
-        case (0x4A<<3)|7: assert(false);break;
+        case (0x4A<<3)|0: _M6502_LABEL(0x4A,0) _SA(c->PC);break;
+        case (0x4A<<3)|1: _M6502_LABEL(0x4A,1) c->A=_m6502_lsr(c,c->A);_FETCH();break;
+        case (0x4A<<3)|2: _M6502_LABEL(0x4A,2) assert(false);break;
+        case (0x4A<<3)|3: _M6502_LABEL(0x4A,3) assert(false);break;
+        case (0x4A<<3)|4: _M6502_LABEL(0x4A,4) assert(false);break;
+        case (0x4A<<3)|5: _M6502_LABEL(0x4A,5) assert(false);break;
+        case (0x4A<<3)|6: _M6502_LABEL(0x4A,6) assert(false);break;
+        case (0x4A<<3)|7: _M6502_LABEL(0x4A,7) assert(false);break;
     /* ASR # (undoc) */
-        case (0x4B<<3)|0: _SA(c->PC++);break;
-        case (0x4B<<3)|1: c->A&=_GD();c->A=_m6502_lsr(c,c->A);_FETCH();break;
-        case (0x4B<<3)|2: assert(false);break;
-        case (0x4B<<3)|3: assert(false);break;
-        case (0x4B<<3)|4: assert(false);break;
-        case (0x4B<<3)|5: assert(false);break;
-        case (0x4B<<3)|6: assert(false);break;
-        case (0x4B<<3)|7: assert(false);break;
+        case (0x4B<<3)|0: _M6502_LABEL(0x4B,0) _SA(c->PC++);break;
+        case (0x4B<<3)|1: _M6502_LABEL(0x4B,1) c->A&=_GD();c->A=_m6502_lsr(c,c->A);_FETCH();break;
+        case (0x4B<<3)|2: _M6502_LABEL(0x4B,2) assert(false);break;
+        case (0x4B<<3)|3: _M6502_LABEL(0x4B,3) assert(false);break;
+        case (0x4B<<3)|4: _M6502_LABEL(0x4B,4) assert(false);break;
+        case (0x4B<<3)|5: _M6502_LABEL(0x4B,5) assert(false);break;
+        case (0x4B<<3)|6: _M6502_LABEL(0x4B,6) assert(false);break;
+        case (0x4B<<3)|7: _M6502_LABEL(0x4B,7) assert(false);break;
     /* JMP  */
-        case (0x4C<<3)|0: _SA(c->PC++);break;
-        case (0x4C<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x4C<<3)|2: c->PC=(_GD()<<8)|c->AD;_FETCH();break;
-        case (0x4C<<3)|3: assert(false);break;
-        case (0x4C<<3)|4: assert(false);break;
-        case (0x4C<<3)|5: assert(false);break;
-        case (0x4C<<3)|6: assert(false);break;
-        case (0x4C<<3)|7: assert(false);break;
+        case (0x4C<<3)|0: _M6502_LABEL(0x4C,0) _SA(c->PC++);break;
+        case (0x4C<<3)|1: _M6502_LABEL(0x4C,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x4C<<3)|2: _M6502_LABEL(0x4C,2) c->PC=(_GD()<<8)|c->AD;_FETCH();break;
+        case (0x4C<<3)|3: _M6502_LABEL(0x4C,3) assert(false);break;
+        case (0x4C<<3)|4: _M6502_LABEL(0x4C,4) assert(false);break;
+        case (0x4C<<3)|5: _M6502_LABEL(0x4C,5) assert(false);break;
+        case (0x4C<<3)|6: _M6502_LABEL(0x4C,6) assert(false);break;
+        case (0x4C<<3)|7: _M6502_LABEL(0x4C,7) assert(false);break;
     /* EOR abs */
-        case (0x4D<<3)|0: _SA(c->PC++);break;
-        case (0x4D<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x4D<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x4D<<3)|3: c->A^=_GD();_NZ(c->A);_FETCH();break;
-        case (0x4D<<3)|4: assert(false);break;
-        case (0x4D<<3)|5: assert(false);break;
-        case (0x4D<<3)|6: assert(false);break;
-        case (0x4D<<3)|7: assert(false);break;
+        case (0x4D<<3)|0: _M6502_LABEL(0x4D,0) _SA(c->PC++);break;
+        case (0x4D<<3)|1: _M6502_LABEL(0x4D,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x4D<<3)|2: _M6502_LABEL(0x4D,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x4D<<3)|3: _M6502_LABEL(0x4D,3) c->A^=_GD();_NZ(c->A);_FETCH();break;
+        case (0x4D<<3)|4: _M6502_LABEL(0x4D,4) assert(false);break;
+        case (0x4D<<3)|5: _M6502_LABEL(0x4D,5) assert(false);break;
+        case (0x4D<<3)|6: _M6502_LABEL(0x4D,6) assert(false);break;
+        case (0x4D<<3)|7: _M6502_LABEL(0x4D,7) assert(false);break;
     /* LSR abs */
-        case (0x4E<<3)|0: _SA(c->PC++);break;
-        case (0x4E<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x4E<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x4E<<3)|3: c->AD=_GD();_WR();break;
-        case (0x4E<<3)|4: _SD(_m6502_lsr(c,c->AD));_WR();break;
-        case (0x4E<<3)|5: _FETCH();break;
-        case (0x4E<<3)|6: assert(false);break;
-        case (0x4E<<3)|7: assert(false);break;
+        case (0x4E<<3)|0: _M6502_LABEL(0x4E,0) _SA(c->PC++);break;
+        case (0x4E<<3)|1: _M6502_LABEL(0x4E,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x4E<<3)|2: _M6502_LABEL(0x4E,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x4E<<3)|3: _M6502_LABEL(0x4E,3) c->AD=_GD();_WR();break;
+        case (0x4E<<3)|4: _M6502_LABEL(0x4E,4) _SD(_m6502_lsr(c,c->AD));_WR();break;
+        case (0x4E<<3)|5: _M6502_LABEL(0x4E,5) _FETCH();break;
+        case (0x4E<<3)|6: _M6502_LABEL(0x4E,6) assert(false);break;
+        case (0x4E<<3)|7: _M6502_LABEL(0x4E,7) assert(false);break;
     /* SRE abs (undoc) */
-        case (0x4F<<3)|0: _SA(c->PC++);break;
-        case (0x4F<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x4F<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x4F<<3)|3: c->AD=_GD();_WR();break;
-        case (0x4F<<3)|4: c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
-        case (0x4F<<3)|5: _FETCH();break;
-        case (0x4F<<3)|6: assert(false);break;
-        case (0x4F<<3)|7: assert(false);break;
+        case (0x4F<<3)|0: _M6502_LABEL(0x4F,0) _SA(c->PC++);break;
+        case (0x4F<<3)|1: _M6502_LABEL(0x4F,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x4F<<3)|2: _M6502_LABEL(0x4F,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x4F<<3)|3: _M6502_LABEL(0x4F,3) c->AD=_GD();_WR();break;
+        case (0x4F<<3)|4: _M6502_LABEL(0x4F,4) c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
+        case (0x4F<<3)|5: _M6502_LABEL(0x4F,5) _FETCH();break;
+        case (0x4F<<3)|6: _M6502_LABEL(0x4F,6) assert(false);break;
+        case (0x4F<<3)|7: _M6502_LABEL(0x4F,7) assert(false);break;
     /* BVC # */
-        case (0x50<<3)|0: _SA(c->PC++);break;
-        case (0x50<<3)|1: _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x40)!=0x0){_FETCH();};break;
-        case (0x50<<3)|2: _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
-        case (0x50<<3)|3: c->PC=c->AD;_FETCH();break;
-        case (0x50<<3)|4: assert(false);break;
-        case (0x50<<3)|5: assert(false);break;
-        case (0x50<<3)|6: assert(false);break;
-        case (0x50<<3)|7: assert(false);break;
+        case (0x50<<3)|0: _M6502_LABEL(0x50,0) _SA(c->PC++);break;
+        case (0x50<<3)|1: _M6502_LABEL(0x50,1) _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x40)!=0x0){_FETCH();};break;
+        case (0x50<<3)|2: _M6502_LABEL(0x50,2) _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
+        case (0x50<<3)|3: _M6502_LABEL(0x50,3) c->PC=c->AD;_FETCH();break;
+        case (0x50<<3)|4: _M6502_LABEL(0x50,4) assert(false);break;
+        case (0x50<<3)|5: _M6502_LABEL(0x50,5) assert(false);break;
+        case (0x50<<3)|6: _M6502_LABEL(0x50,6) assert(false);break;
+        case (0x50<<3)|7: _M6502_LABEL(0x50,7) assert(false);break;
     /* EOR (zp),Y */
-        case (0x51<<3)|0: _SA(c->PC++);break;
-        case (0x51<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x51<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x51<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0x51<<3)|4: _SA(c->AD+c->Y);break;
-        case (0x51<<3)|5: c->A^=_GD();_NZ(c->A);_FETCH();break;
-        case (0x51<<3)|6: assert(false);break;
-        case (0x51<<3)|7: assert(false);break;
+        case (0x51<<3)|0: _M6502_LABEL(0x51,0) _SA(c->PC++);break;
+        case (0x51<<3)|1: _M6502_LABEL(0x51,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x51<<3)|2: _M6502_LABEL(0x51,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x51<<3)|3: _M6502_LABEL(0x51,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0x51<<3)|4: _M6502_LABEL(0x51,4) _SA(c->AD+c->Y);break;
+        case (0x51<<3)|5: _M6502_LABEL(0x51,5) c->A^=_GD();_NZ(c->A);_FETCH();break;
+        case (0x51<<3)|6: _M6502_LABEL(0x51,6) assert(false);break;
+        case (0x51<<3)|7: _M6502_LABEL(0x51,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0x52<<3)|0: _SA(c->PC);break;
-        case (0x52<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0x52<<3)|2: assert(false);break;
-        case (0x52<<3)|3: assert(false);break;
-        case (0x52<<3)|4: assert(false);break;
-        case (0x52<<3)|5: assert(false);break;
-        case (0x52<<3)|6: assert(false);break;
-        case (0x52<<3)|7: assert(false);break;
+        case (0x52<<3)|0: _M6502_LABEL(0x52,0) _SA(c->PC);break;
+        case (0x52<<3)|1: _M6502_LABEL(0x52,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0x52<<3)|2: _M6502_LABEL(0x52,2) assert(false);break;
+        case (0x52<<3)|3: _M6502_LABEL(0x52,3) assert(false);break;
+        case (0x52<<3)|4: _M6502_LABEL(0x52,4) assert(false);break;
+        case (0x52<<3)|5: _M6502_LABEL(0x52,5) assert(false);break;
+        case (0x52<<3)|6: _M6502_LABEL(0x52,6) assert(false);break;
+        case (0x52<<3)|7: _M6502_LABEL(0x52,7) assert(false);break;
     /* SRE (zp),Y (undoc) */
-        case (0x53<<3)|0: _SA(c->PC++);break;
-        case (0x53<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x53<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x53<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x53<<3)|4: _SA(c->AD+c->Y);break;
-        case (0x53<<3)|5: c->AD=_GD();_WR();break;
-        case (0x53<<3)|6: c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
-        case (0x53<<3)|7: _FETCH();break;
+        case (0x53<<3)|0: _M6502_LABEL(0x53,0) _SA(c->PC++);break;
+        case (0x53<<3)|1: _M6502_LABEL(0x53,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x53<<3)|2: _M6502_LABEL(0x53,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x53<<3)|3: _M6502_LABEL(0x53,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x53<<3)|4: _M6502_LABEL(0x53,4) _SA(c->AD+c->Y);break;
+        case (0x53<<3)|5: _M6502_LABEL(0x53,5) c->AD=_GD();_WR();break;
+        case (0x53<<3)|6: _M6502_LABEL(0x53,6) c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
+        case (0x53<<3)|7: _M6502_LABEL(0x53,7) _FETCH();break;
     /* NOP zp,X (undoc) */
-        case (0x54<<3)|0: _SA(c->PC++);break;
-        case (0x54<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x54<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x54<<3)|3: _FETCH();break;
-        case (0x54<<3)|4: assert(false);break;
-        case (0x54<<3)|5: assert(false);break;
-        case (0x54<<3)|6: assert(false);break;
-        case (0x54<<3)|7: assert(false);break;
+        case (0x54<<3)|0: _M6502_LABEL(0x54,0) _SA(c->PC++);break;
+        case (0x54<<3)|1: _M6502_LABEL(0x54,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x54<<3)|2: _M6502_LABEL(0x54,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x54<<3)|3: _M6502_LABEL(0x54,3) _FETCH();break;
+        case (0x54<<3)|4: _M6502_LABEL(0x54,4) assert(false);break;
+        case (0x54<<3)|5: _M6502_LABEL(0x54,5) assert(false);break;
+        case (0x54<<3)|6: _M6502_LABEL(0x54,6) assert(false);break;
+        case (0x54<<3)|7: _M6502_LABEL(0x54,7) assert(false);break;
     /* EOR zp,X */
-        case (0x55<<3)|0: _SA(c->PC++);break;
-        case (0x55<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x55<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x55<<3)|3: c->A^=_GD();_NZ(c->A);_FETCH();break;
-        case (0x55<<3)|4: assert(false);break;
-        case (0x55<<3)|5: assert(false);break;
-        case (0x55<<3)|6: assert(false);break;
-        case (0x55<<3)|7: assert(false);break;
+        case (0x55<<3)|0: _M6502_LABEL(0x55,0) _SA(c->PC++);break;
+        case (0x55<<3)|1: _M6502_LABEL(0x55,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x55<<3)|2: _M6502_LABEL(0x55,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x55<<3)|3: _M6502_LABEL(0x55,3) c->A^=_GD();_NZ(c->A);_FETCH();break;
+        case (0x55<<3)|4: _M6502_LABEL(0x55,4) assert(false);break;
+        case (0x55<<3)|5: _M6502_LABEL(0x55,5) assert(false);break;
+        case (0x55<<3)|6: _M6502_LABEL(0x55,6) assert(false);break;
+        case (0x55<<3)|7: _M6502_LABEL(0x55,7) assert(false);break;
     /* LSR zp,X */
-        case (0x56<<3)|0: _SA(c->PC++);break;
-        case (0x56<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x56<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x56<<3)|3: c->AD=_GD();_WR();break;
-        case (0x56<<3)|4: _SD(_m6502_lsr(c,c->AD));_WR();break;
-        case (0x56<<3)|5: _FETCH();break;
-        case (0x56<<3)|6: assert(false);break;
-        case (0x56<<3)|7: assert(false);break;
+        case (0x56<<3)|0: _M6502_LABEL(0x56,0) _SA(c->PC++);break;
+        case (0x56<<3)|1: _M6502_LABEL(0x56,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x56<<3)|2: _M6502_LABEL(0x56,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x56<<3)|3: _M6502_LABEL(0x56,3) c->AD=_GD();_WR();break;
+        case (0x56<<3)|4: _M6502_LABEL(0x56,4) _SD(_m6502_lsr(c,c->AD));_WR();break;
+        case (0x56<<3)|5: _M6502_LABEL(0x56,5) _FETCH();break;
+        case (0x56<<3)|6: _M6502_LABEL(0x56,6) assert(false);break;
+        case (0x56<<3)|7: _M6502_LABEL(0x56,7) assert(false);break;
     /* SRE zp,X (undoc) */
-        case (0x57<<3)|0: _SA(c->PC++);break;
-        case (0x57<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x57<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x57<<3)|3: c->AD=_GD();_WR();break;
-        case (0x57<<3)|4: c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
-        case (0x57<<3)|5: _FETCH();break;
-        case (0x57<<3)|6: assert(false);break;
-        case (0x57<<3)|7: assert(false);break;
+        case (0x57<<3)|0: _M6502_LABEL(0x57,0) _SA(c->PC++);break;
+        case (0x57<<3)|1: _M6502_LABEL(0x57,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x57<<3)|2: _M6502_LABEL(0x57,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x57<<3)|3: _M6502_LABEL(0x57,3) c->AD=_GD();_WR();break;
+        case (0x57<<3)|4: _M6502_LABEL(0x57,4) c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
+        case (0x57<<3)|5: _M6502_LABEL(0x57,5) _FETCH();break;
+        case (0x57<<3)|6: _M6502_LABEL(0x57,6) assert(false);break;
+        case (0x57<<3)|7: _M6502_LABEL(0x57,7) assert(false);break;
     /* CLI  */
-        case (0x58<<3)|0: _SA(c->PC);break;
-        case (0x58<<3)|1: c->P&=~0x4;_FETCH();break;
-        case (0x58<<3)|2: assert(false);break;
-        case (0x58<<3)|3: assert(false);break;
-        case (0x58<<3)|4: assert(false);break;
-        case (0x58<<3)|5: assert(false);break;
-        case (0x58<<3)|6: assert(false);break;
-        case (0x58<<3)|7: assert(false);break;
+        case (0x58<<3)|0: _M6502_LABEL(0x58,0) _SA(c->PC);break;
+        case (0x58<<3)|1: _M6502_LABEL(0x58,1) c->P&=~0x4;_FETCH();break;
+        case (0x58<<3)|2: _M6502_LABEL(0x58,2) assert(false);break;
+        case (0x58<<3)|3: _M6502_LABEL(0x58,3) assert(false);break;
+        case (0x58<<3)|4: _M6502_LABEL(0x58,4) assert(false);break;
+        case (0x58<<3)|5: _M6502_LABEL(0x58,5) assert(false);break;
+        case (0x58<<3)|6: _M6502_LABEL(0x58,6) assert(false);break;
+        case (0x58<<3)|7: _M6502_LABEL(0x58,7) assert(false);break;
     /* EOR abs,Y */
-        case (0x59<<3)|0: _SA(c->PC++);break;
-        case (0x59<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x59<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0x59<<3)|3: _SA(c->AD+c->Y);break;
-        case (0x59<<3)|4: c->A^=_GD();_NZ(c->A);_FETCH();break;
-        case (0x59<<3)|5: assert(false);break;
-        case (0x59<<3)|6: assert(false);break;
-        case (0x59<<3)|7: assert(false);break;
+        case (0x59<<3)|0: _M6502_LABEL(0x59,0) _SA(c->PC++);break;
+        case (0x59<<3)|1: _M6502_LABEL(0x59,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x59<<3)|2: _M6502_LABEL(0x59,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0x59<<3)|3: _M6502_LABEL(0x59,3) _SA(c->AD+c->Y);break;
+        case (0x59<<3)|4: _M6502_LABEL(0x59,4) c->A^=_GD();_NZ(c->A);_FETCH();break;
+        case (0x59<<3)|5: _M6502_LABEL(0x59,5) assert(false);break;
+        case (0x59<<3)|6: _M6502_LABEL(0x59,6) assert(false);break;
+        case (0x59<<3)|7: _M6502_LABEL(0x59,7) assert(false);break;
     /* NOP  (undoc) */
-        case (0x5A<<3)|0: _SA(c->PC);break;
-        case (0x5A<<3)|1: _FETCH();break;
-        case (0x5A<<3)|2: assert(false);break;
-        case (0x5A<<3)|3: assert(false);break;
-        case (0x5A<<3)|4: assert(false);break;
-        case (0x5A<<3)|5: assert(false);break;
-        case (0x5A<<3)|6: assert(false);break;
-        case (0x5A<<3)|7: assert(false);break;
+        case (0x5A<<3)|0: _M6502_LABEL(0x5A,0) _SA(c->PC);break;
+        case (0x5A<<3)|1: _M6502_LABEL(0x5A,1) _FETCH();break;
+        case (0x5A<<3)|2: _M6502_LABEL(0x5A,2) assert(false);break;
+        case (0x5A<<3)|3: _M6502_LABEL(0x5A,3) assert(false);break;
+        case (0x5A<<3)|4: _M6502_LABEL(0x5A,4) assert(false);break;
+        case (0x5A<<3)|5: _M6502_LABEL(0x5A,5) assert(false);break;
+        case (0x5A<<3)|6: _M6502_LABEL(0x5A,6) assert(false);break;
+        case (0x5A<<3)|7: _M6502_LABEL(0x5A,7) assert(false);break;
     /* SRE abs,Y (undoc) */
-        case (0x5B<<3)|0: _SA(c->PC++);break;
-        case (0x5B<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x5B<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x5B<<3)|3: _SA(c->AD+c->Y);break;
-        case (0x5B<<3)|4: c->AD=_GD();_WR();break;
-        case (0x5B<<3)|5: c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
-        case (0x5B<<3)|6: _FETCH();break;
-        case (0x5B<<3)|7: assert(false);break;
+        case (0x5B<<3)|0: _M6502_LABEL(0x5B,0) _SA(c->PC++);break;
+        case (0x5B<<3)|1: _M6502_LABEL(0x5B,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x5B<<3)|2: _M6502_LABEL(0x5B,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x5B<<3)|3: _M6502_LABEL(0x5B,3) _SA(c->AD+c->Y);break;
+        case (0x5B<<3)|4: _M6502_LABEL(0x5B,4) c->AD=_GD();_WR();break;
+        case (0x5B<<3)|5: _M6502_LABEL(0x5B,5) c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
+        case (0x5B<<3)|6: _M6502_LABEL(0x5B,6) _FETCH();break;
+        case (0x5B<<3)|7: _M6502_LABEL(0x5B,7) assert(false);break;
     /* NOP abs,X (undoc) */
-        case (0x5C<<3)|0: _SA(c->PC++);break;
-        case (0x5C<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x5C<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0x5C<<3)|3: _SA(c->AD+c->X);break;
-        case (0x5C<<3)|4: _FETCH();break;
-        case (0x5C<<3)|5: assert(false);break;
-        case (0x5C<<3)|6: assert(false);break;
-        case (0x5C<<3)|7: assert(false);break;
+        case (0x5C<<3)|0: _M6502_LABEL(0x5C,0) _SA(c->PC++);break;
+        case (0x5C<<3)|1: _M6502_LABEL(0x5C,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x5C<<3)|2: _M6502_LABEL(0x5C,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0x5C<<3)|3: _M6502_LABEL(0x5C,3) _SA(c->AD+c->X);break;
+        case (0x5C<<3)|4: _M6502_LABEL(0x5C,4) _FETCH();break;
+        case (0x5C<<3)|5: _M6502_LABEL(0x5C,5) assert(false);break;
+        case (0x5C<<3)|6: _M6502_LABEL(0x5C,6) assert(false);break;
+        case (0x5C<<3)|7: _M6502_LABEL(0x5C,7) assert(false);break;
     /* EOR abs,X */
-        case (0x5D<<3)|0: _SA(c->PC++);break;
-        case (0x5D<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x5D<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0x5D<<3)|3: _SA(c->AD+c->X);break;
-        case (0x5D<<3)|4: c->A^=_GD();_NZ(c->A);_FETCH();break;
-        case (0x5D<<3)|5: assert(false);break;
-        case (0x5D<<3)|6: assert(false);break;
-        case (0x5D<<3)|7: assert(false);break;
+        case (0x5D<<3)|0: _M6502_LABEL(0x5D,0) _SA(c->PC++);break;
+        case (0x5D<<3)|1: _M6502_LABEL(0x5D,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x5D<<3)|2: _M6502_LABEL(0x5D,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0x5D<<3)|3: _M6502_LABEL(0x5D,3) _SA(c->AD+c->X);break;
+        case (0x5D<<3)|4: _M6502_LABEL(0x5D,4) c->A^=_GD();_NZ(c->A);_FETCH();break;
+        case (0x5D<<3)|5: _M6502_LABEL(0x5D,5) assert(false);break;
+        case (0x5D<<3)|6: _M6502_LABEL(0x5D,6) assert(false);break;
+        case (0x5D<<3)|7: _M6502_LABEL(0x5D,7) assert(false);break;
     /* LSR abs,X */
-        case (0x5E<<3)|0: _SA(c->PC++);break;
-        case (0x5E<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x5E<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0x5E<<3)|3: _SA(c->AD+c->X);break;
-        case (0x5E<<3)|4: c->AD=_GD();_WR();break;
-        case (0x5E<<3)|5: _SD(_m6502_lsr(c,c->AD));_WR();break;
-        case (0x5E<<3)|6: _FETCH();break;
-        case (0x5E<<3)|7: assert(false);break;
+        case (0x5E<<3)|0: _M6502_LABEL(0x5E,0) _SA(c->PC++);break;
+        case (0x5E<<3)|1: _M6502_LABEL(0x5E,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x5E<<3)|2: _M6502_LABEL(0x5E,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0x5E<<3)|3: _M6502_LABEL(0x5E,3) _SA(c->AD+c->X);break;
+        case (0x5E<<3)|4: _M6502_LABEL(0x5E,4) c->AD=_GD();_WR();break;
+        case (0x5E<<3)|5: _M6502_LABEL(0x5E,5) _SD(_m6502_lsr(c,c->AD));_WR();break;
+        case (0x5E<<3)|6: _M6502_LABEL(0x5E,6) _FETCH();break;
+        case (0x5E<<3)|7: _M6502_LABEL(0x5E,7) assert(false);break;
     /* SRE abs,X (undoc) */
-        case (0x5F<<3)|0: _SA(c->PC++);break;
-        case (0x5F<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x5F<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0x5F<<3)|3: _SA(c->AD+c->X);break;
-        case (0x5F<<3)|4: c->AD=_GD();_WR();break;
-        case (0x5F<<3)|5: c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
-        case (0x5F<<3)|6: _FETCH();break;
-        case (0x5F<<3)|7: assert(false);break;
+        case (0x5F<<3)|0: _M6502_LABEL(0x5F,0) _SA(c->PC++);break;
+        case (0x5F<<3)|1: _M6502_LABEL(0x5F,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x5F<<3)|2: _M6502_LABEL(0x5F,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0x5F<<3)|3: _M6502_LABEL(0x5F,3) _SA(c->AD+c->X);break;
+        case (0x5F<<3)|4: _M6502_LABEL(0x5F,4) c->AD=_GD();_WR();break;
+        case (0x5F<<3)|5: _M6502_LABEL(0x5F,5) c->AD=_m6502_lsr(c,c->AD);_SD(c->AD);c->A^=c->AD;_NZ(c->A);_WR();break;
+        case (0x5F<<3)|6: _M6502_LABEL(0x5F,6) _FETCH();break;
+        case (0x5F<<3)|7: _M6502_LABEL(0x5F,7) assert(false);break;
     /* RTS  */
-        case (0x60<<3)|0: _SA(c->PC);break;
-        case (0x60<<3)|1: _SA(0x0100|c->S++);break;
-        case (0x60<<3)|2: _SA(0x0100|c->S++);break;
-        case (0x60<<3)|3: _SA(0x0100|c->S);c->AD=_GD();break;
-        case (0x60<<3)|4: c->PC=(_GD()<<8)|c->AD;_SA(c->PC++);break;
-        case (0x60<<3)|5: _FETCH();break;
-        case (0x60<<3)|6: assert(false);break;
-        case (0x60<<3)|7: assert(false);break;
+        case (0x60<<3)|0: _M6502_LABEL(0x60,0) _SA(c->PC);break;
+        case (0x60<<3)|1: _M6502_LABEL(0x60,1) _SA(0x0100|c->S++);break;
+        case (0x60<<3)|2: _M6502_LABEL(0x60,2) _SA(0x0100|c->S++);break;
+        case (0x60<<3)|3: _M6502_LABEL(0x60,3) _SA(0x0100|c->S);c->AD=_GD();break;
+        case (0x60<<3)|4: _M6502_LABEL(0x60,4) c->PC=(_GD()<<8)|c->AD;_SA(c->PC++);break;
+        case (0x60<<3)|5: _M6502_LABEL(0x60,5) _FETCH();break;
+        case (0x60<<3)|6: _M6502_LABEL(0x60,6) assert(false);break;
+        case (0x60<<3)|7: _M6502_LABEL(0x60,7) assert(false);break;
     /* ADC (zp,X) */
-        case (0x61<<3)|0: _SA(c->PC++);break;
-        case (0x61<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x61<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0x61<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x61<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0x61<<3)|5: _m6502_adc(c,_GD());_FETCH();break;
-        case (0x61<<3)|6: assert(false);break;
-        case (0x61<<3)|7: assert(false);break;
+        case (0x61<<3)|0: _M6502_LABEL(0x61,0) _SA(c->PC++);break;
+        case (0x61<<3)|1: _M6502_LABEL(0x61,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x61<<3)|2: _M6502_LABEL(0x61,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0x61<<3)|3: _M6502_LABEL(0x61,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x61<<3)|4: _M6502_LABEL(0x61,4) _SA((_GD()<<8)|c->AD);break;
+        case (0x61<<3)|5: _M6502_LABEL(0x61,5) _m6502_adc(c,_GD());_FETCH();break;
+        case (0x61<<3)|6: _M6502_LABEL(0x61,6) assert(false);break;
+        case (0x61<<3)|7: _M6502_LABEL(0x61,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0x62<<3)|0: _SA(c->PC);break;
-        case (0x62<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0x62<<3)|2: assert(false);break;
-        case (0x62<<3)|3: assert(false);break;
-        case (0x62<<3)|4: assert(false);break;
-        case (0x62<<3)|5: assert(false);break;
-        case (0x62<<3)|6: assert(false);break;
-        case (0x62<<3)|7: assert(false);break;
+        case (0x62<<3)|0: _M6502_LABEL(0x62,0) _SA(c->PC);break;
+        case (0x62<<3)|1: _M6502_LABEL(0x62,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0x62<<3)|2: _M6502_LABEL(0x62,2) assert(false);break;
+        case (0x62<<3)|3: _M6502_LABEL(0x62,3) assert(false);break;
+        case (0x62<<3)|4: _M6502_LABEL(0x62,4) assert(false);break;
+        case (0x62<<3)|5: _M6502_LABEL(0x62,5) assert(false);break;
+        case (0x62<<3)|6: _M6502_LABEL(0x62,6) assert(false);break;
+        case (0x62<<3)|7: _M6502_LABEL(0x62,7) assert(false);break;
     /* RRA (zp,X) (undoc) */
-        case (0x63<<3)|0: _SA(c->PC++);break;
-        case (0x63<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x63<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0x63<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x63<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0x63<<3)|5: c->AD=_GD();_WR();break;
-        case (0x63<<3)|6: c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
-        case (0x63<<3)|7: _FETCH();break;
+        case (0x63<<3)|0: _M6502_LABEL(0x63,0) _SA(c->PC++);break;
+        case (0x63<<3)|1: _M6502_LABEL(0x63,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x63<<3)|2: _M6502_LABEL(0x63,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0x63<<3)|3: _M6502_LABEL(0x63,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x63<<3)|4: _M6502_LABEL(0x63,4) _SA((_GD()<<8)|c->AD);break;
+        case (0x63<<3)|5: _M6502_LABEL(0x63,5) c->AD=_GD();_WR();break;
+        case (0x63<<3)|6: _M6502_LABEL(0x63,6) c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
+        case (0x63<<3)|7: _M6502_LABEL(0x63,7) _FETCH();break;
     /* NOP zp (undoc) */
-        case (0x64<<3)|0: _SA(c->PC++);break;
-        case (0x64<<3)|1: _SA(_GD());break;
-        case (0x64<<3)|2: _FETCH();break;
-        case (0x64<<3)|3: assert(false);break;
-        case (0x64<<3)|4: assert(false);break;
-        case (0x64<<3)|5: assert(false);break;
-        case (0x64<<3)|6: assert(false);break;
-        case (0x64<<3)|7: assert(false);break;
+        case (0x64<<3)|0: _M6502_LABEL(0x64,0) _SA(c->PC++);break;
+        case (0x64<<3)|1: _M6502_LABEL(0x64,1) _SA(_GD());break;
+        case (0x64<<3)|2: _M6502_LABEL(0x64,2) _FETCH();break;
+        case (0x64<<3)|3: _M6502_LABEL(0x64,3) assert(false);break;
+        case (0x64<<3)|4: _M6502_LABEL(0x64,4) assert(false);break;
+        case (0x64<<3)|5: _M6502_LABEL(0x64,5) assert(false);break;
+        case (0x64<<3)|6: _M6502_LABEL(0x64,6) assert(false);break;
+        case (0x64<<3)|7: _M6502_LABEL(0x64,7) assert(false);break;
     /* ADC zp */
-        case (0x65<<3)|0: _SA(c->PC++);break;
-        case (0x65<<3)|1: _SA(_GD());break;
-        case (0x65<<3)|2: _m6502_adc(c,_GD());_FETCH();break;
-        case (0x65<<3)|3: assert(false);break;
-        case (0x65<<3)|4: assert(false);break;
-        case (0x65<<3)|5: assert(false);break;
-        case (0x65<<3)|6: assert(false);break;
-        case (0x65<<3)|7: assert(false);break;
+        case (0x65<<3)|0: _M6502_LABEL(0x65,0) _SA(c->PC++);break;
+        case (0x65<<3)|1: _M6502_LABEL(0x65,1) _SA(_GD());break;
+        case (0x65<<3)|2: _M6502_LABEL(0x65,2) _m6502_adc(c,_GD());_FETCH();break;
+        case (0x65<<3)|3: _M6502_LABEL(0x65,3) assert(false);break;
+        case (0x65<<3)|4: _M6502_LABEL(0x65,4) assert(false);break;
+        case (0x65<<3)|5: _M6502_LABEL(0x65,5) assert(false);break;
+        case (0x65<<3)|6: _M6502_LABEL(0x65,6) assert(false);break;
+        case (0x65<<3)|7: _M6502_LABEL(0x65,7) assert(false);break;
     /* ROR zp */
-        case (0x66<<3)|0: _SA(c->PC++);break;
-        case (0x66<<3)|1: _SA(_GD());break;
-        case (0x66<<3)|2: c->AD=_GD();_WR();break;
-        case (0x66<<3)|3: _SD(_m6502_ror(c,c->AD));_WR();break;
-        case (0x66<<3)|4: _FETCH();break;
-        case (0x66<<3)|5: assert(false);break;
-        case (0x66<<3)|6: assert(false);break;
-        case (0x66<<3)|7: assert(false);break;
+        case (0x66<<3)|0: _M6502_LABEL(0x66,0) _SA(c->PC++);break;
+        case (0x66<<3)|1: _M6502_LABEL(0x66,1) _SA(_GD());break;
+        case (0x66<<3)|2: _M6502_LABEL(0x66,2) c->AD=_GD();_WR();break;
+        case (0x66<<3)|3: _M6502_LABEL(0x66,3) _SD(_m6502_ror(c,c->AD));_WR();break;
+        case (0x66<<3)|4: _M6502_LABEL(0x66,4) _FETCH();break;
+        case (0x66<<3)|5: _M6502_LABEL(0x66,5) assert(false);break;
+        case (0x66<<3)|6: _M6502_LABEL(0x66,6) assert(false);break;
+        case (0x66<<3)|7: _M6502_LABEL(0x66,7) assert(false);break;
     /* RRA zp (undoc) */
-        case (0x67<<3)|0: _SA(c->PC++);break;
-        case (0x67<<3)|1: _SA(_GD());break;
-        case (0x67<<3)|2: c->AD=_GD();_WR();break;
-        case (0x67<<3)|3: c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
-        case (0x67<<3)|4: _FETCH();break;
-        case (0x67<<3)|5: assert(false);break;
-        case (0x67<<3)|6: assert(false);break;
-        case (0x67<<3)|7: assert(false);break;
+        case (0x67<<3)|0: _M6502_LABEL(0x67,0) _SA(c->PC++);break;
+        case (0x67<<3)|1: _M6502_LABEL(0x67,1) _SA(_GD());break;
+        case (0x67<<3)|2: _M6502_LABEL(0x67,2) c->AD=_GD();_WR();break;
+        case (0x67<<3)|3: _M6502_LABEL(0x67,3) c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
+        case (0x67<<3)|4: _M6502_LABEL(0x67,4) _FETCH();break;
+        case (0x67<<3)|5: _M6502_LABEL(0x67,5) assert(false);break;
+        case (0x67<<3)|6: _M6502_LABEL(0x67,6) assert(false);break;
+        case (0x67<<3)|7: _M6502_LABEL(0x67,7) assert(false);break;
     /* PLA  */
-        case (0x68<<3)|0: _SA(c->PC);break;
-        case (0x68<<3)|1: _SA(0x0100|c->S++);break;
-        case (0x68<<3)|2: _SA(0x0100|c->S);break;
-        case (0x68<<3)|3: c->A=_GD();_NZ(c->A);_FETCH();break;
-        case (0x68<<3)|4: assert(false);break;
-        case (0x68<<3)|5: assert(false);break;
-        case (0x68<<3)|6: assert(false);break;
-        case (0x68<<3)|7: assert(false);break;
+        case (0x68<<3)|0: _M6502_LABEL(0x68,0) _SA(c->PC);break;
+        case (0x68<<3)|1: _M6502_LABEL(0x68,1) _SA(0x0100|c->S++);break;
+        case (0x68<<3)|2: _M6502_LABEL(0x68,2) _SA(0x0100|c->S);break;
+        case (0x68<<3)|3: _M6502_LABEL(0x68,3) c->A=_GD();_NZ(c->A);_FETCH();break;
+        case (0x68<<3)|4: _M6502_LABEL(0x68,4) assert(false);break;
+        case (0x68<<3)|5: _M6502_LABEL(0x68,5) assert(false);break;
+        case (0x68<<3)|6: _M6502_LABEL(0x68,6) assert(false);break;
+        case (0x68<<3)|7: _M6502_LABEL(0x68,7) assert(false);break;
     /* ADC # */
-        case (0x69<<3)|0: _SA(c->PC++);break;
-        case (0x69<<3)|1: _m6502_adc(c,_GD());_FETCH();break;
-        case (0x69<<3)|2: assert(false);break;
-        case (0x69<<3)|3: assert(false);break;
-        case (0x69<<3)|4: assert(false);break;
-        case (0x69<<3)|5: assert(false);break;
-        case (0x69<<3)|6: assert(false);break;
-        case (0x69<<3)|7: assert(false);break;
+        case (0x69<<3)|0: _M6502_LABEL(0x69,0) _SA(c->PC++);break;
+        case (0x69<<3)|1: _M6502_LABEL(0x69,1) _m6502_adc(c,_GD());_FETCH();break;
+        case (0x69<<3)|2: _M6502_LABEL(0x69,2) assert(false);break;
+        case (0x69<<3)|3: _M6502_LABEL(0x69,3) assert(false);break;
+        case (0x69<<3)|4: _M6502_LABEL(0x69,4) assert(false);break;
+        case (0x69<<3)|5: _M6502_LABEL(0x69,5) assert(false);break;
+        case (0x69<<3)|6: _M6502_LABEL(0x69,6) assert(false);break;
+        case (0x69<<3)|7: _M6502_LABEL(0x69,7) assert(false);break;
     /* RORA  */
-        case (0x6A<<3)|0: _SA(c->PC);break;
-        case (0x6A<<3)|1: c->A=_m6502_ror(c,c->A);_FETCH();break;
-        case (0x6A<<3)|2: assert(false);break;
-        case (0x6A<<3)|3: assert(false);break;
-        case (0x6A<<3)|4: assert(false);break;
-        case (0x6A<<3)|5: assert(false);break;
-        case (0x6A<<3)|6: assert(false);break;
-        case (0x6A<<3)|7: assert(false);break;
+        case (0x6A<<3)|0: _M6502_LABEL(0x6A,0) _SA(c->PC);break;
+        case (0x6A<<3)|1: _M6502_LABEL(0x6A,1) c->A=_m6502_ror(c,c->A);_FETCH();break;
+        case (0x6A<<3)|2: _M6502_LABEL(0x6A,2) assert(false);break;
+        case (0x6A<<3)|3: _M6502_LABEL(0x6A,3) assert(false);break;
+        case (0x6A<<3)|4: _M6502_LABEL(0x6A,4) assert(false);break;
+        case (0x6A<<3)|5: _M6502_LABEL(0x6A,5) assert(false);break;
+        case (0x6A<<3)|6: _M6502_LABEL(0x6A,6) assert(false);break;
+        case (0x6A<<3)|7: _M6502_LABEL(0x6A,7) assert(false);break;
     /* ARR # (undoc) */
-        case (0x6B<<3)|0: _SA(c->PC++);break;
-        case (0x6B<<3)|1: c->A&=_GD();_m6502_arr(c);_FETCH();break;
-        case (0x6B<<3)|2: assert(false);break;
-        case (0x6B<<3)|3: assert(false);break;
-        case (0x6B<<3)|4: assert(false);break;
-        case (0x6B<<3)|5: assert(false);break;
-        case (0x6B<<3)|6: assert(false);break;
-        case (0x6B<<3)|7: assert(false);break;
+        case (0x6B<<3)|0: _M6502_LABEL(0x6B,0) _SA(c->PC++);break;
+        case (0x6B<<3)|1: _M6502_LABEL(0x6B,1) c->A&=_GD();_m6502_arr(c);_FETCH();break;
+        case (0x6B<<3)|2: _M6502_LABEL(0x6B,2) assert(false);break;
+        case (0x6B<<3)|3: _M6502_LABEL(0x6B,3) assert(false);break;
+        case (0x6B<<3)|4: _M6502_LABEL(0x6B,4) assert(false);break;
+        case (0x6B<<3)|5: _M6502_LABEL(0x6B,5) assert(false);break;
+        case (0x6B<<3)|6: _M6502_LABEL(0x6B,6) assert(false);break;
+        case (0x6B<<3)|7: _M6502_LABEL(0x6B,7) assert(false);break;
     /* JMPI  */
-        case (0x6C<<3)|0: _SA(c->PC++);break;
-        case (0x6C<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x6C<<3)|2: c->AD|=_GD()<<8;_SA(c->AD);break;
-        case (0x6C<<3)|3: _SA((c->AD&0xFF00)|((c->AD+1)&0x00FF));c->AD=_GD();break;
-        case (0x6C<<3)|4: c->PC=(_GD()<<8)|c->AD;_FETCH();break;
-        case (0x6C<<3)|5: assert(false);break;
-        case (0x6C<<3)|6: assert(false);break;
-        case (0x6C<<3)|7: assert(false);break;
+        case (0x6C<<3)|0: _M6502_LABEL(0x6C,0) _SA(c->PC++);break;
+        case (0x6C<<3)|1: _M6502_LABEL(0x6C,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x6C<<3)|2: _M6502_LABEL(0x6C,2) c->AD|=_GD()<<8;_SA(c->AD);break;
+        case (0x6C<<3)|3: _M6502_LABEL(0x6C,3) _SA((c->AD&0xFF00)|((c->AD+1)&0x00FF));c->AD=_GD();break;
+        case (0x6C<<3)|4: _M6502_LABEL(0x6C,4) c->PC=(_GD()<<8)|c->AD;_FETCH();break;
+        case (0x6C<<3)|5: _M6502_LABEL(0x6C,5) assert(false);break;
+        case (0x6C<<3)|6: _M6502_LABEL(0x6C,6) assert(false);break;
+        case (0x6C<<3)|7: _M6502_LABEL(0x6C,7) assert(false);break;
     /* ADC abs */
-        case (0x6D<<3)|0: _SA(c->PC++);break;
-        case (0x6D<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x6D<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x6D<<3)|3: _m6502_adc(c,_GD());_FETCH();break;
-        case (0x6D<<3)|4: assert(false);break;
-        case (0x6D<<3)|5: assert(false);break;
-        case (0x6D<<3)|6: assert(false);break;
-        case (0x6D<<3)|7: assert(false);break;
+        case (0x6D<<3)|0: _M6502_LABEL(0x6D,0) _SA(c->PC++);break;
+        case (0x6D<<3)|1: _M6502_LABEL(0x6D,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x6D<<3)|2: _M6502_LABEL(0x6D,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x6D<<3)|3: _M6502_LABEL(0x6D,3) _m6502_adc(c,_GD());_FETCH();break;
+        case (0x6D<<3)|4: _M6502_LABEL(0x6D,4) assert(false);break;
+        case (0x6D<<3)|5: _M6502_LABEL(0x6D,5) assert(false);break;
+        case (0x6D<<3)|6: _M6502_LABEL(0x6D,6) assert(false);break;
+        case (0x6D<<3)|7: _M6502_LABEL(0x6D,7) assert(false);break;
     /* ROR abs */
-        case (0x6E<<3)|0: _SA(c->PC++);break;
-        case (0x6E<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x6E<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x6E<<3)|3: c->AD=_GD();_WR();break;
-        case (0x6E<<3)|4: _SD(_m6502_ror(c,c->AD));_WR();break;
-        case (0x6E<<3)|5: _FETCH();break;
-        case (0x6E<<3)|6: assert(false);break;
-        case (0x6E<<3)|7: assert(false);break;
+        case (0x6E<<3)|0: _M6502_LABEL(0x6E,0) _SA(c->PC++);break;
+        case (0x6E<<3)|1: _M6502_LABEL(0x6E,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x6E<<3)|2: _M6502_LABEL(0x6E,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x6E<<3)|3: _M6502_LABEL(0x6E,3) c->AD=_GD();_WR();break;
+        case (0x6E<<3)|4: _M6502_LABEL(0x6E,4) _SD(_m6502_ror(c,c->AD));_WR();break;
+        case (0x6E<<3)|5: _M6502_LABEL(0x6E,5) _FETCH();break;
+        case (0x6E<<3)|6: _M6502_LABEL(0x6E,6) assert(false);break;
+        case (0x6E<<3)|7: _M6502_LABEL(0x6E,7) assert(false);break;
     /* RRA abs (undoc) */
-        case (0x6F<<3)|0: _SA(c->PC++);break;
-        case (0x6F<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x6F<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0x6F<<3)|3: c->AD=_GD();_WR();break;
-        case (0x6F<<3)|4: c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
-        case (0x6F<<3)|5: _FETCH();break;
-        case (0x6F<<3)|6: assert(false);break;
-        case (0x6F<<3)|7: assert(false);break;
+        case (0x6F<<3)|0: _M6502_LABEL(0x6F,0) _SA(c->PC++);break;
+        case (0x6F<<3)|1: _M6502_LABEL(0x6F,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x6F<<3)|2: _M6502_LABEL(0x6F,2) _SA((_GD()<<8)|c->AD);break;
+        case (0x6F<<3)|3: _M6502_LABEL(0x6F,3) c->AD=_GD();_WR();break;
+        case (0x6F<<3)|4: _M6502_LABEL(0x6F,4) c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
+        case (0x6F<<3)|5: _M6502_LABEL(0x6F,5) _FETCH();break;
+        case (0x6F<<3)|6: _M6502_LABEL(0x6F,6) assert(false);break;
+        case (0x6F<<3)|7: _M6502_LABEL(0x6F,7) assert(false);break;
     /* BVS # */
-        case (0x70<<3)|0: _SA(c->PC++);break;
-        case (0x70<<3)|1: _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x40)!=0x40){_FETCH();};break;
-        case (0x70<<3)|2: _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
-        case (0x70<<3)|3: c->PC=c->AD;_FETCH();break;
-        case (0x70<<3)|4: assert(false);break;
-        case (0x70<<3)|5: assert(false);break;
-        case (0x70<<3)|6: assert(false);break;
-        case (0x70<<3)|7: assert(false);break;
+        case (0x70<<3)|0: _M6502_LABEL(0x70,0) _SA(c->PC++);break;
+        case (0x70<<3)|1: _M6502_LABEL(0x70,1) _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x40)!=0x40){_FETCH();};break;
+        case (0x70<<3)|2: _M6502_LABEL(0x70,2) _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
+        case (0x70<<3)|3: _M6502_LABEL(0x70,3) c->PC=c->AD;_FETCH();break;
+        case (0x70<<3)|4: _M6502_LABEL(0x70,4) assert(false);break;
+        case (0x70<<3)|5: _M6502_LABEL(0x70,5) assert(false);break;
+        case (0x70<<3)|6: _M6502_LABEL(0x70,6) assert(false);break;
+        case (0x70<<3)|7: _M6502_LABEL(0x70,7) assert(false);break;
     /* ADC (zp),Y */
-        case (0x71<<3)|0: _SA(c->PC++);break;
-        case (0x71<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x71<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x71<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0x71<<3)|4: _SA(c->AD+c->Y);break;
-        case (0x71<<3)|5: _m6502_adc(c,_GD());_FETCH();break;
-        case (0x71<<3)|6: assert(false);break;
-        case (0x71<<3)|7: assert(false);break;
+        case (0x71<<3)|0: _M6502_LABEL(0x71,0) _SA(c->PC++);break;
+        case (0x71<<3)|1: _M6502_LABEL(0x71,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x71<<3)|2: _M6502_LABEL(0x71,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x71<<3)|3: _M6502_LABEL(0x71,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0x71<<3)|4: _M6502_LABEL(0x71,4) _SA(c->AD+c->Y);break;
+        case (0x71<<3)|5: _M6502_LABEL(0x71,5) _m6502_adc(c,_GD());_FETCH();break;
+        case (0x71<<3)|6: _M6502_LABEL(0x71,6) assert(false);break;
+        case (0x71<<3)|7: _M6502_LABEL(0x71,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0x72<<3)|0: _SA(c->PC);break;
-        case (0x72<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0x72<<3)|2: assert(false);break;
-        case (0x72<<3)|3: assert(false);break;
-        case (0x72<<3)|4: assert(false);break;
-        case (0x72<<3)|5: assert(false);break;
-        case (0x72<<3)|6: assert(false);break;
-        case (0x72<<3)|7: assert(false);break;
+        case (0x72<<3)|0: _M6502_LABEL(0x72,0) _SA(c->PC);break;
+        case (0x72<<3)|1: _M6502_LABEL(0x72,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0x72<<3)|2: _M6502_LABEL(0x72,2) assert(false);break;
+        case (0x72<<3)|3: _M6502_LABEL(0x72,3) assert(false);break;
+        case (0x72<<3)|4: _M6502_LABEL(0x72,4) assert(false);break;
+        case (0x72<<3)|5: _M6502_LABEL(0x72,5) assert(false);break;
+        case (0x72<<3)|6: _M6502_LABEL(0x72,6) assert(false);break;
+        case (0x72<<3)|7: _M6502_LABEL(0x72,7) assert(false);break;
     /* RRA (zp),Y (undoc) */
-        case (0x73<<3)|0: _SA(c->PC++);break;
-        case (0x73<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x73<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x73<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x73<<3)|4: _SA(c->AD+c->Y);break;
-        case (0x73<<3)|5: c->AD=_GD();_WR();break;
-        case (0x73<<3)|6: c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
-        case (0x73<<3)|7: _FETCH();break;
+        case (0x73<<3)|0: _M6502_LABEL(0x73,0) _SA(c->PC++);break;
+        case (0x73<<3)|1: _M6502_LABEL(0x73,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x73<<3)|2: _M6502_LABEL(0x73,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x73<<3)|3: _M6502_LABEL(0x73,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x73<<3)|4: _M6502_LABEL(0x73,4) _SA(c->AD+c->Y);break;
+        case (0x73<<3)|5: _M6502_LABEL(0x73,5) c->AD=_GD();_WR();break;
+        case (0x73<<3)|6: _M6502_LABEL(0x73,6) c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
+        case (0x73<<3)|7: _M6502_LABEL(0x73,7) _FETCH();break;
     /* NOP zp,X (undoc) */
-        case (0x74<<3)|0: _SA(c->PC++);break;
-        case (0x74<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x74<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x74<<3)|3: _FETCH();break;
-        case (0x74<<3)|4: assert(false);break;
-        case (0x74<<3)|5: assert(false);break;
-        case (0x74<<3)|6: assert(false);break;
-        case (0x74<<3)|7: assert(false);break;
+        case (0x74<<3)|0: _M6502_LABEL(0x74,0) _SA(c->PC++);break;
+        case (0x74<<3)|1: _M6502_LABEL(0x74,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x74<<3)|2: _M6502_LABEL(0x74,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x74<<3)|3: _M6502_LABEL(0x74,3) _FETCH();break;
+        case (0x74<<3)|4: _M6502_LABEL(0x74,4) assert(false);break;
+        case (0x74<<3)|5: _M6502_LABEL(0x74,5) assert(false);break;
+        case (0x74<<3)|6: _M6502_LABEL(0x74,6) assert(false);break;
+        case (0x74<<3)|7: _M6502_LABEL(0x74,7) assert(false);break;
     /* ADC zp,X */
-        case (0x75<<3)|0: _SA(c->PC++);break;
-        case (0x75<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x75<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x75<<3)|3: _m6502_adc(c,_GD());_FETCH();break;
-        case (0x75<<3)|4: assert(false);break;
-        case (0x75<<3)|5: assert(false);break;
-        case (0x75<<3)|6: assert(false);break;
-        case (0x75<<3)|7: assert(false);break;
+        case (0x75<<3)|0: _M6502_LABEL(0x75,0) _SA(c->PC++);break;
+        case (0x75<<3)|1: _M6502_LABEL(0x75,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x75<<3)|2: _M6502_LABEL(0x75,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x75<<3)|3: _M6502_LABEL(0x75,3) _m6502_adc(c,_GD());_FETCH();break;
+        case (0x75<<3)|4: _M6502_LABEL(0x75,4) assert(false);break;
+        case (0x75<<3)|5: _M6502_LABEL(0x75,5) assert(false);break;
+        case (0x75<<3)|6: _M6502_LABEL(0x75,6) assert(false);break;
+        case (0x75<<3)|7: _M6502_LABEL(0x75,7) assert(false);break;
     /* ROR zp,X */
-        case (0x76<<3)|0: _SA(c->PC++);break;
-        case (0x76<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x76<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x76<<3)|3: c->AD=_GD();_WR();break;
-        case (0x76<<3)|4: _SD(_m6502_ror(c,c->AD));_WR();break;
-        case (0x76<<3)|5: _FETCH();break;
-        case (0x76<<3)|6: assert(false);break;
-        case (0x76<<3)|7: assert(false);break;
+        case (0x76<<3)|0: _M6502_LABEL(0x76,0) _SA(c->PC++);break;
+        case (0x76<<3)|1: _M6502_LABEL(0x76,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x76<<3)|2: _M6502_LABEL(0x76,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x76<<3)|3: _M6502_LABEL(0x76,3) c->AD=_GD();_WR();break;
+        case (0x76<<3)|4: _M6502_LABEL(0x76,4) _SD(_m6502_ror(c,c->AD));_WR();break;
+        case (0x76<<3)|5: _M6502_LABEL(0x76,5) _FETCH();break;
+        case (0x76<<3)|6: _M6502_LABEL(0x76,6) assert(false);break;
+        case (0x76<<3)|7: _M6502_LABEL(0x76,7) assert(false);break;
     /* RRA zp,X (undoc) */
-        case (0x77<<3)|0: _SA(c->PC++);break;
-        case (0x77<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x77<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0x77<<3)|3: c->AD=_GD();_WR();break;
-        case (0x77<<3)|4: c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
-        case (0x77<<3)|5: _FETCH();break;
-        case (0x77<<3)|6: assert(false);break;
-        case (0x77<<3)|7: assert(false);break;
+        case (0x77<<3)|0: _M6502_LABEL(0x77,0) _SA(c->PC++);break;
+        case (0x77<<3)|1: _M6502_LABEL(0x77,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x77<<3)|2: _M6502_LABEL(0x77,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0x77<<3)|3: _M6502_LABEL(0x77,3) c->AD=_GD();_WR();break;
+        case (0x77<<3)|4: _M6502_LABEL(0x77,4) c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
+        case (0x77<<3)|5: _M6502_LABEL(0x77,5) _FETCH();break;
+        case (0x77<<3)|6: _M6502_LABEL(0x77,6) assert(false);break;
+        case (0x77<<3)|7: _M6502_LABEL(0x77,7) assert(false);break;
     /* SEI  */
-        case (0x78<<3)|0: _SA(c->PC);break;
-        case (0x78<<3)|1: c->P|=0x4;_FETCH();break;
-        case (0x78<<3)|2: assert(false);break;
-        case (0x78<<3)|3: assert(false);break;
-        case (0x78<<3)|4: assert(false);break;
-        case (0x78<<3)|5: assert(false);break;
-        case (0x78<<3)|6: assert(false);break;
-        case (0x78<<3)|7: assert(false);break;
+        case (0x78<<3)|0: _M6502_LABEL(0x78,0) _SA(c->PC);break;
+        case (0x78<<3)|1: _M6502_LABEL(0x78,1) c->P|=0x4;_FETCH();break;
+        case (0x78<<3)|2: _M6502_LABEL(0x78,2) assert(false);break;
+        case (0x78<<3)|3: _M6502_LABEL(0x78,3) assert(false);break;
+        case (0x78<<3)|4: _M6502_LABEL(0x78,4) assert(false);break;
+        case (0x78<<3)|5: _M6502_LABEL(0x78,5) assert(false);break;
+        case (0x78<<3)|6: _M6502_LABEL(0x78,6) assert(false);break;
+        case (0x78<<3)|7: _M6502_LABEL(0x78,7) assert(false);break;
     /* ADC abs,Y */
-        case (0x79<<3)|0: _SA(c->PC++);break;
-        case (0x79<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x79<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0x79<<3)|3: _SA(c->AD+c->Y);break;
-        case (0x79<<3)|4: _m6502_adc(c,_GD());_FETCH();break;
-        case (0x79<<3)|5: assert(false);break;
-        case (0x79<<3)|6: assert(false);break;
-        case (0x79<<3)|7: assert(false);break;
+        case (0x79<<3)|0: _M6502_LABEL(0x79,0) _SA(c->PC++);break;
+        case (0x79<<3)|1: _M6502_LABEL(0x79,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x79<<3)|2: _M6502_LABEL(0x79,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0x79<<3)|3: _M6502_LABEL(0x79,3) _SA(c->AD+c->Y);break;
+        case (0x79<<3)|4: _M6502_LABEL(0x79,4) _m6502_adc(c,_GD());_FETCH();break;
+        case (0x79<<3)|5: _M6502_LABEL(0x79,5) assert(false);break;
+        case (0x79<<3)|6: _M6502_LABEL(0x79,6) assert(false);break;
+        case (0x79<<3)|7: _M6502_LABEL(0x79,7) assert(false);break;
     /* NOP  (undoc) */
-        case (0x7A<<3)|0: _SA(c->PC);break;
-        case (0x7A<<3)|1: _FETCH();break;
-        case (0x7A<<3)|2: assert(false);break;
-        case (0x7A<<3)|3: assert(false);break;
-        case (0x7A<<3)|4: assert(false);break;
-        case (0x7A<<3)|5: assert(false);break;
-        case (0x7A<<3)|6: assert(false);break;
-        case (0x7A<<3)|7: assert(false);break;
+        case (0x7A<<3)|0: _M6502_LABEL(0x7A,0) _SA(c->PC);break;
+        case (0x7A<<3)|1: _M6502_LABEL(0x7A,1) _FETCH();break;
+        case (0x7A<<3)|2: _M6502_LABEL(0x7A,2) assert(false);break;
+        case (0x7A<<3)|3: _M6502_LABEL(0x7A,3) assert(false);break;
+        case (0x7A<<3)|4: _M6502_LABEL(0x7A,4) assert(false);break;
+        case (0x7A<<3)|5: _M6502_LABEL(0x7A,5) assert(false);break;
+        case (0x7A<<3)|6: _M6502_LABEL(0x7A,6) assert(false);break;
+        case (0x7A<<3)|7: _M6502_LABEL(0x7A,7) assert(false);break;
     /* RRA abs,Y (undoc) */
-        case (0x7B<<3)|0: _SA(c->PC++);break;
-        case (0x7B<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x7B<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x7B<<3)|3: _SA(c->AD+c->Y);break;
-        case (0x7B<<3)|4: c->AD=_GD();_WR();break;
-        case (0x7B<<3)|5: c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
-        case (0x7B<<3)|6: _FETCH();break;
-        case (0x7B<<3)|7: assert(false);break;
+        case (0x7B<<3)|0: _M6502_LABEL(0x7B,0) _SA(c->PC++);break;
+        case (0x7B<<3)|1: _M6502_LABEL(0x7B,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x7B<<3)|2: _M6502_LABEL(0x7B,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x7B<<3)|3: _M6502_LABEL(0x7B,3) _SA(c->AD+c->Y);break;
+        case (0x7B<<3)|4: _M6502_LABEL(0x7B,4) c->AD=_GD();_WR();break;
+        case (0x7B<<3)|5: _M6502_LABEL(0x7B,5) c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
+        case (0x7B<<3)|6: _M6502_LABEL(0x7B,6) _FETCH();break;
+        case (0x7B<<3)|7: _M6502_LABEL(0x7B,7) assert(false);break;
     /* NOP abs,X (undoc) */
-        case (0x7C<<3)|0: _SA(c->PC++);break;
-        case (0x7C<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x7C<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0x7C<<3)|3: _SA(c->AD+c->X);break;
-        case (0x7C<<3)|4: _FETCH();break;
-        case (0x7C<<3)|5: assert(false);break;
-        case (0x7C<<3)|6: assert(false);break;
-        case (0x7C<<3)|7: assert(false);break;
+        case (0x7C<<3)|0: _M6502_LABEL(0x7C,0) _SA(c->PC++);break;
+        case (0x7C<<3)|1: _M6502_LABEL(0x7C,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x7C<<3)|2: _M6502_LABEL(0x7C,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0x7C<<3)|3: _M6502_LABEL(0x7C,3) _SA(c->AD+c->X);break;
+        case (0x7C<<3)|4: _M6502_LABEL(0x7C,4) _FETCH();break;
+        case (0x7C<<3)|5: _M6502_LABEL(0x7C,5) assert(false);break;
+        case (0x7C<<3)|6: _M6502_LABEL(0x7C,6) assert(false);break;
+        case (0x7C<<3)|7: _M6502_LABEL(0x7C,7) assert(false);break;
     /* ADC abs,X */
-        case (0x7D<<3)|0: _SA(c->PC++);break;
-        case (0x7D<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x7D<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0x7D<<3)|3: _SA(c->AD+c->X);break;
-        case (0x7D<<3)|4: _m6502_adc(c,_GD());_FETCH();break;
-        case (0x7D<<3)|5: assert(false);break;
-        case (0x7D<<3)|6: assert(false);break;
-        case (0x7D<<3)|7: assert(false);break;
+        case (0x7D<<3)|0: _M6502_LABEL(0x7D,0) _SA(c->PC++);break;
+        case (0x7D<<3)|1: _M6502_LABEL(0x7D,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x7D<<3)|2: _M6502_LABEL(0x7D,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0x7D<<3)|3: _M6502_LABEL(0x7D,3) _SA(c->AD+c->X);break;
+        case (0x7D<<3)|4: _M6502_LABEL(0x7D,4) _m6502_adc(c,_GD());_FETCH();break;
+        case (0x7D<<3)|5: _M6502_LABEL(0x7D,5) assert(false);break;
+        case (0x7D<<3)|6: _M6502_LABEL(0x7D,6) assert(false);break;
+        case (0x7D<<3)|7: _M6502_LABEL(0x7D,7) assert(false);break;
     /* ROR abs,X */
-        case (0x7E<<3)|0: _SA(c->PC++);break;
-        case (0x7E<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x7E<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0x7E<<3)|3: _SA(c->AD+c->X);break;
-        case (0x7E<<3)|4: c->AD=_GD();_WR();break;
-        case (0x7E<<3)|5: _SD(_m6502_ror(c,c->AD));_WR();break;
-        case (0x7E<<3)|6: _FETCH();break;
-        case (0x7E<<3)|7: assert(false);break;
+        case (0x7E<<3)|0: _M6502_LABEL(0x7E,0) _SA(c->PC++);break;
+        case (0x7E<<3)|1: _M6502_LABEL(0x7E,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x7E<<3)|2: _M6502_LABEL(0x7E,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0x7E<<3)|3: _M6502_LABEL(0x7E,3) _SA(c->AD+c->X);break;
+        case (0x7E<<3)|4: _M6502_LABEL(0x7E,4) c->AD=_GD();_WR();break;
+        case (0x7E<<3)|5: _M6502_LABEL(0x7E,5) _SD(_m6502_ror(c,c->AD));_WR();break;
+        case (0x7E<<3)|6: _M6502_LABEL(0x7E,6) _FETCH();break;
+        case (0x7E<<3)|7: _M6502_LABEL(0x7E,7) assert(false);break;
     /* RRA abs,X (undoc) */
-        case (0x7F<<3)|0: _SA(c->PC++);break;
-        case (0x7F<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x7F<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0x7F<<3)|3: _SA(c->AD+c->X);break;
-        case (0x7F<<3)|4: c->AD=_GD();_WR();break;
-        case (0x7F<<3)|5: c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
-        case (0x7F<<3)|6: _FETCH();break;
-        case (0x7F<<3)|7: assert(false);break;
+        case (0x7F<<3)|0: _M6502_LABEL(0x7F,0) _SA(c->PC++);break;
+        case (0x7F<<3)|1: _M6502_LABEL(0x7F,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x7F<<3)|2: _M6502_LABEL(0x7F,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0x7F<<3)|3: _M6502_LABEL(0x7F,3) _SA(c->AD+c->X);break;
+        case (0x7F<<3)|4: _M6502_LABEL(0x7F,4) c->AD=_GD();_WR();break;
+        case (0x7F<<3)|5: _M6502_LABEL(0x7F,5) c->AD=_m6502_ror(c,c->AD);_SD(c->AD);_m6502_adc(c,c->AD);_WR();break;
+        case (0x7F<<3)|6: _M6502_LABEL(0x7F,6) _FETCH();break;
+        case (0x7F<<3)|7: _M6502_LABEL(0x7F,7) assert(false);break;
     /* NOP # (undoc) */
-        case (0x80<<3)|0: _SA(c->PC++);break;
-        case (0x80<<3)|1: _FETCH();break;
-        case (0x80<<3)|2: assert(false);break;
-        case (0x80<<3)|3: assert(false);break;
-        case (0x80<<3)|4: assert(false);break;
-        case (0x80<<3)|5: assert(false);break;
-        case (0x80<<3)|6: assert(false);break;
-        case (0x80<<3)|7: assert(false);break;
+        case (0x80<<3)|0: _M6502_LABEL(0x80,0) _SA(c->PC++);break;
+        case (0x80<<3)|1: _M6502_LABEL(0x80,1) _FETCH();break;
+        case (0x80<<3)|2: _M6502_LABEL(0x80,2) assert(false);break;
+        case (0x80<<3)|3: _M6502_LABEL(0x80,3) assert(false);break;
+        case (0x80<<3)|4: _M6502_LABEL(0x80,4) assert(false);break;
+        case (0x80<<3)|5: _M6502_LABEL(0x80,5) assert(false);break;
+        case (0x80<<3)|6: _M6502_LABEL(0x80,6) assert(false);break;
+        case (0x80<<3)|7: _M6502_LABEL(0x80,7) assert(false);break;
     /* STA (zp,X) */
-        case (0x81<<3)|0: _SA(c->PC++);break;
-        case (0x81<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x81<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0x81<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x81<<3)|4: _SA((_GD()<<8)|c->AD);_SD(c->A);_WR();break;
-        case (0x81<<3)|5: _FETCH();break;
-        case (0x81<<3)|6: assert(false);break;
-        case (0x81<<3)|7: assert(false);break;
+        case (0x81<<3)|0: _M6502_LABEL(0x81,0) _SA(c->PC++);break;
+        case (0x81<<3)|1: _M6502_LABEL(0x81,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x81<<3)|2: _M6502_LABEL(0x81,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0x81<<3)|3: _M6502_LABEL(0x81,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x81<<3)|4: _M6502_LABEL(0x81,4) _SA((_GD()<<8)|c->AD);_SD(c->A);_WR();break;
+        case (0x81<<3)|5: _M6502_LABEL(0x81,5) _FETCH();break;
+        case (0x81<<3)|6: _M6502_LABEL(0x81,6) assert(false);break;
+        case (0x81<<3)|7: _M6502_LABEL(0x81,7) assert(false);break;
     /* NOP # (undoc) */
-        case (0x82<<3)|0: _SA(c->PC++);break;
-        case (0x82<<3)|1: _FETCH();break;
-        case (0x82<<3)|2: assert(false);break;
-        case (0x82<<3)|3: assert(false);break;
-        case (0x82<<3)|4: assert(false);break;
-        case (0x82<<3)|5: assert(false);break;
-        case (0x82<<3)|6: assert(false);break;
-        case (0x82<<3)|7: assert(false);break;
+        case (0x82<<3)|0: _M6502_LABEL(0x82,0) _SA(c->PC++);break;
+        case (0x82<<3)|1: _M6502_LABEL(0x82,1) _FETCH();break;
+        case (0x82<<3)|2: _M6502_LABEL(0x82,2) assert(false);break;
+        case (0x82<<3)|3: _M6502_LABEL(0x82,3) assert(false);break;
+        case (0x82<<3)|4: _M6502_LABEL(0x82,4) assert(false);break;
+        case (0x82<<3)|5: _M6502_LABEL(0x82,5) assert(false);break;
+        case (0x82<<3)|6: _M6502_LABEL(0x82,6) assert(false);break;
+        case (0x82<<3)|7: _M6502_LABEL(0x82,7) assert(false);break;
     /* SAX (zp,X) (undoc) */
-        case (0x83<<3)|0: _SA(c->PC++);break;
-        case (0x83<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x83<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0x83<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x83<<3)|4: _SA((_GD()<<8)|c->AD);_SD(c->A&c->X);_WR();break;
-        case (0x83<<3)|5: _FETCH();break;
-        case (0x83<<3)|6: assert(false);break;
-        case (0x83<<3)|7: assert(false);break;
+        case (0x83<<3)|0: _M6502_LABEL(0x83,0) _SA(c->PC++);break;
+        case (0x83<<3)|1: _M6502_LABEL(0x83,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x83<<3)|2: _M6502_LABEL(0x83,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0x83<<3)|3: _M6502_LABEL(0x83,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x83<<3)|4: _M6502_LABEL(0x83,4) _SA((_GD()<<8)|c->AD);_SD(c->A&c->X);_WR();break;
+        case (0x83<<3)|5: _M6502_LABEL(0x83,5) _FETCH();break;
+        case (0x83<<3)|6: _M6502_LABEL(0x83,6) assert(false);break;
+        case (0x83<<3)|7: _M6502_LABEL(0x83,7) assert(false);break;
     /* STY zp */
-        case (0x84<<3)|0: _SA(c->PC++);break;
-        case (0x84<<3)|1: _SA(_GD());_SD(c->Y);_WR();break;
-        case (0x84<<3)|2: _FETCH();break;
-        case (0x84<<3)|3: assert(false);break;
-        case (0x84<<3)|4: assert(false);break;
-        case (0x84<<3)|5: assert(false);break;
-        case (0x84<<3)|6: assert(false);break;
-        case (0x84<<3)|7: assert(false);break;
+        case (0x84<<3)|0: _M6502_LABEL(0x84,0) _SA(c->PC++);break;
+        case (0x84<<3)|1: _M6502_LABEL(0x84,1) _SA(_GD());_SD(c->Y);_WR();break;
+        case (0x84<<3)|2: _M6502_LABEL(0x84,2) _FETCH();break;
+        case (0x84<<3)|3: _M6502_LABEL(0x84,3) assert(false);break;
+        case (0x84<<3)|4: _M6502_LABEL(0x84,4) assert(false);break;
+        case (0x84<<3)|5: _M6502_LABEL(0x84,5) assert(false);break;
+        case (0x84<<3)|6: _M6502_LABEL(0x84,6) assert(false);break;
+        case (0x84<<3)|7: _M6502_LABEL(0x84,7) assert(false);break;
     /* STA zp */
-        case (0x85<<3)|0: _SA(c->PC++);break;
-        case (0x85<<3)|1: _SA(_GD());_SD(c->A);_WR();break;
-        case (0x85<<3)|2: _FETCH();break;
-        case (0x85<<3)|3: assert(false);break;
-        case (0x85<<3)|4: assert(false);break;
-        case (0x85<<3)|5: assert(false);break;
-        case (0x85<<3)|6: assert(false);break;
-        case (0x85<<3)|7: assert(false);break;
+        case (0x85<<3)|0: _M6502_LABEL(0x85,0) _SA(c->PC++);break;
+        case (0x85<<3)|1: _M6502_LABEL(0x85,1) _SA(_GD());_SD(c->A);_WR();break;
+        case (0x85<<3)|2: _M6502_LABEL(0x85,2) _FETCH();break;
+        case (0x85<<3)|3: _M6502_LABEL(0x85,3) assert(false);break;
+        case (0x85<<3)|4: _M6502_LABEL(0x85,4) assert(false);break;
+        case (0x85<<3)|5: _M6502_LABEL(0x85,5) assert(false);break;
+        case (0x85<<3)|6: _M6502_LABEL(0x85,6) assert(false);break;
+        case (0x85<<3)|7: _M6502_LABEL(0x85,7) assert(false);break;
     /* STX zp */
-        case (0x86<<3)|0: _SA(c->PC++);break;
-        case (0x86<<3)|1: _SA(_GD());_SD(c->X);_WR();break;
-        case (0x86<<3)|2: _FETCH();break;
-        case (0x86<<3)|3: assert(false);break;
-        case (0x86<<3)|4: assert(false);break;
-        case (0x86<<3)|5: assert(false);break;
-        case (0x86<<3)|6: assert(false);break;
-        case (0x86<<3)|7: assert(false);break;
+        case (0x86<<3)|0: _M6502_LABEL(0x86,0) _SA(c->PC++);break;
+        case (0x86<<3)|1: _M6502_LABEL(0x86,1) _SA(_GD());_SD(c->X);_WR();break;
+        case (0x86<<3)|2: _M6502_LABEL(0x86,2) _FETCH();break;
+        case (0x86<<3)|3: _M6502_LABEL(0x86,3) assert(false);break;
+        case (0x86<<3)|4: _M6502_LABEL(0x86,4) assert(false);break;
+        case (0x86<<3)|5: _M6502_LABEL(0x86,5) assert(false);break;
+        case (0x86<<3)|6: _M6502_LABEL(0x86,6) assert(false);break;
+        case (0x86<<3)|7: _M6502_LABEL(0x86,7) assert(false);break;
     /* SAX zp (undoc) */
-        case (0x87<<3)|0: _SA(c->PC++);break;
-        case (0x87<<3)|1: _SA(_GD());_SD(c->A&c->X);_WR();break;
-        case (0x87<<3)|2: _FETCH();break;
-        case (0x87<<3)|3: assert(false);break;
-        case (0x87<<3)|4: assert(false);break;
-        case (0x87<<3)|5: assert(false);break;
-        case (0x87<<3)|6: assert(false);break;
-        case (0x87<<3)|7: assert(false);break;
+        case (0x87<<3)|0: _M6502_LABEL(0x87,0) _SA(c->PC++);break;
+        case (0x87<<3)|1: _M6502_LABEL(0x87,1) _SA(_GD());_SD(c->A&c->X);_WR();break;
+        case (0x87<<3)|2: _M6502_LABEL(0x87,2) _FETCH();break;
+        case (0x87<<3)|3: _M6502_LABEL(0x87,3) assert(false);break;
+        case (0x87<<3)|4: _M6502_LABEL(0x87,4) assert(false);break;
+        case (0x87<<3)|5: _M6502_LABEL(0x87,5) assert(false);break;
+        case (0x87<<3)|6: _M6502_LABEL(0x87,6) assert(false);break;
+        case (0x87<<3)|7: _M6502_LABEL(0x87,7) assert(false);break;
     /* DEY  */
-        case (0x88<<3)|0: _SA(c->PC);break;
-        case (0x88<<3)|1: c->Y--;_NZ(c->Y);_FETCH();break;
-        case (0x88<<3)|2: assert(false);break;
-        case (0x88<<3)|3: assert(false);break;
-        case (0x88<<3)|4: assert(false);break;
-        case (0x88<<3)|5: assert(false);break;
-        case (0x88<<3)|6: assert(false);break;
-        case (0x88<<3)|7: assert(false);break;
+        case (0x88<<3)|0: _M6502_LABEL(0x88,0) _SA(c->PC);break;
+        case (0x88<<3)|1: _M6502_LABEL(0x88,1) c->Y--;_NZ(c->Y);_FETCH();break;
+        case (0x88<<3)|2: _M6502_LABEL(0x88,2) assert(false);break;
+        case (0x88<<3)|3: _M6502_LABEL(0x88,3) assert(false);break;
+        case (0x88<<3)|4: _M6502_LABEL(0x88,4) assert(false);break;
+        case (0x88<<3)|5: _M6502_LABEL(0x88,5) assert(false);break;
+        case (0x88<<3)|6: _M6502_LABEL(0x88,6) assert(false);break;
+        case (0x88<<3)|7: _M6502_LABEL(0x88,7) assert(false);break;
     /* NOP # (undoc) */
-        case (0x89<<3)|0: _SA(c->PC++);break;
-        case (0x89<<3)|1: _FETCH();break;
-        case (0x89<<3)|2: assert(false);break;
-        case (0x89<<3)|3: assert(false);break;
-        case (0x89<<3)|4: assert(false);break;
-        case (0x89<<3)|5: assert(false);break;
-        case (0x89<<3)|6: assert(false);break;
-        case (0x89<<3)|7: assert(false);break;
+        case (0x89<<3)|0: _M6502_LABEL(0x89,0) _SA(c->PC++);break;
+        case (0x89<<3)|1: _M6502_LABEL(0x89,1) _FETCH();break;
+        case (0x89<<3)|2: _M6502_LABEL(0x89,2) assert(false);break;
+        case (0x89<<3)|3: _M6502_LABEL(0x89,3) assert(false);break;
+        case (0x89<<3)|4: _M6502_LABEL(0x89,4) assert(false);break;
+        case (0x89<<3)|5: _M6502_LABEL(0x89,5) assert(false);break;
+        case (0x89<<3)|6: _M6502_LABEL(0x89,6) assert(false);break;
+        case (0x89<<3)|7: _M6502_LABEL(0x89,7) assert(false);break;
     /* TXA  */
-        case (0x8A<<3)|0: _SA(c->PC);break;
-        case (0x8A<<3)|1: c->A=c->X;_NZ(c->A);_FETCH();break;
-        case (0x8A<<3)|2: assert(false);break;
-        case (0x8A<<3)|3: assert(false);break;
-        case (0x8A<<3)|4: assert(false);break;
-        case (0x8A<<3)|5: assert(false);break;
-        case (0x8A<<3)|6: assert(false);break;
-        case (0x8A<<3)|7: assert(false);break;
+        case (0x8A<<3)|0: _M6502_LABEL(0x8A,0) _SA(c->PC);break;
+        case (0x8A<<3)|1: _M6502_LABEL(0x8A,1) c->A=c->X;_NZ(c->A);_FETCH();break;
+        case (0x8A<<3)|2: _M6502_LABEL(0x8A,2) assert(false);break;
+        case (0x8A<<3)|3: _M6502_LABEL(0x8A,3) assert(false);break;
+        case (0x8A<<3)|4: _M6502_LABEL(0x8A,4) assert(false);break;
+        case (0x8A<<3)|5: _M6502_LABEL(0x8A,5) assert(false);break;
+        case (0x8A<<3)|6: _M6502_LABEL(0x8A,6) assert(false);break;
+        case (0x8A<<3)|7: _M6502_LABEL(0x8A,7) assert(false);break;
     /* ANE # (undoc) */
-        case (0x8B<<3)|0: _SA(c->PC++);break;
-        case (0x8B<<3)|1: c->A=(c->A|0xEE)&c->X&_GD();_NZ(c->A);_FETCH();break;
-        case (0x8B<<3)|2: assert(false);break;
-        case (0x8B<<3)|3: assert(false);break;
-        case (0x8B<<3)|4: assert(false);break;
-        case (0x8B<<3)|5: assert(false);break;
-        case (0x8B<<3)|6: assert(false);break;
-        case (0x8B<<3)|7: assert(false);break;
+        case (0x8B<<3)|0: _M6502_LABEL(0x8B,0) _SA(c->PC++);break;
+        case (0x8B<<3)|1: _M6502_LABEL(0x8B,1) c->A=(c->A|0xEE)&c->X&_GD();_NZ(c->A);_FETCH();break;
+        case (0x8B<<3)|2: _M6502_LABEL(0x8B,2) assert(false);break;
+        case (0x8B<<3)|3: _M6502_LABEL(0x8B,3) assert(false);break;
+        case (0x8B<<3)|4: _M6502_LABEL(0x8B,4) assert(false);break;
+        case (0x8B<<3)|5: _M6502_LABEL(0x8B,5) assert(false);break;
+        case (0x8B<<3)|6: _M6502_LABEL(0x8B,6) assert(false);break;
+        case (0x8B<<3)|7: _M6502_LABEL(0x8B,7) assert(false);break;
     /* STY abs */
-        case (0x8C<<3)|0: _SA(c->PC++);break;
-        case (0x8C<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x8C<<3)|2: _SA((_GD()<<8)|c->AD);_SD(c->Y);_WR();break;
-        case (0x8C<<3)|3: _FETCH();break;
-        case (0x8C<<3)|4: assert(false);break;
-        case (0x8C<<3)|5: assert(false);break;
-        case (0x8C<<3)|6: assert(false);break;
-        case (0x8C<<3)|7: assert(false);break;
+        case (0x8C<<3)|0: _M6502_LABEL(0x8C,0) _SA(c->PC++);break;
+        case (0x8C<<3)|1: _M6502_LABEL(0x8C,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x8C<<3)|2: _M6502_LABEL(0x8C,2) _SA((_GD()<<8)|c->AD);_SD(c->Y);_WR();break;
+        case (0x8C<<3)|3: _M6502_LABEL(0x8C,3) _FETCH();break;
+        case (0x8C<<3)|4: _M6502_LABEL(0x8C,4) assert(false);break;
+        case (0x8C<<3)|5: _M6502_LABEL(0x8C,5) assert(false);break;
+        case (0x8C<<3)|6: _M6502_LABEL(0x8C,6) assert(false);break;
+        case (0x8C<<3)|7: _M6502_LABEL(0x8C,7) assert(false);break;
     /* STA abs */
-        case (0x8D<<3)|0: _SA(c->PC++);break;
-        case (0x8D<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x8D<<3)|2: _SA((_GD()<<8)|c->AD);_SD(c->A);_WR();break;
-        case (0x8D<<3)|3: _FETCH();break;
-        case (0x8D<<3)|4: assert(false);break;
-        case (0x8D<<3)|5: assert(false);break;
-        case (0x8D<<3)|6: assert(false);break;
-        case (0x8D<<3)|7: assert(false);break;
+        case (0x8D<<3)|0: _M6502_LABEL(0x8D,0) _SA(c->PC++);break;
+        case (0x8D<<3)|1: _M6502_LABEL(0x8D,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x8D<<3)|2: _M6502_LABEL(0x8D,2) _SA((_GD()<<8)|c->AD);_SD(c->A);_WR();break;
+        case (0x8D<<3)|3: _M6502_LABEL(0x8D,3) _FETCH();break;
+        case (0x8D<<3)|4: _M6502_LABEL(0x8D,4) assert(false);break;
+        case (0x8D<<3)|5: _M6502_LABEL(0x8D,5) assert(false);break;
+        case (0x8D<<3)|6: _M6502_LABEL(0x8D,6) assert(false);break;
+        case (0x8D<<3)|7: _M6502_LABEL(0x8D,7) assert(false);break;
     /* STX abs */
-        case (0x8E<<3)|0: _SA(c->PC++);break;
-        case (0x8E<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x8E<<3)|2: _SA((_GD()<<8)|c->AD);_SD(c->X);_WR();break;
-        case (0x8E<<3)|3: _FETCH();break;
-        case (0x8E<<3)|4: assert(false);break;
-        case (0x8E<<3)|5: assert(false);break;
-        case (0x8E<<3)|6: assert(false);break;
-        case (0x8E<<3)|7: assert(false);break;
+        case (0x8E<<3)|0: _M6502_LABEL(0x8E,0) _SA(c->PC++);break;
+        case (0x8E<<3)|1: _M6502_LABEL(0x8E,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x8E<<3)|2: _M6502_LABEL(0x8E,2) _SA((_GD()<<8)|c->AD);_SD(c->X);_WR();break;
+        case (0x8E<<3)|3: _M6502_LABEL(0x8E,3) _FETCH();break;
+        case (0x8E<<3)|4: _M6502_LABEL(0x8E,4) assert(false);break;
+        case (0x8E<<3)|5: _M6502_LABEL(0x8E,5) assert(false);break;
+        case (0x8E<<3)|6: _M6502_LABEL(0x8E,6) assert(false);break;
+        case (0x8E<<3)|7: _M6502_LABEL(0x8E,7) assert(false);break;
     /* SAX abs (undoc) */
-        case (0x8F<<3)|0: _SA(c->PC++);break;
-        case (0x8F<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x8F<<3)|2: _SA((_GD()<<8)|c->AD);_SD(c->A&c->X);_WR();break;
-        case (0x8F<<3)|3: _FETCH();break;
-        case (0x8F<<3)|4: assert(false);break;
-        case (0x8F<<3)|5: assert(false);break;
-        case (0x8F<<3)|6: assert(false);break;
-        case (0x8F<<3)|7: assert(false);break;
+        case (0x8F<<3)|0: _M6502_LABEL(0x8F,0) _SA(c->PC++);break;
+        case (0x8F<<3)|1: _M6502_LABEL(0x8F,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x8F<<3)|2: _M6502_LABEL(0x8F,2) _SA((_GD()<<8)|c->AD);_SD(c->A&c->X);_WR();break;
+        case (0x8F<<3)|3: _M6502_LABEL(0x8F,3) _FETCH();break;
+        case (0x8F<<3)|4: _M6502_LABEL(0x8F,4) assert(false);break;
+        case (0x8F<<3)|5: _M6502_LABEL(0x8F,5) assert(false);break;
+        case (0x8F<<3)|6: _M6502_LABEL(0x8F,6) assert(false);break;
+        case (0x8F<<3)|7: _M6502_LABEL(0x8F,7) assert(false);break;
     /* BCC # */
-        case (0x90<<3)|0: _SA(c->PC++);break;
-        case (0x90<<3)|1: _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x1)!=0x0){_FETCH();};break;
-        case (0x90<<3)|2: _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
-        case (0x90<<3)|3: c->PC=c->AD;_FETCH();break;
-        case (0x90<<3)|4: assert(false);break;
-        case (0x90<<3)|5: assert(false);break;
-        case (0x90<<3)|6: assert(false);break;
-        case (0x90<<3)|7: assert(false);break;
+        case (0x90<<3)|0: _M6502_LABEL(0x90,0) _SA(c->PC++);break;
+        case (0x90<<3)|1: _M6502_LABEL(0x90,1) _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x1)!=0x0){_FETCH();};break;
+        case (0x90<<3)|2: _M6502_LABEL(0x90,2) _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
+        case (0x90<<3)|3: _M6502_LABEL(0x90,3) c->PC=c->AD;_FETCH();break;
+        case (0x90<<3)|4: _M6502_LABEL(0x90,4) assert(false);break;
+        case (0x90<<3)|5: _M6502_LABEL(0x90,5) assert(false);break;
+        case (0x90<<3)|6: _M6502_LABEL(0x90,6) assert(false);break;
+        case (0x90<<3)|7: _M6502_LABEL(0x90,7) assert(false);break;
     /* STA (zp),Y */
-        case (0x91<<3)|0: _SA(c->PC++);break;
-        case (0x91<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x91<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x91<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x91<<3)|4: _SA(c->AD+c->Y);_SD(c->A);_WR();break;
-        case (0x91<<3)|5: _FETCH();break;
-        case (0x91<<3)|6: assert(false);break;
-        case (0x91<<3)|7: assert(false);break;
+        case (0x91<<3)|0: _M6502_LABEL(0x91,0) _SA(c->PC++);break;
+        case (0x91<<3)|1: _M6502_LABEL(0x91,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x91<<3)|2: _M6502_LABEL(0x91,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x91<<3)|3: _M6502_LABEL(0x91,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x91<<3)|4: _M6502_LABEL(0x91,4) _SA(c->AD+c->Y);_SD(c->A);_WR();break;
+        case (0x91<<3)|5: _M6502_LABEL(0x91,5) _FETCH();break;
+        case (0x91<<3)|6: _M6502_LABEL(0x91,6) assert(false);break;
+        case (0x91<<3)|7: _M6502_LABEL(0x91,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0x92<<3)|0: _SA(c->PC);break;
-        case (0x92<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0x92<<3)|2: assert(false);break;
-        case (0x92<<3)|3: assert(false);break;
-        case (0x92<<3)|4: assert(false);break;
-        case (0x92<<3)|5: assert(false);break;
-        case (0x92<<3)|6: assert(false);break;
-        case (0x92<<3)|7: assert(false);break;
+        case (0x92<<3)|0: _M6502_LABEL(0x92,0) _SA(c->PC);break;
+        case (0x92<<3)|1: _M6502_LABEL(0x92,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0x92<<3)|2: _M6502_LABEL(0x92,2) assert(false);break;
+        case (0x92<<3)|3: _M6502_LABEL(0x92,3) assert(false);break;
+        case (0x92<<3)|4: _M6502_LABEL(0x92,4) assert(false);break;
+        case (0x92<<3)|5: _M6502_LABEL(0x92,5) assert(false);break;
+        case (0x92<<3)|6: _M6502_LABEL(0x92,6) assert(false);break;
+        case (0x92<<3)|7: _M6502_LABEL(0x92,7) assert(false);break;
     /* SHA (zp),Y (undoc) */
-        case (0x93<<3)|0: _SA(c->PC++);break;
-        case (0x93<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x93<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0x93<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x93<<3)|4: _SA(c->AD+c->Y);_SD(c->A&c->X&(uint8_t)((_GA()>>8)+1));_WR();break;
-        case (0x93<<3)|5: _FETCH();break;
-        case (0x93<<3)|6: assert(false);break;
-        case (0x93<<3)|7: assert(false);break;
+        case (0x93<<3)|0: _M6502_LABEL(0x93,0) _SA(c->PC++);break;
+        case (0x93<<3)|1: _M6502_LABEL(0x93,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x93<<3)|2: _M6502_LABEL(0x93,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0x93<<3)|3: _M6502_LABEL(0x93,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x93<<3)|4: _M6502_LABEL(0x93,4) _SA(c->AD+c->Y);_SD(c->A&c->X&(uint8_t)((_GA()>>8)+1));_WR();break;
+        case (0x93<<3)|5: _M6502_LABEL(0x93,5) _FETCH();break;
+        case (0x93<<3)|6: _M6502_LABEL(0x93,6) assert(false);break;
+        case (0x93<<3)|7: _M6502_LABEL(0x93,7) assert(false);break;
     /* STY zp,X */
-        case (0x94<<3)|0: _SA(c->PC++);break;
-        case (0x94<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x94<<3)|2: _SA((c->AD+c->X)&0x00FF);_SD(c->Y);_WR();break;
-        case (0x94<<3)|3: _FETCH();break;
-        case (0x94<<3)|4: assert(false);break;
-        case (0x94<<3)|5: assert(false);break;
-        case (0x94<<3)|6: assert(false);break;
-        case (0x94<<3)|7: assert(false);break;
+        case (0x94<<3)|0: _M6502_LABEL(0x94,0) _SA(c->PC++);break;
+        case (0x94<<3)|1: _M6502_LABEL(0x94,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x94<<3)|2: _M6502_LABEL(0x94,2) _SA((c->AD+c->X)&0x00FF);_SD(c->Y);_WR();break;
+        case (0x94<<3)|3: _M6502_LABEL(0x94,3) _FETCH();break;
+        case (0x94<<3)|4: _M6502_LABEL(0x94,4) assert(false);break;
+        case (0x94<<3)|5: _M6502_LABEL(0x94,5) assert(false);break;
+        case (0x94<<3)|6: _M6502_LABEL(0x94,6) assert(false);break;
+        case (0x94<<3)|7: _M6502_LABEL(0x94,7) assert(false);break;
     /* STA zp,X */
-        case (0x95<<3)|0: _SA(c->PC++);break;
-        case (0x95<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x95<<3)|2: _SA((c->AD+c->X)&0x00FF);_SD(c->A);_WR();break;
-        case (0x95<<3)|3: _FETCH();break;
-        case (0x95<<3)|4: assert(false);break;
-        case (0x95<<3)|5: assert(false);break;
-        case (0x95<<3)|6: assert(false);break;
-        case (0x95<<3)|7: assert(false);break;
+        case (0x95<<3)|0: _M6502_LABEL(0x95,0) _SA(c->PC++);break;
+        case (0x95<<3)|1: _M6502_LABEL(0x95,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x95<<3)|2: _M6502_LABEL(0x95,2) _SA((c->AD+c->X)&0x00FF);_SD(c->A);_WR();break;
+        case (0x95<<3)|3: _M6502_LABEL(0x95,3) _FETCH();break;
+        case (0x95<<3)|4: _M6502_LABEL(0x95,4) assert(false);break;
+        case (0x95<<3)|5: _M6502_LABEL(0x95,5) assert(false);break;
+        case (0x95<<3)|6: _M6502_LABEL(0x95,6) assert(false);break;
+        case (0x95<<3)|7: _M6502_LABEL(0x95,7) assert(false);break;
     /* STX zp,Y */
-        case (0x96<<3)|0: _SA(c->PC++);break;
-        case (0x96<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x96<<3)|2: _SA((c->AD+c->Y)&0x00FF);_SD(c->X);_WR();break;
-        case (0x96<<3)|3: _FETCH();break;
-        case (0x96<<3)|4: assert(false);break;
-        case (0x96<<3)|5: assert(false);break;
-        case (0x96<<3)|6: assert(false);break;
-        case (0x96<<3)|7: assert(false);break;
+        case (0x96<<3)|0: _M6502_LABEL(0x96,0) _SA(c->PC++);break;
+        case (0x96<<3)|1: _M6502_LABEL(0x96,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x96<<3)|2: _M6502_LABEL(0x96,2) _SA((c->AD+c->Y)&0x00FF);_SD(c->X);_WR();break;
+        case (0x96<<3)|3: _M6502_LABEL(0x96,3) _FETCH();break;
+        case (0x96<<3)|4: _M6502_LABEL(0x96,4) assert(false);break;
+        case (0x96<<3)|5: _M6502_LABEL(0x96,5) assert(false);break;
+        case (0x96<<3)|6: _M6502_LABEL(0x96,6) assert(false);break;
+        case (0x96<<3)|7: _M6502_LABEL(0x96,7) assert(false);break;
     /* SAX zp,Y (undoc) */
-        case (0x97<<3)|0: _SA(c->PC++);break;
-        case (0x97<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0x97<<3)|2: _SA((c->AD+c->Y)&0x00FF);_SD(c->A&c->X);_WR();break;
-        case (0x97<<3)|3: _FETCH();break;
-        case (0x97<<3)|4: assert(false);break;
-        case (0x97<<3)|5: assert(false);break;
-        case (0x97<<3)|6: assert(false);break;
-        case (0x97<<3)|7: assert(false);break;
+        case (0x97<<3)|0: _M6502_LABEL(0x97,0) _SA(c->PC++);break;
+        case (0x97<<3)|1: _M6502_LABEL(0x97,1) c->AD=_GD();_SA(c->AD);break;
+        case (0x97<<3)|2: _M6502_LABEL(0x97,2) _SA((c->AD+c->Y)&0x00FF);_SD(c->A&c->X);_WR();break;
+        case (0x97<<3)|3: _M6502_LABEL(0x97,3) _FETCH();break;
+        case (0x97<<3)|4: _M6502_LABEL(0x97,4) assert(false);break;
+        case (0x97<<3)|5: _M6502_LABEL(0x97,5) assert(false);break;
+        case (0x97<<3)|6: _M6502_LABEL(0x97,6) assert(false);break;
+        case (0x97<<3)|7: _M6502_LABEL(0x97,7) assert(false);break;
     /* TYA  */
-        case (0x98<<3)|0: _SA(c->PC);break;
-        case (0x98<<3)|1: c->A=c->Y;_NZ(c->A);_FETCH();break;
-        case (0x98<<3)|2: assert(false);break;
-        case (0x98<<3)|3: assert(false);break;
-        case (0x98<<3)|4: assert(false);break;
-        case (0x98<<3)|5: assert(false);break;
-        case (0x98<<3)|6: assert(false);break;
-        case (0x98<<3)|7: assert(false);break;
+        case (0x98<<3)|0: _M6502_LABEL(0x98,0) _SA(c->PC);break;
+        case (0x98<<3)|1: _M6502_LABEL(0x98,1) c->A=c->Y;_NZ(c->A);_FETCH();break;
+        case (0x98<<3)|2: _M6502_LABEL(0x98,2) assert(false);break;
+        case (0x98<<3)|3: _M6502_LABEL(0x98,3) assert(false);break;
+        case (0x98<<3)|4: _M6502_LABEL(0x98,4) assert(false);break;
+        case (0x98<<3)|5: _M6502_LABEL(0x98,5) assert(false);break;
+        case (0x98<<3)|6: _M6502_LABEL(0x98,6) assert(false);break;
+        case (0x98<<3)|7: _M6502_LABEL(0x98,7) assert(false);break;
     /* STA abs,Y */
-        case (0x99<<3)|0: _SA(c->PC++);break;
-        case (0x99<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x99<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x99<<3)|3: _SA(c->AD+c->Y);_SD(c->A);_WR();break;
-        case (0x99<<3)|4: _FETCH();break;
-        case (0x99<<3)|5: assert(false);break;
-        case (0x99<<3)|6: assert(false);break;
-        case (0x99<<3)|7: assert(false);break;
+        case (0x99<<3)|0: _M6502_LABEL(0x99,0) _SA(c->PC++);break;
+        case (0x99<<3)|1: _M6502_LABEL(0x99,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x99<<3)|2: _M6502_LABEL(0x99,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x99<<3)|3: _M6502_LABEL(0x99,3) _SA(c->AD+c->Y);_SD(c->A);_WR();break;
+        case (0x99<<3)|4: _M6502_LABEL(0x99,4) _FETCH();break;
+        case (0x99<<3)|5: _M6502_LABEL(0x99,5) assert(false);break;
+        case (0x99<<3)|6: _M6502_LABEL(0x99,6) assert(false);break;
+        case (0x99<<3)|7: _M6502_LABEL(0x99,7) assert(false);break;
     /* TXS  */
-        case (0x9A<<3)|0: _SA(c->PC);break;
-        case (0x9A<<3)|1: c->S=c->X;_FETCH();break;
-        case (0x9A<<3)|2: assert(false);break;
-        case (0x9A<<3)|3: assert(false);break;
-        case (0x9A<<3)|4: assert(false);break;
-        case (0x9A<<3)|5: assert(false);break;
-        case (0x9A<<3)|6: assert(false);break;
-        case (0x9A<<3)|7: assert(false);break;
+        case (0x9A<<3)|0: _M6502_LABEL(0x9A,0) _SA(c->PC);break;
+        case (0x9A<<3)|1: _M6502_LABEL(0x9A,1) c->S=c->X;_FETCH();break;
+        case (0x9A<<3)|2: _M6502_LABEL(0x9A,2) assert(false);break;
+        case (0x9A<<3)|3: _M6502_LABEL(0x9A,3) assert(false);break;
+        case (0x9A<<3)|4: _M6502_LABEL(0x9A,4) assert(false);break;
+        case (0x9A<<3)|5: _M6502_LABEL(0x9A,5) assert(false);break;
+        case (0x9A<<3)|6: _M6502_LABEL(0x9A,6) assert(false);break;
+        case (0x9A<<3)|7: _M6502_LABEL(0x9A,7) assert(false);break;
     /* SHS abs,Y (undoc) */
-        case (0x9B<<3)|0: _SA(c->PC++);break;
-        case (0x9B<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x9B<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x9B<<3)|3: _SA(c->AD+c->Y);c->S=c->A&c->X;_SD(c->S&(uint8_t)((_GA()>>8)+1));_WR();break;
-        case (0x9B<<3)|4: _FETCH();break;
-        case (0x9B<<3)|5: assert(false);break;
-        case (0x9B<<3)|6: assert(false);break;
-        case (0x9B<<3)|7: assert(false);break;
+        case (0x9B<<3)|0: _M6502_LABEL(0x9B,0) _SA(c->PC++);break;
+        case (0x9B<<3)|1: _M6502_LABEL(0x9B,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x9B<<3)|2: _M6502_LABEL(0x9B,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x9B<<3)|3: _M6502_LABEL(0x9B,3) _SA(c->AD+c->Y);c->S=c->A&c->X;_SD(c->S&(uint8_t)((_GA()>>8)+1));_WR();break;
+        case (0x9B<<3)|4: _M6502_LABEL(0x9B,4) _FETCH();break;
+        case (0x9B<<3)|5: _M6502_LABEL(0x9B,5) assert(false);break;
+        case (0x9B<<3)|6: _M6502_LABEL(0x9B,6) assert(false);break;
+        case (0x9B<<3)|7: _M6502_LABEL(0x9B,7) assert(false);break;
     /* SHY abs,X (undoc) */
-        case (0x9C<<3)|0: _SA(c->PC++);break;
-        case (0x9C<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x9C<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0x9C<<3)|3: _SA(c->AD+c->X);_SD(c->Y&(uint8_t)((_GA()>>8)+1));_WR();break;
-        case (0x9C<<3)|4: _FETCH();break;
-        case (0x9C<<3)|5: assert(false);break;
-        case (0x9C<<3)|6: assert(false);break;
-        case (0x9C<<3)|7: assert(false);break;
+        case (0x9C<<3)|0: _M6502_LABEL(0x9C,0) _SA(c->PC++);break;
+        case (0x9C<<3)|1: _M6502_LABEL(0x9C,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x9C<<3)|2: _M6502_LABEL(0x9C,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0x9C<<3)|3: _M6502_LABEL(0x9C,3) _SA(c->AD+c->X);_SD(c->Y&(uint8_t)((_GA()>>8)+1));_WR();break;
+        case (0x9C<<3)|4: _M6502_LABEL(0x9C,4) _FETCH();break;
+        case (0x9C<<3)|5: _M6502_LABEL(0x9C,5) assert(false);break;
+        case (0x9C<<3)|6: _M6502_LABEL(0x9C,6) assert(false);break;
+        case (0x9C<<3)|7: _M6502_LABEL(0x9C,7) assert(false);break;
     /* STA abs,X */
-        case (0x9D<<3)|0: _SA(c->PC++);break;
-        case (0x9D<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x9D<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0x9D<<3)|3: _SA(c->AD+c->X);_SD(c->A);_WR();break;
-        case (0x9D<<3)|4: _FETCH();break;
-        case (0x9D<<3)|5: assert(false);break;
-        case (0x9D<<3)|6: assert(false);break;
-        case (0x9D<<3)|7: assert(false);break;
+        case (0x9D<<3)|0: _M6502_LABEL(0x9D,0) _SA(c->PC++);break;
+        case (0x9D<<3)|1: _M6502_LABEL(0x9D,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x9D<<3)|2: _M6502_LABEL(0x9D,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0x9D<<3)|3: _M6502_LABEL(0x9D,3) _SA(c->AD+c->X);_SD(c->A);_WR();break;
+        case (0x9D<<3)|4: _M6502_LABEL(0x9D,4) _FETCH();break;
+        case (0x9D<<3)|5: _M6502_LABEL(0x9D,5) assert(false);break;
+        case (0x9D<<3)|6: _M6502_LABEL(0x9D,6) assert(false);break;
+        case (0x9D<<3)|7: _M6502_LABEL(0x9D,7) assert(false);break;
     /* SHX abs,Y (undoc) */
-        case (0x9E<<3)|0: _SA(c->PC++);break;
-        case (0x9E<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x9E<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x9E<<3)|3: _SA(c->AD+c->Y);_SD(c->X&(uint8_t)((_GA()>>8)+1));_WR();break;
-        case (0x9E<<3)|4: _FETCH();break;
-        case (0x9E<<3)|5: assert(false);break;
-        case (0x9E<<3)|6: assert(false);break;
-        case (0x9E<<3)|7: assert(false);break;
+        case (0x9E<<3)|0: _M6502_LABEL(0x9E,0) _SA(c->PC++);break;
+        case (0x9E<<3)|1: _M6502_LABEL(0x9E,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x9E<<3)|2: _M6502_LABEL(0x9E,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x9E<<3)|3: _M6502_LABEL(0x9E,3) _SA(c->AD+c->Y);_SD(c->X&(uint8_t)((_GA()>>8)+1));_WR();break;
+        case (0x9E<<3)|4: _M6502_LABEL(0x9E,4) _FETCH();break;
+        case (0x9E<<3)|5: _M6502_LABEL(0x9E,5) assert(false);break;
+        case (0x9E<<3)|6: _M6502_LABEL(0x9E,6) assert(false);break;
+        case (0x9E<<3)|7: _M6502_LABEL(0x9E,7) assert(false);break;
     /* SHA abs,Y (undoc) */
-        case (0x9F<<3)|0: _SA(c->PC++);break;
-        case (0x9F<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0x9F<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0x9F<<3)|3: _SA(c->AD+c->Y);_SD(c->A&c->X&(uint8_t)((_GA()>>8)+1));_WR();break;
-        case (0x9F<<3)|4: _FETCH();break;
-        case (0x9F<<3)|5: assert(false);break;
-        case (0x9F<<3)|6: assert(false);break;
-        case (0x9F<<3)|7: assert(false);break;
+        case (0x9F<<3)|0: _M6502_LABEL(0x9F,0) _SA(c->PC++);break;
+        case (0x9F<<3)|1: _M6502_LABEL(0x9F,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0x9F<<3)|2: _M6502_LABEL(0x9F,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0x9F<<3)|3: _M6502_LABEL(0x9F,3) _SA(c->AD+c->Y);_SD(c->A&c->X&(uint8_t)((_GA()>>8)+1));_WR();break;
+        case (0x9F<<3)|4: _M6502_LABEL(0x9F,4) _FETCH();break;
+        case (0x9F<<3)|5: _M6502_LABEL(0x9F,5) assert(false);break;
+        case (0x9F<<3)|6: _M6502_LABEL(0x9F,6) assert(false);break;
+        case (0x9F<<3)|7: _M6502_LABEL(0x9F,7) assert(false);break;
     /* LDY # */
-        case (0xA0<<3)|0: _SA(c->PC++);break;
-        case (0xA0<<3)|1: c->Y=_GD();_NZ(c->Y);_FETCH();break;
-        case (0xA0<<3)|2: assert(false);break;
-        case (0xA0<<3)|3: assert(false);break;
-        case (0xA0<<3)|4: assert(false);break;
-        case (0xA0<<3)|5: assert(false);break;
-        case (0xA0<<3)|6: assert(false);break;
-        case (0xA0<<3)|7: assert(false);break;
+        case (0xA0<<3)|0: _M6502_LABEL(0xA0,0) _SA(c->PC++);break;
+        case (0xA0<<3)|1: _M6502_LABEL(0xA0,1) c->Y=_GD();_NZ(c->Y);_FETCH();break;
+        case (0xA0<<3)|2: _M6502_LABEL(0xA0,2) assert(false);break;
+        case (0xA0<<3)|3: _M6502_LABEL(0xA0,3) assert(false);break;
+        case (0xA0<<3)|4: _M6502_LABEL(0xA0,4) assert(false);break;
+        case (0xA0<<3)|5: _M6502_LABEL(0xA0,5) assert(false);break;
+        case (0xA0<<3)|6: _M6502_LABEL(0xA0,6) assert(false);break;
+        case (0xA0<<3)|7: _M6502_LABEL(0xA0,7) assert(false);break;
     /* LDA (zp,X) */
-        case (0xA1<<3)|0: _SA(c->PC++);break;
-        case (0xA1<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xA1<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0xA1<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xA1<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0xA1<<3)|5: c->A=_GD();_NZ(c->A);_FETCH();break;
-        case (0xA1<<3)|6: assert(false);break;
-        case (0xA1<<3)|7: assert(false);break;
+        case (0xA1<<3)|0: _M6502_LABEL(0xA1,0) _SA(c->PC++);break;
+        case (0xA1<<3)|1: _M6502_LABEL(0xA1,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xA1<<3)|2: _M6502_LABEL(0xA1,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0xA1<<3)|3: _M6502_LABEL(0xA1,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xA1<<3)|4: _M6502_LABEL(0xA1,4) _SA((_GD()<<8)|c->AD);break;
+        case (0xA1<<3)|5: _M6502_LABEL(0xA1,5) c->A=_GD();_NZ(c->A);_FETCH();break;
+        case (0xA1<<3)|6: _M6502_LABEL(0xA1,6) assert(false);break;
+        case (0xA1<<3)|7: _M6502_LABEL(0xA1,7) assert(false);break;
     /* LDX # */
-        case (0xA2<<3)|0: _SA(c->PC++);break;
-        case (0xA2<<3)|1: c->X=_GD();_NZ(c->X);_FETCH();break;
-        case (0xA2<<3)|2: assert(false);break;
-        case (0xA2<<3)|3: assert(false);break;
-        case (0xA2<<3)|4: assert(false);break;
-        case (0xA2<<3)|5: assert(false);break;
-        case (0xA2<<3)|6: assert(false);break;
-        case (0xA2<<3)|7: assert(false);break;
+        case (0xA2<<3)|0: _M6502_LABEL(0xA2,0) _SA(c->PC++);break;
+        case (0xA2<<3)|1: _M6502_LABEL(0xA2,1) c->X=_GD();_NZ(c->X);_FETCH();break;
+        case (0xA2<<3)|2: _M6502_LABEL(0xA2,2) assert(false);break;
+        case (0xA2<<3)|3: _M6502_LABEL(0xA2,3) assert(false);break;
+        case (0xA2<<3)|4: _M6502_LABEL(0xA2,4) assert(false);break;
+        case (0xA2<<3)|5: _M6502_LABEL(0xA2,5) assert(false);break;
+        case (0xA2<<3)|6: _M6502_LABEL(0xA2,6) assert(false);break;
+        case (0xA2<<3)|7: _M6502_LABEL(0xA2,7) assert(false);break;
     /* LAX (zp,X) (undoc) */
-        case (0xA3<<3)|0: _SA(c->PC++);break;
-        case (0xA3<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xA3<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0xA3<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xA3<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0xA3<<3)|5: c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
-        case (0xA3<<3)|6: assert(false);break;
-        case (0xA3<<3)|7: assert(false);break;
+        case (0xA3<<3)|0: _M6502_LABEL(0xA3,0) _SA(c->PC++);break;
+        case (0xA3<<3)|1: _M6502_LABEL(0xA3,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xA3<<3)|2: _M6502_LABEL(0xA3,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0xA3<<3)|3: _M6502_LABEL(0xA3,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xA3<<3)|4: _M6502_LABEL(0xA3,4) _SA((_GD()<<8)|c->AD);break;
+        case (0xA3<<3)|5: _M6502_LABEL(0xA3,5) c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
+        case (0xA3<<3)|6: _M6502_LABEL(0xA3,6) assert(false);break;
+        case (0xA3<<3)|7: _M6502_LABEL(0xA3,7) assert(false);break;
     /* LDY zp */
-        case (0xA4<<3)|0: _SA(c->PC++);break;
-        case (0xA4<<3)|1: _SA(_GD());break;
-        case (0xA4<<3)|2: c->Y=_GD();_NZ(c->Y);_FETCH();break;
-        case (0xA4<<3)|3: assert(false);break;
-        case (0xA4<<3)|4: assert(false);break;
-        case (0xA4<<3)|5: assert(false);break;
-        case (0xA4<<3)|6: assert(false);break;
-        case (0xA4<<3)|7: assert(false);break;
+        case (0xA4<<3)|0: _M6502_LABEL(0xA4,0) _SA(c->PC++);break;
+        case (0xA4<<3)|1: _M6502_LABEL(0xA4,1) _SA(_GD());break;
+        case (0xA4<<3)|2: _M6502_LABEL(0xA4,2) c->Y=_GD();_NZ(c->Y);_FETCH();break;
+        case (0xA4<<3)|3: _M6502_LABEL(0xA4,3) assert(false);break;
+        case (0xA4<<3)|4: _M6502_LABEL(0xA4,4) assert(false);break;
+        case (0xA4<<3)|5: _M6502_LABEL(0xA4,5) assert(false);break;
+        case (0xA4<<3)|6: _M6502_LABEL(0xA4,6) assert(false);break;
+        case (0xA4<<3)|7: _M6502_LABEL(0xA4,7) assert(false);break;
     /* LDA zp */
-        case (0xA5<<3)|0: _SA(c->PC++);break;
-        case (0xA5<<3)|1: _SA(_GD());break;
-        case (0xA5<<3)|2: c->A=_GD();_NZ(c->A);_FETCH();break;
-        case (0xA5<<3)|3: assert(false);break;
-        case (0xA5<<3)|4: assert(false);break;
-        case (0xA5<<3)|5: assert(false);break;
-        case (0xA5<<3)|6: assert(false);break;
-        case (0xA5<<3)|7: assert(false);break;
+        case (0xA5<<3)|0: _M6502_LABEL(0xA5,0) _SA(c->PC++);break;
+        case (0xA5<<3)|1: _M6502_LABEL(0xA5,1) _SA(_GD());break;
+        case (0xA5<<3)|2: _M6502_LABEL(0xA5,2) c->A=_GD();_NZ(c->A);_FETCH();break;
+        case (0xA5<<3)|3: _M6502_LABEL(0xA5,3) assert(false);break;
+        case (0xA5<<3)|4: _M6502_LABEL(0xA5,4) assert(false);break;
+        case (0xA5<<3)|5: _M6502_LABEL(0xA5,5) assert(false);break;
+        case (0xA5<<3)|6: _M6502_LABEL(0xA5,6) assert(false);break;
+        case (0xA5<<3)|7: _M6502_LABEL(0xA5,7) assert(false);break;
     /* LDX zp */
-        case (0xA6<<3)|0: _SA(c->PC++);break;
-        case (0xA6<<3)|1: _SA(_GD());break;
-        case (0xA6<<3)|2: c->X=_GD();_NZ(c->X);_FETCH();break;
-        case (0xA6<<3)|3: assert(false);break;
-        case (0xA6<<3)|4: assert(false);break;
-        case (0xA6<<3)|5: assert(false);break;
-        case (0xA6<<3)|6: assert(false);break;
-        case (0xA6<<3)|7: assert(false);break;
+        case (0xA6<<3)|0: _M6502_LABEL(0xA6,0) _SA(c->PC++);break;
+        case (0xA6<<3)|1: _M6502_LABEL(0xA6,1) _SA(_GD());break;
+        case (0xA6<<3)|2: _M6502_LABEL(0xA6,2) c->X=_GD();_NZ(c->X);_FETCH();break;
+        case (0xA6<<3)|3: _M6502_LABEL(0xA6,3) assert(false);break;
+        case (0xA6<<3)|4: _M6502_LABEL(0xA6,4) assert(false);break;
+        case (0xA6<<3)|5: _M6502_LABEL(0xA6,5) assert(false);break;
+        case (0xA6<<3)|6: _M6502_LABEL(0xA6,6) assert(false);break;
+        case (0xA6<<3)|7: _M6502_LABEL(0xA6,7) assert(false);break;
     /* LAX zp (undoc) */
-        case (0xA7<<3)|0: _SA(c->PC++);break;
-        case (0xA7<<3)|1: _SA(_GD());break;
-        case (0xA7<<3)|2: c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
-        case (0xA7<<3)|3: assert(false);break;
-        case (0xA7<<3)|4: assert(false);break;
-        case (0xA7<<3)|5: assert(false);break;
-        case (0xA7<<3)|6: assert(false);break;
-        case (0xA7<<3)|7: assert(false);break;
+        case (0xA7<<3)|0: _M6502_LABEL(0xA7,0) _SA(c->PC++);break;
+        case (0xA7<<3)|1: _M6502_LABEL(0xA7,1) _SA(_GD());break;
+        case (0xA7<<3)|2: _M6502_LABEL(0xA7,2) c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
+        case (0xA7<<3)|3: _M6502_LABEL(0xA7,3) assert(false);break;
+        case (0xA7<<3)|4: _M6502_LABEL(0xA7,4) assert(false);break;
+        case (0xA7<<3)|5: _M6502_LABEL(0xA7,5) assert(false);break;
+        case (0xA7<<3)|6: _M6502_LABEL(0xA7,6) assert(false);break;
+        case (0xA7<<3)|7: _M6502_LABEL(0xA7,7) assert(false);break;
     /* TAY  */
-        case (0xA8<<3)|0: _SA(c->PC);break;
-        case (0xA8<<3)|1: c->Y=c->A;_NZ(c->Y);_FETCH();break;
-        case (0xA8<<3)|2: assert(false);break;
-        case (0xA8<<3)|3: assert(false);break;
-        case (0xA8<<3)|4: assert(false);break;
-        case (0xA8<<3)|5: assert(false);break;
-        case (0xA8<<3)|6: assert(false);break;
-        case (0xA8<<3)|7: assert(false);break;
+        case (0xA8<<3)|0: _M6502_LABEL(0xA8,0) _SA(c->PC);break;
+        case (0xA8<<3)|1: _M6502_LABEL(0xA8,1) c->Y=c->A;_NZ(c->Y);_FETCH();break;
+        case (0xA8<<3)|2: _M6502_LABEL(0xA8,2) assert(false);break;
+        case (0xA8<<3)|3: _M6502_LABEL(0xA8,3) assert(false);break;
+        case (0xA8<<3)|4: _M6502_LABEL(0xA8,4) assert(false);break;
+        case (0xA8<<3)|5: _M6502_LABEL(0xA8,5) assert(false);break;
+        case (0xA8<<3)|6: _M6502_LABEL(0xA8,6) assert(false);break;
+        case (0xA8<<3)|7: _M6502_LABEL(0xA8,7) assert(false);break;
     /* LDA # */
-        case (0xA9<<3)|0: _SA(c->PC++);break;
-        case (0xA9<<3)|1: c->A=_GD();_NZ(c->A);_FETCH();break;
-        case (0xA9<<3)|2: assert(false);break;
-        case (0xA9<<3)|3: assert(false);break;
-        case (0xA9<<3)|4: assert(false);break;
-        case (0xA9<<3)|5: assert(false);break;
-        case (0xA9<<3)|6: assert(false);break;
-        case (0xA9<<3)|7: assert(false);break;
+        case (0xA9<<3)|0: _M6502_LABEL(0xA9,0) _SA(c->PC++);break;
+        case (0xA9<<3)|1: _M6502_LABEL(0xA9,1) c->A=_GD();_NZ(c->A);_FETCH();break;
+        case (0xA9<<3)|2: _M6502_LABEL(0xA9,2) assert(false);break;
+        case (0xA9<<3)|3: _M6502_LABEL(0xA9,3) assert(false);break;
+        case (0xA9<<3)|4: _M6502_LABEL(0xA9,4) assert(false);break;
+        case (0xA9<<3)|5: _M6502_LABEL(0xA9,5) assert(false);break;
+        case (0xA9<<3)|6: _M6502_LABEL(0xA9,6) assert(false);break;
+        case (0xA9<<3)|7: _M6502_LABEL(0xA9,7) assert(false);break;
     /* TAX  */
-        case (0xAA<<3)|0: _SA(c->PC);break;
-        case (0xAA<<3)|1: c->X=c->A;_NZ(c->X);_FETCH();break;
-        case (0xAA<<3)|2: assert(false);break;
-        case (0xAA<<3)|3: assert(false);break;
-        case (0xAA<<3)|4: assert(false);break;
-        case (0xAA<<3)|5: assert(false);break;
-        case (0xAA<<3)|6: assert(false);break;
-        case (0xAA<<3)|7: assert(false);break;
+        case (0xAA<<3)|0: _M6502_LABEL(0xAA,0) _SA(c->PC);break;
+        case (0xAA<<3)|1: _M6502_LABEL(0xAA,1) c->X=c->A;_NZ(c->X);_FETCH();break;
+        case (0xAA<<3)|2: _M6502_LABEL(0xAA,2) assert(false);break;
+        case (0xAA<<3)|3: _M6502_LABEL(0xAA,3) assert(false);break;
+        case (0xAA<<3)|4: _M6502_LABEL(0xAA,4) assert(false);break;
+        case (0xAA<<3)|5: _M6502_LABEL(0xAA,5) assert(false);break;
+        case (0xAA<<3)|6: _M6502_LABEL(0xAA,6) assert(false);break;
+        case (0xAA<<3)|7: _M6502_LABEL(0xAA,7) assert(false);break;
     /* LXA # (undoc) */
-        case (0xAB<<3)|0: _SA(c->PC++);break;
-        case (0xAB<<3)|1: c->A=c->X=(c->A|0xEE)&_GD();_NZ(c->A);_FETCH();break;
-        case (0xAB<<3)|2: assert(false);break;
-        case (0xAB<<3)|3: assert(false);break;
-        case (0xAB<<3)|4: assert(false);break;
-        case (0xAB<<3)|5: assert(false);break;
-        case (0xAB<<3)|6: assert(false);break;
-        case (0xAB<<3)|7: assert(false);break;
+        case (0xAB<<3)|0: _M6502_LABEL(0xAB,0) _SA(c->PC++);break;
+        case (0xAB<<3)|1: _M6502_LABEL(0xAB,1) c->A=c->X=(c->A|0xEE)&_GD();_NZ(c->A);_FETCH();break;
+        case (0xAB<<3)|2: _M6502_LABEL(0xAB,2) assert(false);break;
+        case (0xAB<<3)|3: _M6502_LABEL(0xAB,3) assert(false);break;
+        case (0xAB<<3)|4: _M6502_LABEL(0xAB,4) assert(false);break;
+        case (0xAB<<3)|5: _M6502_LABEL(0xAB,5) assert(false);break;
+        case (0xAB<<3)|6: _M6502_LABEL(0xAB,6) assert(false);break;
+        case (0xAB<<3)|7: _M6502_LABEL(0xAB,7) assert(false);break;
     /* LDY abs */
-        case (0xAC<<3)|0: _SA(c->PC++);break;
-        case (0xAC<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xAC<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xAC<<3)|3: c->Y=_GD();_NZ(c->Y);_FETCH();break;
-        case (0xAC<<3)|4: assert(false);break;
-        case (0xAC<<3)|5: assert(false);break;
-        case (0xAC<<3)|6: assert(false);break;
-        case (0xAC<<3)|7: assert(false);break;
+        case (0xAC<<3)|0: _M6502_LABEL(0xAC,0) _SA(c->PC++);break;
+        case (0xAC<<3)|1: _M6502_LABEL(0xAC,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xAC<<3)|2: _M6502_LABEL(0xAC,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xAC<<3)|3: _M6502_LABEL(0xAC,3) c->Y=_GD();_NZ(c->Y);_FETCH();break;
+        case (0xAC<<3)|4: _M6502_LABEL(0xAC,4) assert(false);break;
+        case (0xAC<<3)|5: _M6502_LABEL(0xAC,5) assert(false);break;
+        case (0xAC<<3)|6: _M6502_LABEL(0xAC,6) assert(false);break;
+        case (0xAC<<3)|7: _M6502_LABEL(0xAC,7) assert(false);break;
     /* LDA abs */
-        case (0xAD<<3)|0: _SA(c->PC++);break;
-        case (0xAD<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xAD<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xAD<<3)|3: c->A=_GD();_NZ(c->A);_FETCH();break;
-        case (0xAD<<3)|4: assert(false);break;
-        case (0xAD<<3)|5: assert(false);break;
-        case (0xAD<<3)|6: assert(false);break;
-        case (0xAD<<3)|7: assert(false);break;
+        case (0xAD<<3)|0: _M6502_LABEL(0xAD,0) _SA(c->PC++);break;
+        case (0xAD<<3)|1: _M6502_LABEL(0xAD,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xAD<<3)|2: _M6502_LABEL(0xAD,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xAD<<3)|3: _M6502_LABEL(0xAD,3) c->A=_GD();_NZ(c->A);_FETCH();break;
+        case (0xAD<<3)|4: _M6502_LABEL(0xAD,4) assert(false);break;
+        case (0xAD<<3)|5: _M6502_LABEL(0xAD,5) assert(false);break;
+        case (0xAD<<3)|6: _M6502_LABEL(0xAD,6) assert(false);break;
+        case (0xAD<<3)|7: _M6502_LABEL(0xAD,7) assert(false);break;
     /* LDX abs */
-        case (0xAE<<3)|0: _SA(c->PC++);break;
-        case (0xAE<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xAE<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xAE<<3)|3: c->X=_GD();_NZ(c->X);_FETCH();break;
-        case (0xAE<<3)|4: assert(false);break;
-        case (0xAE<<3)|5: assert(false);break;
-        case (0xAE<<3)|6: assert(false);break;
-        case (0xAE<<3)|7: assert(false);break;
+        case (0xAE<<3)|0: _M6502_LABEL(0xAE,0) _SA(c->PC++);break;
+        case (0xAE<<3)|1: _M6502_LABEL(0xAE,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xAE<<3)|2: _M6502_LABEL(0xAE,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xAE<<3)|3: _M6502_LABEL(0xAE,3) c->X=_GD();_NZ(c->X);_FETCH();break;
+        case (0xAE<<3)|4: _M6502_LABEL(0xAE,4) assert(false);break;
+        case (0xAE<<3)|5: _M6502_LABEL(0xAE,5) assert(false);break;
+        case (0xAE<<3)|6: _M6502_LABEL(0xAE,6) assert(false);break;
+        case (0xAE<<3)|7: _M6502_LABEL(0xAE,7) assert(false);break;
     /* LAX abs (undoc) */
-        case (0xAF<<3)|0: _SA(c->PC++);break;
-        case (0xAF<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xAF<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xAF<<3)|3: c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
-        case (0xAF<<3)|4: assert(false);break;
-        case (0xAF<<3)|5: assert(false);break;
-        case (0xAF<<3)|6: assert(false);break;
-        case (0xAF<<3)|7: assert(false);break;
+        case (0xAF<<3)|0: _M6502_LABEL(0xAF,0) _SA(c->PC++);break;
+        case (0xAF<<3)|1: _M6502_LABEL(0xAF,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xAF<<3)|2: _M6502_LABEL(0xAF,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xAF<<3)|3: _M6502_LABEL(0xAF,3) c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
+        case (0xAF<<3)|4: _M6502_LABEL(0xAF,4) assert(false);break;
+        case (0xAF<<3)|5: _M6502_LABEL(0xAF,5) assert(false);break;
+        case (0xAF<<3)|6: _M6502_LABEL(0xAF,6) assert(false);break;
+        case (0xAF<<3)|7: _M6502_LABEL(0xAF,7) assert(false);break;
     /* BCS # */
-        case (0xB0<<3)|0: _SA(c->PC++);break;
-        case (0xB0<<3)|1: _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x1)!=0x1){_FETCH();};break;
-        case (0xB0<<3)|2: _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
-        case (0xB0<<3)|3: c->PC=c->AD;_FETCH();break;
-        case (0xB0<<3)|4: assert(false);break;
-        case (0xB0<<3)|5: assert(false);break;
-        case (0xB0<<3)|6: assert(false);break;
-        case (0xB0<<3)|7: assert(false);break;
+        case (0xB0<<3)|0: _M6502_LABEL(0xB0,0) _SA(c->PC++);break;
+        case (0xB0<<3)|1: _M6502_LABEL(0xB0,1) _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x1)!=0x1){_FETCH();};break;
+        case (0xB0<<3)|2: _M6502_LABEL(0xB0,2) _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
+        case (0xB0<<3)|3: _M6502_LABEL(0xB0,3) c->PC=c->AD;_FETCH();break;
+        case (0xB0<<3)|4: _M6502_LABEL(0xB0,4) assert(false);break;
+        case (0xB0<<3)|5: _M6502_LABEL(0xB0,5) assert(false);break;
+        case (0xB0<<3)|6: _M6502_LABEL(0xB0,6) assert(false);break;
+        case (0xB0<<3)|7: _M6502_LABEL(0xB0,7) assert(false);break;
     /* LDA (zp),Y */
-        case (0xB1<<3)|0: _SA(c->PC++);break;
-        case (0xB1<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xB1<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xB1<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0xB1<<3)|4: _SA(c->AD+c->Y);break;
-        case (0xB1<<3)|5: c->A=_GD();_NZ(c->A);_FETCH();break;
-        case (0xB1<<3)|6: assert(false);break;
-        case (0xB1<<3)|7: assert(false);break;
+        case (0xB1<<3)|0: _M6502_LABEL(0xB1,0) _SA(c->PC++);break;
+        case (0xB1<<3)|1: _M6502_LABEL(0xB1,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xB1<<3)|2: _M6502_LABEL(0xB1,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xB1<<3)|3: _M6502_LABEL(0xB1,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0xB1<<3)|4: _M6502_LABEL(0xB1,4) _SA(c->AD+c->Y);break;
+        case (0xB1<<3)|5: _M6502_LABEL(0xB1,5) c->A=_GD();_NZ(c->A);_FETCH();break;
+        case (0xB1<<3)|6: _M6502_LABEL(0xB1,6) assert(false);break;
+        case (0xB1<<3)|7: _M6502_LABEL(0xB1,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0xB2<<3)|0: _SA(c->PC);break;
-        case (0xB2<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0xB2<<3)|2: assert(false);break;
-        case (0xB2<<3)|3: assert(false);break;
-        case (0xB2<<3)|4: assert(false);break;
-        case (0xB2<<3)|5: assert(false);break;
-        case (0xB2<<3)|6: assert(false);break;
-        case (0xB2<<3)|7: assert(false);break;
+        case (0xB2<<3)|0: _M6502_LABEL(0xB2,0) _SA(c->PC);break;
+        case (0xB2<<3)|1: _M6502_LABEL(0xB2,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0xB2<<3)|2: _M6502_LABEL(0xB2,2) assert(false);break;
+        case (0xB2<<3)|3: _M6502_LABEL(0xB2,3) assert(false);break;
+        case (0xB2<<3)|4: _M6502_LABEL(0xB2,4) assert(false);break;
+        case (0xB2<<3)|5: _M6502_LABEL(0xB2,5) assert(false);break;
+        case (0xB2<<3)|6: _M6502_LABEL(0xB2,6) assert(false);break;
+        case (0xB2<<3)|7: _M6502_LABEL(0xB2,7) assert(false);break;
     /* LAX (zp),Y (undoc) */
-        case (0xB3<<3)|0: _SA(c->PC++);break;
-        case (0xB3<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xB3<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xB3<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0xB3<<3)|4: _SA(c->AD+c->Y);break;
-        case (0xB3<<3)|5: c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
-        case (0xB3<<3)|6: assert(false);break;
-        case (0xB3<<3)|7: assert(false);break;
+        case (0xB3<<3)|0: _M6502_LABEL(0xB3,0) _SA(c->PC++);break;
+        case (0xB3<<3)|1: _M6502_LABEL(0xB3,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xB3<<3)|2: _M6502_LABEL(0xB3,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xB3<<3)|3: _M6502_LABEL(0xB3,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0xB3<<3)|4: _M6502_LABEL(0xB3,4) _SA(c->AD+c->Y);break;
+        case (0xB3<<3)|5: _M6502_LABEL(0xB3,5) c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
+        case (0xB3<<3)|6: _M6502_LABEL(0xB3,6) assert(false);break;
+        case (0xB3<<3)|7: _M6502_LABEL(0xB3,7) assert(false);break;
     /* LDY zp,X */
-        case (0xB4<<3)|0: _SA(c->PC++);break;
-        case (0xB4<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xB4<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0xB4<<3)|3: c->Y=_GD();_NZ(c->Y);_FETCH();break;
-        case (0xB4<<3)|4: assert(false);break;
-        case (0xB4<<3)|5: assert(false);break;
-        case (0xB4<<3)|6: assert(false);break;
-        case (0xB4<<3)|7: assert(false);break;
+        case (0xB4<<3)|0: _M6502_LABEL(0xB4,0) _SA(c->PC++);break;
+        case (0xB4<<3)|1: _M6502_LABEL(0xB4,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xB4<<3)|2: _M6502_LABEL(0xB4,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0xB4<<3)|3: _M6502_LABEL(0xB4,3) c->Y=_GD();_NZ(c->Y);_FETCH();break;
+        case (0xB4<<3)|4: _M6502_LABEL(0xB4,4) assert(false);break;
+        case (0xB4<<3)|5: _M6502_LABEL(0xB4,5) assert(false);break;
+        case (0xB4<<3)|6: _M6502_LABEL(0xB4,6) assert(false);break;
+        case (0xB4<<3)|7: _M6502_LABEL(0xB4,7) assert(false);break;
     /* LDA zp,X */
-        case (0xB5<<3)|0: _SA(c->PC++);break;
-        case (0xB5<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xB5<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0xB5<<3)|3: c->A=_GD();_NZ(c->A);_FETCH();break;
-        case (0xB5<<3)|4: assert(false);break;
-        case (0xB5<<3)|5: assert(false);break;
-        case (0xB5<<3)|6: assert(false);break;
-        case (0xB5<<3)|7: assert(false);break;
+        case (0xB5<<3)|0: _M6502_LABEL(0xB5,0) _SA(c->PC++);break;
+        case (0xB5<<3)|1: _M6502_LABEL(0xB5,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xB5<<3)|2: _M6502_LABEL(0xB5,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0xB5<<3)|3: _M6502_LABEL(0xB5,3) c->A=_GD();_NZ(c->A);_FETCH();break;
+        case (0xB5<<3)|4: _M6502_LABEL(0xB5,4) assert(false);break;
+        case (0xB5<<3)|5: _M6502_LABEL(0xB5,5) assert(false);break;
+        case (0xB5<<3)|6: _M6502_LABEL(0xB5,6) assert(false);break;
+        case (0xB5<<3)|7: _M6502_LABEL(0xB5,7) assert(false);break;
     /* LDX zp,Y */
-        case (0xB6<<3)|0: _SA(c->PC++);break;
-        case (0xB6<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xB6<<3)|2: _SA((c->AD+c->Y)&0x00FF);break;
-        case (0xB6<<3)|3: c->X=_GD();_NZ(c->X);_FETCH();break;
-        case (0xB6<<3)|4: assert(false);break;
-        case (0xB6<<3)|5: assert(false);break;
-        case (0xB6<<3)|6: assert(false);break;
-        case (0xB6<<3)|7: assert(false);break;
+        case (0xB6<<3)|0: _M6502_LABEL(0xB6,0) _SA(c->PC++);break;
+        case (0xB6<<3)|1: _M6502_LABEL(0xB6,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xB6<<3)|2: _M6502_LABEL(0xB6,2) _SA((c->AD+c->Y)&0x00FF);break;
+        case (0xB6<<3)|3: _M6502_LABEL(0xB6,3) c->X=_GD();_NZ(c->X);_FETCH();break;
+        case (0xB6<<3)|4: _M6502_LABEL(0xB6,4) assert(false);break;
+        case (0xB6<<3)|5: _M6502_LABEL(0xB6,5) assert(false);break;
+        case (0xB6<<3)|6: _M6502_LABEL(0xB6,6) assert(false);break;
+        case (0xB6<<3)|7: _M6502_LABEL(0xB6,7) assert(false);break;
     /* LAX zp,Y (undoc) */
-        case (0xB7<<3)|0: _SA(c->PC++);break;
-        case (0xB7<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xB7<<3)|2: _SA((c->AD+c->Y)&0x00FF);break;
-        case (0xB7<<3)|3: c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
-        case (0xB7<<3)|4: assert(false);break;
-        case (0xB7<<3)|5: assert(false);break;
-        case (0xB7<<3)|6: assert(false);break;
-        case (0xB7<<3)|7: assert(false);break;
+        case (0xB7<<3)|0: _M6502_LABEL(0xB7,0) _SA(c->PC++);break;
+        case (0xB7<<3)|1: _M6502_LABEL(0xB7,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xB7<<3)|2: _M6502_LABEL(0xB7,2) _SA((c->AD+c->Y)&0x00FF);break;
+        case (0xB7<<3)|3: _M6502_LABEL(0xB7,3) c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
+        case (0xB7<<3)|4: _M6502_LABEL(0xB7,4) assert(false);break;
+        case (0xB7<<3)|5: _M6502_LABEL(0xB7,5) assert(false);break;
+        case (0xB7<<3)|6: _M6502_LABEL(0xB7,6) assert(false);break;
+        case (0xB7<<3)|7: _M6502_LABEL(0xB7,7) assert(false);break;
     /* CLV  */
-        case (0xB8<<3)|0: _SA(c->PC);break;
-        case (0xB8<<3)|1: c->P&=~0x40;_FETCH();break;
-        case (0xB8<<3)|2: assert(false);break;
-        case (0xB8<<3)|3: assert(false);break;
-        case (0xB8<<3)|4: assert(false);break;
-        case (0xB8<<3)|5: assert(false);break;
-        case (0xB8<<3)|6: assert(false);break;
-        case (0xB8<<3)|7: assert(false);break;
+        case (0xB8<<3)|0: _M6502_LABEL(0xB8,0) _SA(c->PC);break;
+        case (0xB8<<3)|1: _M6502_LABEL(0xB8,1) c->P&=~0x40;_FETCH();break;
+        case (0xB8<<3)|2: _M6502_LABEL(0xB8,2) assert(false);break;
+        case (0xB8<<3)|3: _M6502_LABEL(0xB8,3) assert(false);break;
+        case (0xB8<<3)|4: _M6502_LABEL(0xB8,4) assert(false);break;
+        case (0xB8<<3)|5: _M6502_LABEL(0xB8,5) assert(false);break;
+        case (0xB8<<3)|6: _M6502_LABEL(0xB8,6) assert(false);break;
+        case (0xB8<<3)|7: _M6502_LABEL(0xB8,7) assert(false);break;
     /* LDA abs,Y */
-        case (0xB9<<3)|0: _SA(c->PC++);break;
-        case (0xB9<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xB9<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0xB9<<3)|3: _SA(c->AD+c->Y);break;
-        case (0xB9<<3)|4: c->A=_GD();_NZ(c->A);_FETCH();break;
-        case (0xB9<<3)|5: assert(false);break;
-        case (0xB9<<3)|6: assert(false);break;
-        case (0xB9<<3)|7: assert(false);break;
+        case (0xB9<<3)|0: _M6502_LABEL(0xB9,0) _SA(c->PC++);break;
+        case (0xB9<<3)|1: _M6502_LABEL(0xB9,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xB9<<3)|2: _M6502_LABEL(0xB9,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0xB9<<3)|3: _M6502_LABEL(0xB9,3) _SA(c->AD+c->Y);break;
+        case (0xB9<<3)|4: _M6502_LABEL(0xB9,4) c->A=_GD();_NZ(c->A);_FETCH();break;
+        case (0xB9<<3)|5: _M6502_LABEL(0xB9,5) assert(false);break;
+        case (0xB9<<3)|6: _M6502_LABEL(0xB9,6) assert(false);break;
+        case (0xB9<<3)|7: _M6502_LABEL(0xB9,7) assert(false);break;
     /* TSX  */
-        case (0xBA<<3)|0: _SA(c->PC);break;
-        case (0xBA<<3)|1: c->X=c->S;_NZ(c->X);_FETCH();break;
-        case (0xBA<<3)|2: assert(false);break;
-        case (0xBA<<3)|3: assert(false);break;
-        case (0xBA<<3)|4: assert(false);break;
-        case (0xBA<<3)|5: assert(false);break;
-        case (0xBA<<3)|6: assert(false);break;
-        case (0xBA<<3)|7: assert(false);break;
+        case (0xBA<<3)|0: _M6502_LABEL(0xBA,0) _SA(c->PC);break;
+        case (0xBA<<3)|1: _M6502_LABEL(0xBA,1) c->X=c->S;_NZ(c->X);_FETCH();break;
+        case (0xBA<<3)|2: _M6502_LABEL(0xBA,2) assert(false);break;
+        case (0xBA<<3)|3: _M6502_LABEL(0xBA,3) assert(false);break;
+        case (0xBA<<3)|4: _M6502_LABEL(0xBA,4) assert(false);break;
+        case (0xBA<<3)|5: _M6502_LABEL(0xBA,5) assert(false);break;
+        case (0xBA<<3)|6: _M6502_LABEL(0xBA,6) assert(false);break;
+        case (0xBA<<3)|7: _M6502_LABEL(0xBA,7) assert(false);break;
     /* LAS abs,Y (undoc) */
-        case (0xBB<<3)|0: _SA(c->PC++);break;
-        case (0xBB<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xBB<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0xBB<<3)|3: _SA(c->AD+c->Y);break;
-        case (0xBB<<3)|4: c->A=c->X=c->S=_GD()&c->S;_NZ(c->A);_FETCH();break;
-        case (0xBB<<3)|5: assert(false);break;
-        case (0xBB<<3)|6: assert(false);break;
-        case (0xBB<<3)|7: assert(false);break;
+        case (0xBB<<3)|0: _M6502_LABEL(0xBB,0) _SA(c->PC++);break;
+        case (0xBB<<3)|1: _M6502_LABEL(0xBB,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xBB<<3)|2: _M6502_LABEL(0xBB,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0xBB<<3)|3: _M6502_LABEL(0xBB,3) _SA(c->AD+c->Y);break;
+        case (0xBB<<3)|4: _M6502_LABEL(0xBB,4) c->A=c->X=c->S=_GD()&c->S;_NZ(c->A);_FETCH();break;
+        case (0xBB<<3)|5: _M6502_LABEL(0xBB,5) assert(false);break;
+        case (0xBB<<3)|6: _M6502_LABEL(0xBB,6) assert(false);break;
+        case (0xBB<<3)|7: _M6502_LABEL(0xBB,7) assert(false);break;
     /* LDY abs,X */
-        case (0xBC<<3)|0: _SA(c->PC++);break;
-        case (0xBC<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xBC<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0xBC<<3)|3: _SA(c->AD+c->X);break;
-        case (0xBC<<3)|4: c->Y=_GD();_NZ(c->Y);_FETCH();break;
-        case (0xBC<<3)|5: assert(false);break;
-        case (0xBC<<3)|6: assert(false);break;
-        case (0xBC<<3)|7: assert(false);break;
+        case (0xBC<<3)|0: _M6502_LABEL(0xBC,0) _SA(c->PC++);break;
+        case (0xBC<<3)|1: _M6502_LABEL(0xBC,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xBC<<3)|2: _M6502_LABEL(0xBC,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0xBC<<3)|3: _M6502_LABEL(0xBC,3) _SA(c->AD+c->X);break;
+        case (0xBC<<3)|4: _M6502_LABEL(0xBC,4) c->Y=_GD();_NZ(c->Y);_FETCH();break;
+        case (0xBC<<3)|5: _M6502_LABEL(0xBC,5) assert(false);break;
+        case (0xBC<<3)|6: _M6502_LABEL(0xBC,6) assert(false);break;
+        case (0xBC<<3)|7: _M6502_LABEL(0xBC,7) assert(false);break;
     /* LDA abs,X */
-        case (0xBD<<3)|0: _SA(c->PC++);break;
-        case (0xBD<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xBD<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0xBD<<3)|3: _SA(c->AD+c->X);break;
-        case (0xBD<<3)|4: c->A=_GD();_NZ(c->A);_FETCH();break;
-        case (0xBD<<3)|5: assert(false);break;
-        case (0xBD<<3)|6: assert(false);break;
-        case (0xBD<<3)|7: assert(false);break;
+        case (0xBD<<3)|0: _M6502_LABEL(0xBD,0) _SA(c->PC++);break;
+        case (0xBD<<3)|1: _M6502_LABEL(0xBD,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xBD<<3)|2: _M6502_LABEL(0xBD,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0xBD<<3)|3: _M6502_LABEL(0xBD,3) _SA(c->AD+c->X);break;
+        case (0xBD<<3)|4: _M6502_LABEL(0xBD,4) c->A=_GD();_NZ(c->A);_FETCH();break;
+        case (0xBD<<3)|5: _M6502_LABEL(0xBD,5) assert(false);break;
+        case (0xBD<<3)|6: _M6502_LABEL(0xBD,6) assert(false);break;
+        case (0xBD<<3)|7: _M6502_LABEL(0xBD,7) assert(false);break;
     /* LDX abs,Y */
-        case (0xBE<<3)|0: _SA(c->PC++);break;
-        case (0xBE<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xBE<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0xBE<<3)|3: _SA(c->AD+c->Y);break;
-        case (0xBE<<3)|4: c->X=_GD();_NZ(c->X);_FETCH();break;
-        case (0xBE<<3)|5: assert(false);break;
-        case (0xBE<<3)|6: assert(false);break;
-        case (0xBE<<3)|7: assert(false);break;
+        case (0xBE<<3)|0: _M6502_LABEL(0xBE,0) _SA(c->PC++);break;
+        case (0xBE<<3)|1: _M6502_LABEL(0xBE,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xBE<<3)|2: _M6502_LABEL(0xBE,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0xBE<<3)|3: _M6502_LABEL(0xBE,3) _SA(c->AD+c->Y);break;
+        case (0xBE<<3)|4: _M6502_LABEL(0xBE,4) c->X=_GD();_NZ(c->X);_FETCH();break;
+        case (0xBE<<3)|5: _M6502_LABEL(0xBE,5) assert(false);break;
+        case (0xBE<<3)|6: _M6502_LABEL(0xBE,6) assert(false);break;
+        case (0xBE<<3)|7: _M6502_LABEL(0xBE,7) assert(false);break;
     /* LAX abs,Y (undoc) */
-        case (0xBF<<3)|0: _SA(c->PC++);break;
-        case (0xBF<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xBF<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0xBF<<3)|3: _SA(c->AD+c->Y);break;
-        case (0xBF<<3)|4: c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
-        case (0xBF<<3)|5: assert(false);break;
-        case (0xBF<<3)|6: assert(false);break;
-        case (0xBF<<3)|7: assert(false);break;
+        case (0xBF<<3)|0: _M6502_LABEL(0xBF,0) _SA(c->PC++);break;
+        case (0xBF<<3)|1: _M6502_LABEL(0xBF,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xBF<<3)|2: _M6502_LABEL(0xBF,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0xBF<<3)|3: _M6502_LABEL(0xBF,3) _SA(c->AD+c->Y);break;
+        case (0xBF<<3)|4: _M6502_LABEL(0xBF,4) c->A=c->X=_GD();_NZ(c->A);_FETCH();break;
+        case (0xBF<<3)|5: _M6502_LABEL(0xBF,5) assert(false);break;
+        case (0xBF<<3)|6: _M6502_LABEL(0xBF,6) assert(false);break;
+        case (0xBF<<3)|7: _M6502_LABEL(0xBF,7) assert(false);break;
     /* CPY # */
-        case (0xC0<<3)|0: _SA(c->PC++);break;
-        case (0xC0<<3)|1: _m6502_cmp(c, c->Y, _GD());_FETCH();break;
-        case (0xC0<<3)|2: assert(false);break;
-        case (0xC0<<3)|3: assert(false);break;
-        case (0xC0<<3)|4: assert(false);break;
-        case (0xC0<<3)|5: assert(false);break;
-        case (0xC0<<3)|6: assert(false);break;
-        case (0xC0<<3)|7: assert(false);break;
+        case (0xC0<<3)|0: _M6502_LABEL(0xC0,0) _SA(c->PC++);break;
+        case (0xC0<<3)|1: _M6502_LABEL(0xC0,1) _m6502_cmp(c, c->Y, _GD());_FETCH();break;
+        case (0xC0<<3)|2: _M6502_LABEL(0xC0,2) assert(false);break;
+        case (0xC0<<3)|3: _M6502_LABEL(0xC0,3) assert(false);break;
+        case (0xC0<<3)|4: _M6502_LABEL(0xC0,4) assert(false);break;
+        case (0xC0<<3)|5: _M6502_LABEL(0xC0,5) assert(false);break;
+        case (0xC0<<3)|6: _M6502_LABEL(0xC0,6) assert(false);break;
+        case (0xC0<<3)|7: _M6502_LABEL(0xC0,7) assert(false);break;
     /* CMP (zp,X) */
-        case (0xC1<<3)|0: _SA(c->PC++);break;
-        case (0xC1<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xC1<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0xC1<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xC1<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0xC1<<3)|5: _m6502_cmp(c, c->A, _GD());_FETCH();break;
-        case (0xC1<<3)|6: assert(false);break;
-        case (0xC1<<3)|7: assert(false);break;
+        case (0xC1<<3)|0: _M6502_LABEL(0xC1,0) _SA(c->PC++);break;
+        case (0xC1<<3)|1: _M6502_LABEL(0xC1,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xC1<<3)|2: _M6502_LABEL(0xC1,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0xC1<<3)|3: _M6502_LABEL(0xC1,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xC1<<3)|4: _M6502_LABEL(0xC1,4) _SA((_GD()<<8)|c->AD);break;
+        case (0xC1<<3)|5: _M6502_LABEL(0xC1,5) _m6502_cmp(c, c->A, _GD());_FETCH();break;
+        case (0xC1<<3)|6: _M6502_LABEL(0xC1,6) assert(false);break;
+        case (0xC1<<3)|7: _M6502_LABEL(0xC1,7) assert(false);break;
     /* NOP # (undoc) */
-        case (0xC2<<3)|0: _SA(c->PC++);break;
-        case (0xC2<<3)|1: _FETCH();break;
-        case (0xC2<<3)|2: assert(false);break;
-        case (0xC2<<3)|3: assert(false);break;
-        case (0xC2<<3)|4: assert(false);break;
-        case (0xC2<<3)|5: assert(false);break;
-        case (0xC2<<3)|6: assert(false);break;
-        case (0xC2<<3)|7: assert(false);break;
+        case (0xC2<<3)|0: _M6502_LABEL(0xC2,0) _SA(c->PC++);break;
+        case (0xC2<<3)|1: _M6502_LABEL(0xC2,1) _FETCH();break;
+        case (0xC2<<3)|2: _M6502_LABEL(0xC2,2) assert(false);break;
+        case (0xC2<<3)|3: _M6502_LABEL(0xC2,3) assert(false);break;
+        case (0xC2<<3)|4: _M6502_LABEL(0xC2,4) assert(false);break;
+        case (0xC2<<3)|5: _M6502_LABEL(0xC2,5) assert(false);break;
+        case (0xC2<<3)|6: _M6502_LABEL(0xC2,6) assert(false);break;
+        case (0xC2<<3)|7: _M6502_LABEL(0xC2,7) assert(false);break;
     /* DCP (zp,X) (undoc) */
-        case (0xC3<<3)|0: _SA(c->PC++);break;
-        case (0xC3<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xC3<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0xC3<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xC3<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0xC3<<3)|5: c->AD=_GD();_WR();break;
-        case (0xC3<<3)|6: c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
-        case (0xC3<<3)|7: _FETCH();break;
+        case (0xC3<<3)|0: _M6502_LABEL(0xC3,0) _SA(c->PC++);break;
+        case (0xC3<<3)|1: _M6502_LABEL(0xC3,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xC3<<3)|2: _M6502_LABEL(0xC3,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0xC3<<3)|3: _M6502_LABEL(0xC3,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xC3<<3)|4: _M6502_LABEL(0xC3,4) _SA((_GD()<<8)|c->AD);break;
+        case (0xC3<<3)|5: _M6502_LABEL(0xC3,5) c->AD=_GD();_WR();break;
+        case (0xC3<<3)|6: _M6502_LABEL(0xC3,6) c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
+        case (0xC3<<3)|7: _M6502_LABEL(0xC3,7) _FETCH();break;
     /* CPY zp */
-        case (0xC4<<3)|0: _SA(c->PC++);break;
-        case (0xC4<<3)|1: _SA(_GD());break;
-        case (0xC4<<3)|2: _m6502_cmp(c, c->Y, _GD());_FETCH();break;
-        case (0xC4<<3)|3: assert(false);break;
-        case (0xC4<<3)|4: assert(false);break;
-        case (0xC4<<3)|5: assert(false);break;
-        case (0xC4<<3)|6: assert(false);break;
-        case (0xC4<<3)|7: assert(false);break;
+        case (0xC4<<3)|0: _M6502_LABEL(0xC4,0) _SA(c->PC++);break;
+        case (0xC4<<3)|1: _M6502_LABEL(0xC4,1) _SA(_GD());break;
+        case (0xC4<<3)|2: _M6502_LABEL(0xC4,2) _m6502_cmp(c, c->Y, _GD());_FETCH();break;
+        case (0xC4<<3)|3: _M6502_LABEL(0xC4,3) assert(false);break;
+        case (0xC4<<3)|4: _M6502_LABEL(0xC4,4) assert(false);break;
+        case (0xC4<<3)|5: _M6502_LABEL(0xC4,5) assert(false);break;
+        case (0xC4<<3)|6: _M6502_LABEL(0xC4,6) assert(false);break;
+        case (0xC4<<3)|7: _M6502_LABEL(0xC4,7) assert(false);break;
     /* CMP zp */
-        case (0xC5<<3)|0: _SA(c->PC++);break;
-        case (0xC5<<3)|1: _SA(_GD());break;
-        case (0xC5<<3)|2: _m6502_cmp(c, c->A, _GD());_FETCH();break;
-        case (0xC5<<3)|3: assert(false);break;
-        case (0xC5<<3)|4: assert(false);break;
-        case (0xC5<<3)|5: assert(false);break;
-        case (0xC5<<3)|6: assert(false);break;
-        case (0xC5<<3)|7: assert(false);break;
+        case (0xC5<<3)|0: _M6502_LABEL(0xC5,0) _SA(c->PC++);break;
+        case (0xC5<<3)|1: _M6502_LABEL(0xC5,1) _SA(_GD());break;
+        case (0xC5<<3)|2: _M6502_LABEL(0xC5,2) _m6502_cmp(c, c->A, _GD());_FETCH();break;
+        case (0xC5<<3)|3: _M6502_LABEL(0xC5,3) assert(false);break;
+        case (0xC5<<3)|4: _M6502_LABEL(0xC5,4) assert(false);break;
+        case (0xC5<<3)|5: _M6502_LABEL(0xC5,5) assert(false);break;
+        case (0xC5<<3)|6: _M6502_LABEL(0xC5,6) assert(false);break;
+        case (0xC5<<3)|7: _M6502_LABEL(0xC5,7) assert(false);break;
     /* DEC zp */
-        case (0xC6<<3)|0: _SA(c->PC++);break;
-        case (0xC6<<3)|1: _SA(_GD());break;
-        case (0xC6<<3)|2: c->AD=_GD();_WR();break;
-        case (0xC6<<3)|3: c->AD--;_NZ(c->AD);_SD(c->AD);_WR();break;
-        case (0xC6<<3)|4: _FETCH();break;
-        case (0xC6<<3)|5: assert(false);break;
-        case (0xC6<<3)|6: assert(false);break;
-        case (0xC6<<3)|7: assert(false);break;
+        case (0xC6<<3)|0: _M6502_LABEL(0xC6,0) _SA(c->PC++);break;
+        case (0xC6<<3)|1: _M6502_LABEL(0xC6,1) _SA(_GD());break;
+        case (0xC6<<3)|2: _M6502_LABEL(0xC6,2) c->AD=_GD();_WR();break;
+        case (0xC6<<3)|3: _M6502_LABEL(0xC6,3) c->AD--;_NZ(c->AD);_SD(c->AD);_WR();break;
+        case (0xC6<<3)|4: _M6502_LABEL(0xC6,4) _FETCH();break;
+        case (0xC6<<3)|5: _M6502_LABEL(0xC6,5) assert(false);break;
+        case (0xC6<<3)|6: _M6502_LABEL(0xC6,6) assert(false);break;
+        case (0xC6<<3)|7: _M6502_LABEL(0xC6,7) assert(false);break;
     /* DCP zp (undoc) */
-        case (0xC7<<3)|0: _SA(c->PC++);break;
-        case (0xC7<<3)|1: _SA(_GD());break;
-        case (0xC7<<3)|2: c->AD=_GD();_WR();break;
-        case (0xC7<<3)|3: c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
-        case (0xC7<<3)|4: _FETCH();break;
-        case (0xC7<<3)|5: assert(false);break;
-        case (0xC7<<3)|6: assert(false);break;
-        case (0xC7<<3)|7: assert(false);break;
+        case (0xC7<<3)|0: _M6502_LABEL(0xC7,0) _SA(c->PC++);break;
+        case (0xC7<<3)|1: _M6502_LABEL(0xC7,1) _SA(_GD());break;
+        case (0xC7<<3)|2: _M6502_LABEL(0xC7,2) c->AD=_GD();_WR();break;
+        case (0xC7<<3)|3: _M6502_LABEL(0xC7,3) c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
+        case (0xC7<<3)|4: _M6502_LABEL(0xC7,4) _FETCH();break;
+        case (0xC7<<3)|5: _M6502_LABEL(0xC7,5) assert(false);break;
+        case (0xC7<<3)|6: _M6502_LABEL(0xC7,6) assert(false);break;
+        case (0xC7<<3)|7: _M6502_LABEL(0xC7,7) assert(false);break;
     /* INY  */
-        case (0xC8<<3)|0: _SA(c->PC);break;
-        case (0xC8<<3)|1: c->Y++;_NZ(c->Y);_FETCH();break;
-        case (0xC8<<3)|2: assert(false);break;
-        case (0xC8<<3)|3: assert(false);break;
-        case (0xC8<<3)|4: assert(false);break;
-        case (0xC8<<3)|5: assert(false);break;
-        case (0xC8<<3)|6: assert(false);break;
-        case (0xC8<<3)|7: assert(false);break;
+        case (0xC8<<3)|0: _M6502_LABEL(0xC8,0) _SA(c->PC);break;
+        case (0xC8<<3)|1: _M6502_LABEL(0xC8,1) c->Y++;_NZ(c->Y);_FETCH();break;
+        case (0xC8<<3)|2: _M6502_LABEL(0xC8,2) assert(false);break;
+        case (0xC8<<3)|3: _M6502_LABEL(0xC8,3) assert(false);break;
+        case (0xC8<<3)|4: _M6502_LABEL(0xC8,4) assert(false);break;
+        case (0xC8<<3)|5: _M6502_LABEL(0xC8,5) assert(false);break;
+        case (0xC8<<3)|6: _M6502_LABEL(0xC8,6) assert(false);break;
+        case (0xC8<<3)|7: _M6502_LABEL(0xC8,7) assert(false);break;
     /* CMP # */
-        case (0xC9<<3)|0: _SA(c->PC++);break;
-        case (0xC9<<3)|1: _m6502_cmp(c, c->A, _GD());_FETCH();break;
-        case (0xC9<<3)|2: assert(false);break;
-        case (0xC9<<3)|3: assert(false);break;
-        case (0xC9<<3)|4: assert(false);break;
-        case (0xC9<<3)|5: assert(false);break;
-        case (0xC9<<3)|6: assert(false);break;
-        case (0xC9<<3)|7: assert(false);break;
+        case (0xC9<<3)|0: _M6502_LABEL(0xC9,0) _SA(c->PC++);break;
+        case (0xC9<<3)|1: _M6502_LABEL(0xC9,1) _m6502_cmp(c, c->A, _GD());_FETCH();break;
+        case (0xC9<<3)|2: _M6502_LABEL(0xC9,2) assert(false);break;
+        case (0xC9<<3)|3: _M6502_LABEL(0xC9,3) assert(false);break;
+        case (0xC9<<3)|4: _M6502_LABEL(0xC9,4) assert(false);break;
+        case (0xC9<<3)|5: _M6502_LABEL(0xC9,5) assert(false);break;
+        case (0xC9<<3)|6: _M6502_LABEL(0xC9,6) assert(false);break;
+        case (0xC9<<3)|7: _M6502_LABEL(0xC9,7) assert(false);break;
     /* DEX  */
-        case (0xCA<<3)|0: _SA(c->PC);break;
-        case (0xCA<<3)|1: c->X--;_NZ(c->X);_FETCH();break;
-        case (0xCA<<3)|2: assert(false);break;
-        case (0xCA<<3)|3: assert(false);break;
-        case (0xCA<<3)|4: assert(false);break;
-        case (0xCA<<3)|5: assert(false);break;
-        case (0xCA<<3)|6: assert(false);break;
-        case (0xCA<<3)|7: assert(false);break;
+        case (0xCA<<3)|0: _M6502_LABEL(0xCA,0) _SA(c->PC);break;
+        case (0xCA<<3)|1: _M6502_LABEL(0xCA,1) c->X--;_NZ(c->X);_FETCH();break;
+        case (0xCA<<3)|2: _M6502_LABEL(0xCA,2) assert(false);break;
+        case (0xCA<<3)|3: _M6502_LABEL(0xCA,3) assert(false);break;
+        case (0xCA<<3)|4: _M6502_LABEL(0xCA,4) assert(false);break;
+        case (0xCA<<3)|5: _M6502_LABEL(0xCA,5) assert(false);break;
+        case (0xCA<<3)|6: _M6502_LABEL(0xCA,6) assert(false);break;
+        case (0xCA<<3)|7: _M6502_LABEL(0xCA,7) assert(false);break;
     /* SBX # (undoc) */
-        case (0xCB<<3)|0: _SA(c->PC++);break;
-        case (0xCB<<3)|1: _m6502_sbx(c, _GD());_FETCH();break;
-        case (0xCB<<3)|2: assert(false);break;
-        case (0xCB<<3)|3: assert(false);break;
-        case (0xCB<<3)|4: assert(false);break;
-        case (0xCB<<3)|5: assert(false);break;
-        case (0xCB<<3)|6: assert(false);break;
-        case (0xCB<<3)|7: assert(false);break;
+        case (0xCB<<3)|0: _M6502_LABEL(0xCB,0) _SA(c->PC++);break;
+        case (0xCB<<3)|1: _M6502_LABEL(0xCB,1) _m6502_sbx(c, _GD());_FETCH();break;
+        case (0xCB<<3)|2: _M6502_LABEL(0xCB,2) assert(false);break;
+        case (0xCB<<3)|3: _M6502_LABEL(0xCB,3) assert(false);break;
+        case (0xCB<<3)|4: _M6502_LABEL(0xCB,4) assert(false);break;
+        case (0xCB<<3)|5: _M6502_LABEL(0xCB,5) assert(false);break;
+        case (0xCB<<3)|6: _M6502_LABEL(0xCB,6) assert(false);break;
+        case (0xCB<<3)|7: _M6502_LABEL(0xCB,7) assert(false);break;
     /* CPY abs */
-        case (0xCC<<3)|0: _SA(c->PC++);break;
-        case (0xCC<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xCC<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xCC<<3)|3: _m6502_cmp(c, c->Y, _GD());_FETCH();break;
-        case (0xCC<<3)|4: assert(false);break;
-        case (0xCC<<3)|5: assert(false);break;
-        case (0xCC<<3)|6: assert(false);break;
-        case (0xCC<<3)|7: assert(false);break;
+        case (0xCC<<3)|0: _M6502_LABEL(0xCC,0) _SA(c->PC++);break;
+        case (0xCC<<3)|1: _M6502_LABEL(0xCC,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xCC<<3)|2: _M6502_LABEL(0xCC,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xCC<<3)|3: _M6502_LABEL(0xCC,3) _m6502_cmp(c, c->Y, _GD());_FETCH();break;
+        case (0xCC<<3)|4: _M6502_LABEL(0xCC,4) assert(false);break;
+        case (0xCC<<3)|5: _M6502_LABEL(0xCC,5) assert(false);break;
+        case (0xCC<<3)|6: _M6502_LABEL(0xCC,6) assert(false);break;
+        case (0xCC<<3)|7: _M6502_LABEL(0xCC,7) assert(false);break;
     /* CMP abs */
-        case (0xCD<<3)|0: _SA(c->PC++);break;
-        case (0xCD<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xCD<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xCD<<3)|3: _m6502_cmp(c, c->A, _GD());_FETCH();break;
-        case (0xCD<<3)|4: assert(false);break;
-        case (0xCD<<3)|5: assert(false);break;
-        case (0xCD<<3)|6: assert(false);break;
-        case (0xCD<<3)|7: assert(false);break;
+        case (0xCD<<3)|0: _M6502_LABEL(0xCD,0) _SA(c->PC++);break;
+        case (0xCD<<3)|1: _M6502_LABEL(0xCD,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xCD<<3)|2: _M6502_LABEL(0xCD,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xCD<<3)|3: _M6502_LABEL(0xCD,3) _m6502_cmp(c, c->A, _GD());_FETCH();break;
+        case (0xCD<<3)|4: _M6502_LABEL(0xCD,4) assert(false);break;
+        case (0xCD<<3)|5: _M6502_LABEL(0xCD,5) assert(false);break;
+        case (0xCD<<3)|6: _M6502_LABEL(0xCD,6) assert(false);break;
+        case (0xCD<<3)|7: _M6502_LABEL(0xCD,7) assert(false);break;
     /* DEC abs */
-        case (0xCE<<3)|0: _SA(c->PC++);break;
-        case (0xCE<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xCE<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xCE<<3)|3: c->AD=_GD();_WR();break;
-        case (0xCE<<3)|4: c->AD--;_NZ(c->AD);_SD(c->AD);_WR();break;
-        case (0xCE<<3)|5: _FETCH();break;
-        case (0xCE<<3)|6: assert(false);break;
-        case (0xCE<<3)|7: assert(false);break;
+        case (0xCE<<3)|0: _M6502_LABEL(0xCE,0) _SA(c->PC++);break;
+        case (0xCE<<3)|1: _M6502_LABEL(0xCE,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xCE<<3)|2: _M6502_LABEL(0xCE,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xCE<<3)|3: _M6502_LABEL(0xCE,3) c->AD=_GD();_WR();break;
+        case (0xCE<<3)|4: _M6502_LABEL(0xCE,4) c->AD--;_NZ(c->AD);_SD(c->AD);_WR();break;
+        case (0xCE<<3)|5: _M6502_LABEL(0xCE,5) _FETCH();break;
+        case (0xCE<<3)|6: _M6502_LABEL(0xCE,6) assert(false);break;
+        case (0xCE<<3)|7: _M6502_LABEL(0xCE,7) assert(false);break;
     /* DCP abs (undoc) */
-        case (0xCF<<3)|0: _SA(c->PC++);break;
-        case (0xCF<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xCF<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xCF<<3)|3: c->AD=_GD();_WR();break;
-        case (0xCF<<3)|4: c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
-        case (0xCF<<3)|5: _FETCH();break;
-        case (0xCF<<3)|6: assert(false);break;
-        case (0xCF<<3)|7: assert(false);break;
+        case (0xCF<<3)|0: _M6502_LABEL(0xCF,0) _SA(c->PC++);break;
+        case (0xCF<<3)|1: _M6502_LABEL(0xCF,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xCF<<3)|2: _M6502_LABEL(0xCF,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xCF<<3)|3: _M6502_LABEL(0xCF,3) c->AD=_GD();_WR();break;
+        case (0xCF<<3)|4: _M6502_LABEL(0xCF,4) c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
+        case (0xCF<<3)|5: _M6502_LABEL(0xCF,5) _FETCH();break;
+        case (0xCF<<3)|6: _M6502_LABEL(0xCF,6) assert(false);break;
+        case (0xCF<<3)|7: _M6502_LABEL(0xCF,7) assert(false);break;
     /* BNE # */
-        case (0xD0<<3)|0: _SA(c->PC++);break;
-        case (0xD0<<3)|1: _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x2)!=0x0){_FETCH();};break;
-        case (0xD0<<3)|2: _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
-        case (0xD0<<3)|3: c->PC=c->AD;_FETCH();break;
-        case (0xD0<<3)|4: assert(false);break;
-        case (0xD0<<3)|5: assert(false);break;
-        case (0xD0<<3)|6: assert(false);break;
-        case (0xD0<<3)|7: assert(false);break;
+        case (0xD0<<3)|0: _M6502_LABEL(0xD0,0) _SA(c->PC++);break;
+        case (0xD0<<3)|1: _M6502_LABEL(0xD0,1) _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x2)!=0x0){_FETCH();};break;
+        case (0xD0<<3)|2: _M6502_LABEL(0xD0,2) _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
+        case (0xD0<<3)|3: _M6502_LABEL(0xD0,3) c->PC=c->AD;_FETCH();break;
+        case (0xD0<<3)|4: _M6502_LABEL(0xD0,4) assert(false);break;
+        case (0xD0<<3)|5: _M6502_LABEL(0xD0,5) assert(false);break;
+        case (0xD0<<3)|6: _M6502_LABEL(0xD0,6) assert(false);break;
+        case (0xD0<<3)|7: _M6502_LABEL(0xD0,7) assert(false);break;
     /* CMP (zp),Y */
-        case (0xD1<<3)|0: _SA(c->PC++);break;
-        case (0xD1<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xD1<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xD1<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0xD1<<3)|4: _SA(c->AD+c->Y);break;
-        case (0xD1<<3)|5: _m6502_cmp(c, c->A, _GD());_FETCH();break;
-        case (0xD1<<3)|6: assert(false);break;
-        case (0xD1<<3)|7: assert(false);break;
+        case (0xD1<<3)|0: _M6502_LABEL(0xD1,0) _SA(c->PC++);break;
+        case (0xD1<<3)|1: _M6502_LABEL(0xD1,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xD1<<3)|2: _M6502_LABEL(0xD1,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xD1<<3)|3: _M6502_LABEL(0xD1,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0xD1<<3)|4: _M6502_LABEL(0xD1,4) _SA(c->AD+c->Y);break;
+        case (0xD1<<3)|5: _M6502_LABEL(0xD1,5) _m6502_cmp(c, c->A, _GD());_FETCH();break;
+        case (0xD1<<3)|6: _M6502_LABEL(0xD1,6) assert(false);break;
+        case (0xD1<<3)|7: _M6502_LABEL(0xD1,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0xD2<<3)|0: _SA(c->PC);break;
-        case (0xD2<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0xD2<<3)|2: assert(false);break;
-        case (0xD2<<3)|3: assert(false);break;
-        case (0xD2<<3)|4: assert(false);break;
-        case (0xD2<<3)|5: assert(false);break;
-        case (0xD2<<3)|6: assert(false);break;
-        case (0xD2<<3)|7: assert(false);break;
+        case (0xD2<<3)|0: _M6502_LABEL(0xD2,0) _SA(c->PC);break;
+        case (0xD2<<3)|1: _M6502_LABEL(0xD2,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0xD2<<3)|2: _M6502_LABEL(0xD2,2) assert(false);break;
+        case (0xD2<<3)|3: _M6502_LABEL(0xD2,3) assert(false);break;
+        case (0xD2<<3)|4: _M6502_LABEL(0xD2,4) assert(false);break;
+        case (0xD2<<3)|5: _M6502_LABEL(0xD2,5) assert(false);break;
+        case (0xD2<<3)|6: _M6502_LABEL(0xD2,6) assert(false);break;
+        case (0xD2<<3)|7: _M6502_LABEL(0xD2,7) assert(false);break;
     /* DCP (zp),Y (undoc) */
-        case (0xD3<<3)|0: _SA(c->PC++);break;
-        case (0xD3<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xD3<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xD3<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0xD3<<3)|4: _SA(c->AD+c->Y);break;
-        case (0xD3<<3)|5: c->AD=_GD();_WR();break;
-        case (0xD3<<3)|6: c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
-        case (0xD3<<3)|7: _FETCH();break;
+        case (0xD3<<3)|0: _M6502_LABEL(0xD3,0) _SA(c->PC++);break;
+        case (0xD3<<3)|1: _M6502_LABEL(0xD3,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xD3<<3)|2: _M6502_LABEL(0xD3,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xD3<<3)|3: _M6502_LABEL(0xD3,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0xD3<<3)|4: _M6502_LABEL(0xD3,4) _SA(c->AD+c->Y);break;
+        case (0xD3<<3)|5: _M6502_LABEL(0xD3,5) c->AD=_GD();_WR();break;
+        case (0xD3<<3)|6: _M6502_LABEL(0xD3,6) c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
+        case (0xD3<<3)|7: _M6502_LABEL(0xD3,7) _FETCH();break;
     /* NOP zp,X (undoc) */
-        case (0xD4<<3)|0: _SA(c->PC++);break;
-        case (0xD4<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xD4<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0xD4<<3)|3: _FETCH();break;
-        case (0xD4<<3)|4: assert(false);break;
-        case (0xD4<<3)|5: assert(false);break;
-        case (0xD4<<3)|6: assert(false);break;
-        case (0xD4<<3)|7: assert(false);break;
+        case (0xD4<<3)|0: _M6502_LABEL(0xD4,0) _SA(c->PC++);break;
+        case (0xD4<<3)|1: _M6502_LABEL(0xD4,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xD4<<3)|2: _M6502_LABEL(0xD4,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0xD4<<3)|3: _M6502_LABEL(0xD4,3) _FETCH();break;
+        case (0xD4<<3)|4: _M6502_LABEL(0xD4,4) assert(false);break;
+        case (0xD4<<3)|5: _M6502_LABEL(0xD4,5) assert(false);break;
+        case (0xD4<<3)|6: _M6502_LABEL(0xD4,6) assert(false);break;
+        case (0xD4<<3)|7: _M6502_LABEL(0xD4,7) assert(false);break;
     /* CMP zp,X */
-        case (0xD5<<3)|0: _SA(c->PC++);break;
-        case (0xD5<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xD5<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0xD5<<3)|3: _m6502_cmp(c, c->A, _GD());_FETCH();break;
-        case (0xD5<<3)|4: assert(false);break;
-        case (0xD5<<3)|5: assert(false);break;
-        case (0xD5<<3)|6: assert(false);break;
-        case (0xD5<<3)|7: assert(false);break;
+        case (0xD5<<3)|0: _M6502_LABEL(0xD5,0) _SA(c->PC++);break;
+        case (0xD5<<3)|1: _M6502_LABEL(0xD5,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xD5<<3)|2: _M6502_LABEL(0xD5,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0xD5<<3)|3: _M6502_LABEL(0xD5,3) _m6502_cmp(c, c->A, _GD());_FETCH();break;
+        case (0xD5<<3)|4: _M6502_LABEL(0xD5,4) assert(false);break;
+        case (0xD5<<3)|5: _M6502_LABEL(0xD5,5) assert(false);break;
+        case (0xD5<<3)|6: _M6502_LABEL(0xD5,6) assert(false);break;
+        case (0xD5<<3)|7: _M6502_LABEL(0xD5,7) assert(false);break;
     /* DEC zp,X */
-        case (0xD6<<3)|0: _SA(c->PC++);break;
-        case (0xD6<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xD6<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0xD6<<3)|3: c->AD=_GD();_WR();break;
-        case (0xD6<<3)|4: c->AD--;_NZ(c->AD);_SD(c->AD);_WR();break;
-        case (0xD6<<3)|5: _FETCH();break;
-        case (0xD6<<3)|6: assert(false);break;
-        case (0xD6<<3)|7: assert(false);break;
+        case (0xD6<<3)|0: _M6502_LABEL(0xD6,0) _SA(c->PC++);break;
+        case (0xD6<<3)|1: _M6502_LABEL(0xD6,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xD6<<3)|2: _M6502_LABEL(0xD6,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0xD6<<3)|3: _M6502_LABEL(0xD6,3) c->AD=_GD();_WR();break;
+        case (0xD6<<3)|4: _M6502_LABEL(0xD6,4) c->AD--;_NZ(c->AD);_SD(c->AD);_WR();break;
+        case (0xD6<<3)|5: _M6502_LABEL(0xD6,5) _FETCH();break;
+        case (0xD6<<3)|6: _M6502_LABEL(0xD6,6) assert(false);break;
+        case (0xD6<<3)|7: _M6502_LABEL(0xD6,7) assert(false);break;
     /* DCP zp,X (undoc) */
-        case (0xD7<<3)|0: _SA(c->PC++);break;
-        case (0xD7<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xD7<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0xD7<<3)|3: c->AD=_GD();_WR();break;
-        case (0xD7<<3)|4: c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
-        case (0xD7<<3)|5: _FETCH();break;
-        case (0xD7<<3)|6: assert(false);break;
-        case (0xD7<<3)|7: assert(false);break;
+        case (0xD7<<3)|0: _M6502_LABEL(0xD7,0) _SA(c->PC++);break;
+        case (0xD7<<3)|1: _M6502_LABEL(0xD7,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xD7<<3)|2: _M6502_LABEL(0xD7,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0xD7<<3)|3: _M6502_LABEL(0xD7,3) c->AD=_GD();_WR();break;
+        case (0xD7<<3)|4: _M6502_LABEL(0xD7,4) c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
+        case (0xD7<<3)|5: _M6502_LABEL(0xD7,5) _FETCH();break;
+        case (0xD7<<3)|6: _M6502_LABEL(0xD7,6) assert(false);break;
+        case (0xD7<<3)|7: _M6502_LABEL(0xD7,7) assert(false);break;
     /* CLD  */
-        case (0xD8<<3)|0: _SA(c->PC);break;
-        case (0xD8<<3)|1: c->P&=~0x8;_FETCH();break;
-        case (0xD8<<3)|2: assert(false);break;
-        case (0xD8<<3)|3: assert(false);break;
-        case (0xD8<<3)|4: assert(false);break;
-        case (0xD8<<3)|5: assert(false);break;
-        case (0xD8<<3)|6: assert(false);break;
-        case (0xD8<<3)|7: assert(false);break;
+        case (0xD8<<3)|0: _M6502_LABEL(0xD8,0) _SA(c->PC);break;
+        case (0xD8<<3)|1: _M6502_LABEL(0xD8,1) c->P&=~0x8;_FETCH();break;
+        case (0xD8<<3)|2: _M6502_LABEL(0xD8,2) assert(false);break;
+        case (0xD8<<3)|3: _M6502_LABEL(0xD8,3) assert(false);break;
+        case (0xD8<<3)|4: _M6502_LABEL(0xD8,4) assert(false);break;
+        case (0xD8<<3)|5: _M6502_LABEL(0xD8,5) assert(false);break;
+        case (0xD8<<3)|6: _M6502_LABEL(0xD8,6) assert(false);break;
+        case (0xD8<<3)|7: _M6502_LABEL(0xD8,7) assert(false);break;
     /* CMP abs,Y */
-        case (0xD9<<3)|0: _SA(c->PC++);break;
-        case (0xD9<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xD9<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0xD9<<3)|3: _SA(c->AD+c->Y);break;
-        case (0xD9<<3)|4: _m6502_cmp(c, c->A, _GD());_FETCH();break;
-        case (0xD9<<3)|5: assert(false);break;
-        case (0xD9<<3)|6: assert(false);break;
-        case (0xD9<<3)|7: assert(false);break;
+        case (0xD9<<3)|0: _M6502_LABEL(0xD9,0) _SA(c->PC++);break;
+        case (0xD9<<3)|1: _M6502_LABEL(0xD9,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xD9<<3)|2: _M6502_LABEL(0xD9,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0xD9<<3)|3: _M6502_LABEL(0xD9,3) _SA(c->AD+c->Y);break;
+        case (0xD9<<3)|4: _M6502_LABEL(0xD9,4) _m6502_cmp(c, c->A, _GD());_FETCH();break;
+        case (0xD9<<3)|5: _M6502_LABEL(0xD9,5) assert(false);break;
+        case (0xD9<<3)|6: _M6502_LABEL(0xD9,6) assert(false);break;
+        case (0xD9<<3)|7: _M6502_LABEL(0xD9,7) assert(false);break;
     /* NOP  (undoc) */
-        case (0xDA<<3)|0: _SA(c->PC);break;
-        case (0xDA<<3)|1: _FETCH();break;
-        case (0xDA<<3)|2: assert(false);break;
-        case (0xDA<<3)|3: assert(false);break;
-        case (0xDA<<3)|4: assert(false);break;
-        case (0xDA<<3)|5: assert(false);break;
-        case (0xDA<<3)|6: assert(false);break;
-        case (0xDA<<3)|7: assert(false);break;
+        case (0xDA<<3)|0: _M6502_LABEL(0xDA,0) _SA(c->PC);break;
+        case (0xDA<<3)|1: _M6502_LABEL(0xDA,1) _FETCH();break;
+        case (0xDA<<3)|2: _M6502_LABEL(0xDA,2) assert(false);break;
+        case (0xDA<<3)|3: _M6502_LABEL(0xDA,3) assert(false);break;
+        case (0xDA<<3)|4: _M6502_LABEL(0xDA,4) assert(false);break;
+        case (0xDA<<3)|5: _M6502_LABEL(0xDA,5) assert(false);break;
+        case (0xDA<<3)|6: _M6502_LABEL(0xDA,6) assert(false);break;
+        case (0xDA<<3)|7: _M6502_LABEL(0xDA,7) assert(false);break;
     /* DCP abs,Y (undoc) */
-        case (0xDB<<3)|0: _SA(c->PC++);break;
-        case (0xDB<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xDB<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0xDB<<3)|3: _SA(c->AD+c->Y);break;
-        case (0xDB<<3)|4: c->AD=_GD();_WR();break;
-        case (0xDB<<3)|5: c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
-        case (0xDB<<3)|6: _FETCH();break;
-        case (0xDB<<3)|7: assert(false);break;
+        case (0xDB<<3)|0: _M6502_LABEL(0xDB,0) _SA(c->PC++);break;
+        case (0xDB<<3)|1: _M6502_LABEL(0xDB,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xDB<<3)|2: _M6502_LABEL(0xDB,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0xDB<<3)|3: _M6502_LABEL(0xDB,3) _SA(c->AD+c->Y);break;
+        case (0xDB<<3)|4: _M6502_LABEL(0xDB,4) c->AD=_GD();_WR();break;
+        case (0xDB<<3)|5: _M6502_LABEL(0xDB,5) c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
+        case (0xDB<<3)|6: _M6502_LABEL(0xDB,6) _FETCH();break;
+        case (0xDB<<3)|7: _M6502_LABEL(0xDB,7) assert(false);break;
     /* NOP abs,X (undoc) */
-        case (0xDC<<3)|0: _SA(c->PC++);break;
-        case (0xDC<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xDC<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0xDC<<3)|3: _SA(c->AD+c->X);break;
-        case (0xDC<<3)|4: _FETCH();break;
-        case (0xDC<<3)|5: assert(false);break;
-        case (0xDC<<3)|6: assert(false);break;
-        case (0xDC<<3)|7: assert(false);break;
+        case (0xDC<<3)|0: _M6502_LABEL(0xDC,0) _SA(c->PC++);break;
+        case (0xDC<<3)|1: _M6502_LABEL(0xDC,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xDC<<3)|2: _M6502_LABEL(0xDC,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0xDC<<3)|3: _M6502_LABEL(0xDC,3) _SA(c->AD+c->X);break;
+        case (0xDC<<3)|4: _M6502_LABEL(0xDC,4) _FETCH();break;
+        case (0xDC<<3)|5: _M6502_LABEL(0xDC,5) assert(false);break;
+        case (0xDC<<3)|6: _M6502_LABEL(0xDC,6) assert(false);break;
+        case (0xDC<<3)|7: _M6502_LABEL(0xDC,7) assert(false);break;
     /* CMP abs,X */
-        case (0xDD<<3)|0: _SA(c->PC++);break;
-        case (0xDD<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xDD<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0xDD<<3)|3: _SA(c->AD+c->X);break;
-        case (0xDD<<3)|4: _m6502_cmp(c, c->A, _GD());_FETCH();break;
-        case (0xDD<<3)|5: assert(false);break;
-        case (0xDD<<3)|6: assert(false);break;
-        case (0xDD<<3)|7: assert(false);break;
+        case (0xDD<<3)|0: _M6502_LABEL(0xDD,0) _SA(c->PC++);break;
+        case (0xDD<<3)|1: _M6502_LABEL(0xDD,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xDD<<3)|2: _M6502_LABEL(0xDD,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0xDD<<3)|3: _M6502_LABEL(0xDD,3) _SA(c->AD+c->X);break;
+        case (0xDD<<3)|4: _M6502_LABEL(0xDD,4) _m6502_cmp(c, c->A, _GD());_FETCH();break;
+        case (0xDD<<3)|5: _M6502_LABEL(0xDD,5) assert(false);break;
+        case (0xDD<<3)|6: _M6502_LABEL(0xDD,6) assert(false);break;
+        case (0xDD<<3)|7: _M6502_LABEL(0xDD,7) assert(false);break;
     /* DEC abs,X */
-        case (0xDE<<3)|0: _SA(c->PC++);break;
-        case (0xDE<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xDE<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0xDE<<3)|3: _SA(c->AD+c->X);break;
-        case (0xDE<<3)|4: c->AD=_GD();_WR();break;
-        case (0xDE<<3)|5: c->AD--;_NZ(c->AD);_SD(c->AD);_WR();break;
-        case (0xDE<<3)|6: _FETCH();break;
-        case (0xDE<<3)|7: assert(false);break;
+        case (0xDE<<3)|0: _M6502_LABEL(0xDE,0) _SA(c->PC++);break;
+        case (0xDE<<3)|1: _M6502_LABEL(0xDE,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xDE<<3)|2: _M6502_LABEL(0xDE,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0xDE<<3)|3: _M6502_LABEL(0xDE,3) _SA(c->AD+c->X);break;
+        case (0xDE<<3)|4: _M6502_LABEL(0xDE,4) c->AD=_GD();_WR();break;
+        case (0xDE<<3)|5: _M6502_LABEL(0xDE,5) c->AD--;_NZ(c->AD);_SD(c->AD);_WR();break;
+        case (0xDE<<3)|6: _M6502_LABEL(0xDE,6) _FETCH();break;
+        case (0xDE<<3)|7: _M6502_LABEL(0xDE,7) assert(false);break;
     /* DCP abs,X (undoc) */
-        case (0xDF<<3)|0: _SA(c->PC++);break;
-        case (0xDF<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xDF<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0xDF<<3)|3: _SA(c->AD+c->X);break;
-        case (0xDF<<3)|4: c->AD=_GD();_WR();break;
-        case (0xDF<<3)|5: c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
-        case (0xDF<<3)|6: _FETCH();break;
-        case (0xDF<<3)|7: assert(false);break;
+        case (0xDF<<3)|0: _M6502_LABEL(0xDF,0) _SA(c->PC++);break;
+        case (0xDF<<3)|1: _M6502_LABEL(0xDF,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xDF<<3)|2: _M6502_LABEL(0xDF,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0xDF<<3)|3: _M6502_LABEL(0xDF,3) _SA(c->AD+c->X);break;
+        case (0xDF<<3)|4: _M6502_LABEL(0xDF,4) c->AD=_GD();_WR();break;
+        case (0xDF<<3)|5: _M6502_LABEL(0xDF,5) c->AD--;_NZ(c->AD);_SD(c->AD);_m6502_cmp(c, c->A, c->AD);_WR();break;
+        case (0xDF<<3)|6: _M6502_LABEL(0xDF,6) _FETCH();break;
+        case (0xDF<<3)|7: _M6502_LABEL(0xDF,7) assert(false);break;
     /* CPX # */
-        case (0xE0<<3)|0: _SA(c->PC++);break;
-        case (0xE0<<3)|1: _m6502_cmp(c, c->X, _GD());_FETCH();break;
-        case (0xE0<<3)|2: assert(false);break;
-        case (0xE0<<3)|3: assert(false);break;
-        case (0xE0<<3)|4: assert(false);break;
-        case (0xE0<<3)|5: assert(false);break;
-        case (0xE0<<3)|6: assert(false);break;
-        case (0xE0<<3)|7: assert(false);break;
+        case (0xE0<<3)|0: _M6502_LABEL(0xE0,0) _SA(c->PC++);break;
+        case (0xE0<<3)|1: _M6502_LABEL(0xE0,1) _m6502_cmp(c, c->X, _GD());_FETCH();break;
+        case (0xE0<<3)|2: _M6502_LABEL(0xE0,2) assert(false);break;
+        case (0xE0<<3)|3: _M6502_LABEL(0xE0,3) assert(false);break;
+        case (0xE0<<3)|4: _M6502_LABEL(0xE0,4) assert(false);break;
+        case (0xE0<<3)|5: _M6502_LABEL(0xE0,5) assert(false);break;
+        case (0xE0<<3)|6: _M6502_LABEL(0xE0,6) assert(false);break;
+        case (0xE0<<3)|7: _M6502_LABEL(0xE0,7) assert(false);break;
     /* SBC (zp,X) */
-        case (0xE1<<3)|0: _SA(c->PC++);break;
-        case (0xE1<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xE1<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0xE1<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xE1<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0xE1<<3)|5: _m6502_sbc(c,_GD());_FETCH();break;
-        case (0xE1<<3)|6: assert(false);break;
-        case (0xE1<<3)|7: assert(false);break;
+        case (0xE1<<3)|0: _M6502_LABEL(0xE1,0) _SA(c->PC++);break;
+        case (0xE1<<3)|1: _M6502_LABEL(0xE1,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xE1<<3)|2: _M6502_LABEL(0xE1,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0xE1<<3)|3: _M6502_LABEL(0xE1,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xE1<<3)|4: _M6502_LABEL(0xE1,4) _SA((_GD()<<8)|c->AD);break;
+        case (0xE1<<3)|5: _M6502_LABEL(0xE1,5) _m6502_sbc(c,_GD());_FETCH();break;
+        case (0xE1<<3)|6: _M6502_LABEL(0xE1,6) assert(false);break;
+        case (0xE1<<3)|7: _M6502_LABEL(0xE1,7) assert(false);break;
     /* NOP # (undoc) */
-        case (0xE2<<3)|0: _SA(c->PC++);break;
-        case (0xE2<<3)|1: _FETCH();break;
-        case (0xE2<<3)|2: assert(false);break;
-        case (0xE2<<3)|3: assert(false);break;
-        case (0xE2<<3)|4: assert(false);break;
-        case (0xE2<<3)|5: assert(false);break;
-        case (0xE2<<3)|6: assert(false);break;
-        case (0xE2<<3)|7: assert(false);break;
+        case (0xE2<<3)|0: _M6502_LABEL(0xE2,0) _SA(c->PC++);break;
+        case (0xE2<<3)|1: _M6502_LABEL(0xE2,1) _FETCH();break;
+        case (0xE2<<3)|2: _M6502_LABEL(0xE2,2) assert(false);break;
+        case (0xE2<<3)|3: _M6502_LABEL(0xE2,3) assert(false);break;
+        case (0xE2<<3)|4: _M6502_LABEL(0xE2,4) assert(false);break;
+        case (0xE2<<3)|5: _M6502_LABEL(0xE2,5) assert(false);break;
+        case (0xE2<<3)|6: _M6502_LABEL(0xE2,6) assert(false);break;
+        case (0xE2<<3)|7: _M6502_LABEL(0xE2,7) assert(false);break;
     /* ISB (zp,X) (undoc) */
-        case (0xE3<<3)|0: _SA(c->PC++);break;
-        case (0xE3<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xE3<<3)|2: c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
-        case (0xE3<<3)|3: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xE3<<3)|4: _SA((_GD()<<8)|c->AD);break;
-        case (0xE3<<3)|5: c->AD=_GD();_WR();break;
-        case (0xE3<<3)|6: c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
-        case (0xE3<<3)|7: _FETCH();break;
+        case (0xE3<<3)|0: _M6502_LABEL(0xE3,0) _SA(c->PC++);break;
+        case (0xE3<<3)|1: _M6502_LABEL(0xE3,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xE3<<3)|2: _M6502_LABEL(0xE3,2) c->AD=(c->AD+c->X)&0xFF;_SA(c->AD);break;
+        case (0xE3<<3)|3: _M6502_LABEL(0xE3,3) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xE3<<3)|4: _M6502_LABEL(0xE3,4) _SA((_GD()<<8)|c->AD);break;
+        case (0xE3<<3)|5: _M6502_LABEL(0xE3,5) c->AD=_GD();_WR();break;
+        case (0xE3<<3)|6: _M6502_LABEL(0xE3,6) c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
+        case (0xE3<<3)|7: _M6502_LABEL(0xE3,7) _FETCH();break;
     /* CPX zp */
-        case (0xE4<<3)|0: _SA(c->PC++);break;
-        case (0xE4<<3)|1: _SA(_GD());break;
-        case (0xE4<<3)|2: _m6502_cmp(c, c->X, _GD());_FETCH();break;
-        case (0xE4<<3)|3: assert(false);break;
-        case (0xE4<<3)|4: assert(false);break;
-        case (0xE4<<3)|5: assert(false);break;
-        case (0xE4<<3)|6: assert(false);break;
-        case (0xE4<<3)|7: assert(false);break;
+        case (0xE4<<3)|0: _M6502_LABEL(0xE4,0) _SA(c->PC++);break;
+        case (0xE4<<3)|1: _M6502_LABEL(0xE4,1) _SA(_GD());break;
+        case (0xE4<<3)|2: _M6502_LABEL(0xE4,2) _m6502_cmp(c, c->X, _GD());_FETCH();break;
+        case (0xE4<<3)|3: _M6502_LABEL(0xE4,3) assert(false);break;
+        case (0xE4<<3)|4: _M6502_LABEL(0xE4,4) assert(false);break;
+        case (0xE4<<3)|5: _M6502_LABEL(0xE4,5) assert(false);break;
+        case (0xE4<<3)|6: _M6502_LABEL(0xE4,6) assert(false);break;
+        case (0xE4<<3)|7: _M6502_LABEL(0xE4,7) assert(false);break;
     /* SBC zp */
-        case (0xE5<<3)|0: _SA(c->PC++);break;
-        case (0xE5<<3)|1: _SA(_GD());break;
-        case (0xE5<<3)|2: _m6502_sbc(c,_GD());_FETCH();break;
-        case (0xE5<<3)|3: assert(false);break;
-        case (0xE5<<3)|4: assert(false);break;
-        case (0xE5<<3)|5: assert(false);break;
-        case (0xE5<<3)|6: assert(false);break;
-        case (0xE5<<3)|7: assert(false);break;
+        case (0xE5<<3)|0: _M6502_LABEL(0xE5,0) _SA(c->PC++);break;
+        case (0xE5<<3)|1: _M6502_LABEL(0xE5,1) _SA(_GD());break;
+        case (0xE5<<3)|2: _M6502_LABEL(0xE5,2) _m6502_sbc(c,_GD());_FETCH();break;
+        case (0xE5<<3)|3: _M6502_LABEL(0xE5,3) assert(false);break;
+        case (0xE5<<3)|4: _M6502_LABEL(0xE5,4) assert(false);break;
+        case (0xE5<<3)|5: _M6502_LABEL(0xE5,5) assert(false);break;
+        case (0xE5<<3)|6: _M6502_LABEL(0xE5,6) assert(false);break;
+        case (0xE5<<3)|7: _M6502_LABEL(0xE5,7) assert(false);break;
     /* INC zp */
-        case (0xE6<<3)|0: _SA(c->PC++);break;
-        case (0xE6<<3)|1: _SA(_GD());break;
-        case (0xE6<<3)|2: c->AD=_GD();_WR();break;
-        case (0xE6<<3)|3: c->AD++;_NZ(c->AD);_SD(c->AD);_WR();break;
-        case (0xE6<<3)|4: _FETCH();break;
-        case (0xE6<<3)|5: assert(false);break;
-        case (0xE6<<3)|6: assert(false);break;
-        case (0xE6<<3)|7: assert(false);break;
+        case (0xE6<<3)|0: _M6502_LABEL(0xE6,0) _SA(c->PC++);break;
+        case (0xE6<<3)|1: _M6502_LABEL(0xE6,1) _SA(_GD());break;
+        case (0xE6<<3)|2: _M6502_LABEL(0xE6,2) c->AD=_GD();_WR();break;
+        case (0xE6<<3)|3: _M6502_LABEL(0xE6,3) c->AD++;_NZ(c->AD);_SD(c->AD);_WR();break;
+        case (0xE6<<3)|4: _M6502_LABEL(0xE6,4) _FETCH();break;
+        case (0xE6<<3)|5: _M6502_LABEL(0xE6,5) assert(false);break;
+        case (0xE6<<3)|6: _M6502_LABEL(0xE6,6) assert(false);break;
+        case (0xE6<<3)|7: _M6502_LABEL(0xE6,7) assert(false);break;
     /* ISB zp (undoc) */
-        case (0xE7<<3)|0: _SA(c->PC++);break;
-        case (0xE7<<3)|1: _SA(_GD());break;
-        case (0xE7<<3)|2: c->AD=_GD();_WR();break;
-        case (0xE7<<3)|3: c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
-        case (0xE7<<3)|4: _FETCH();break;
-        case (0xE7<<3)|5: assert(false);break;
-        case (0xE7<<3)|6: assert(false);break;
-        case (0xE7<<3)|7: assert(false);break;
+        case (0xE7<<3)|0: _M6502_LABEL(0xE7,0) _SA(c->PC++);break;
+        case (0xE7<<3)|1: _M6502_LABEL(0xE7,1) _SA(_GD());break;
+        case (0xE7<<3)|2: _M6502_LABEL(0xE7,2) c->AD=_GD();_WR();break;
+        case (0xE7<<3)|3: _M6502_LABEL(0xE7,3) c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
+        case (0xE7<<3)|4: _M6502_LABEL(0xE7,4) _FETCH();break;
+        case (0xE7<<3)|5: _M6502_LABEL(0xE7,5) assert(false);break;
+        case (0xE7<<3)|6: _M6502_LABEL(0xE7,6) assert(false);break;
+        case (0xE7<<3)|7: _M6502_LABEL(0xE7,7) assert(false);break;
     /* INX  */
-        case (0xE8<<3)|0: _SA(c->PC);break;
-        case (0xE8<<3)|1: c->X++;_NZ(c->X);_FETCH();break;
-        case (0xE8<<3)|2: assert(false);break;
-        case (0xE8<<3)|3: assert(false);break;
-        case (0xE8<<3)|4: assert(false);break;
-        case (0xE8<<3)|5: assert(false);break;
-        case (0xE8<<3)|6: assert(false);break;
-        case (0xE8<<3)|7: assert(false);break;
+        case (0xE8<<3)|0: _M6502_LABEL(0xE8,0) _SA(c->PC);break;
+        case (0xE8<<3)|1: _M6502_LABEL(0xE8,1) c->X++;_NZ(c->X);_FETCH();break;
+        case (0xE8<<3)|2: _M6502_LABEL(0xE8,2) assert(false);break;
+        case (0xE8<<3)|3: _M6502_LABEL(0xE8,3) assert(false);break;
+        case (0xE8<<3)|4: _M6502_LABEL(0xE8,4) assert(false);break;
+        case (0xE8<<3)|5: _M6502_LABEL(0xE8,5) assert(false);break;
+        case (0xE8<<3)|6: _M6502_LABEL(0xE8,6) assert(false);break;
+        case (0xE8<<3)|7: _M6502_LABEL(0xE8,7) assert(false);break;
     /* SBC # */
-        case (0xE9<<3)|0: _SA(c->PC++);break;
-        case (0xE9<<3)|1: _m6502_sbc(c,_GD());_FETCH();break;
-        case (0xE9<<3)|2: assert(false);break;
-        case (0xE9<<3)|3: assert(false);break;
-        case (0xE9<<3)|4: assert(false);break;
-        case (0xE9<<3)|5: assert(false);break;
-        case (0xE9<<3)|6: assert(false);break;
-        case (0xE9<<3)|7: assert(false);break;
+        case (0xE9<<3)|0: _M6502_LABEL(0xE9,0) _SA(c->PC++);break;
+        case (0xE9<<3)|1: _M6502_LABEL(0xE9,1) _m6502_sbc(c,_GD());_FETCH();break;
+        case (0xE9<<3)|2: _M6502_LABEL(0xE9,2) assert(false);break;
+        case (0xE9<<3)|3: _M6502_LABEL(0xE9,3) assert(false);break;
+        case (0xE9<<3)|4: _M6502_LABEL(0xE9,4) assert(false);break;
+        case (0xE9<<3)|5: _M6502_LABEL(0xE9,5) assert(false);break;
+        case (0xE9<<3)|6: _M6502_LABEL(0xE9,6) assert(false);break;
+        case (0xE9<<3)|7: _M6502_LABEL(0xE9,7) assert(false);break;
     /* NOP  */
-        case (0xEA<<3)|0: _SA(c->PC);break;
-        case (0xEA<<3)|1: _FETCH();break;
-        case (0xEA<<3)|2: assert(false);break;
-        case (0xEA<<3)|3: assert(false);break;
-        case (0xEA<<3)|4: assert(false);break;
-        case (0xEA<<3)|5: assert(false);break;
-        case (0xEA<<3)|6: assert(false);break;
-        case (0xEA<<3)|7: assert(false);break;
+        case (0xEA<<3)|0: _M6502_LABEL(0xEA,0) _SA(c->PC);break;
+        case (0xEA<<3)|1: _M6502_LABEL(0xEA,1) _FETCH();break;
+        case (0xEA<<3)|2: _M6502_LABEL(0xEA,2) assert(false);break;
+        case (0xEA<<3)|3: _M6502_LABEL(0xEA,3) assert(false);break;
+        case (0xEA<<3)|4: _M6502_LABEL(0xEA,4) assert(false);break;
+        case (0xEA<<3)|5: _M6502_LABEL(0xEA,5) assert(false);break;
+        case (0xEA<<3)|6: _M6502_LABEL(0xEA,6) assert(false);break;
+        case (0xEA<<3)|7: _M6502_LABEL(0xEA,7) assert(false);break;
     /* SBC # (undoc) */
-        case (0xEB<<3)|0: _SA(c->PC++);break;
-        case (0xEB<<3)|1: _m6502_sbc(c,_GD());_FETCH();break;
-        case (0xEB<<3)|2: assert(false);break;
-        case (0xEB<<3)|3: assert(false);break;
-        case (0xEB<<3)|4: assert(false);break;
-        case (0xEB<<3)|5: assert(false);break;
-        case (0xEB<<3)|6: assert(false);break;
-        case (0xEB<<3)|7: assert(false);break;
+        case (0xEB<<3)|0: _M6502_LABEL(0xEB,0) _SA(c->PC++);break;
+        case (0xEB<<3)|1: _M6502_LABEL(0xEB,1) _m6502_sbc(c,_GD());_FETCH();break;
+        case (0xEB<<3)|2: _M6502_LABEL(0xEB,2) assert(false);break;
+        case (0xEB<<3)|3: _M6502_LABEL(0xEB,3) assert(false);break;
+        case (0xEB<<3)|4: _M6502_LABEL(0xEB,4) assert(false);break;
+        case (0xEB<<3)|5: _M6502_LABEL(0xEB,5) assert(false);break;
+        case (0xEB<<3)|6: _M6502_LABEL(0xEB,6) assert(false);break;
+        case (0xEB<<3)|7: _M6502_LABEL(0xEB,7) assert(false);break;
     /* CPX abs */
-        case (0xEC<<3)|0: _SA(c->PC++);break;
-        case (0xEC<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xEC<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xEC<<3)|3: _m6502_cmp(c, c->X, _GD());_FETCH();break;
-        case (0xEC<<3)|4: assert(false);break;
-        case (0xEC<<3)|5: assert(false);break;
-        case (0xEC<<3)|6: assert(false);break;
-        case (0xEC<<3)|7: assert(false);break;
+        case (0xEC<<3)|0: _M6502_LABEL(0xEC,0) _SA(c->PC++);break;
+        case (0xEC<<3)|1: _M6502_LABEL(0xEC,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xEC<<3)|2: _M6502_LABEL(0xEC,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xEC<<3)|3: _M6502_LABEL(0xEC,3) _m6502_cmp(c, c->X, _GD());_FETCH();break;
+        case (0xEC<<3)|4: _M6502_LABEL(0xEC,4) assert(false);break;
+        case (0xEC<<3)|5: _M6502_LABEL(0xEC,5) assert(false);break;
+        case (0xEC<<3)|6: _M6502_LABEL(0xEC,6) assert(false);break;
+        case (0xEC<<3)|7: _M6502_LABEL(0xEC,7) assert(false);break;
     /* SBC abs */
-        case (0xED<<3)|0: _SA(c->PC++);break;
-        case (0xED<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xED<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xED<<3)|3: _m6502_sbc(c,_GD());_FETCH();break;
-        case (0xED<<3)|4: assert(false);break;
-        case (0xED<<3)|5: assert(false);break;
-        case (0xED<<3)|6: assert(false);break;
-        case (0xED<<3)|7: assert(false);break;
+        case (0xED<<3)|0: _M6502_LABEL(0xED,0) _SA(c->PC++);break;
+        case (0xED<<3)|1: _M6502_LABEL(0xED,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xED<<3)|2: _M6502_LABEL(0xED,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xED<<3)|3: _M6502_LABEL(0xED,3) _m6502_sbc(c,_GD());_FETCH();break;
+        case (0xED<<3)|4: _M6502_LABEL(0xED,4) assert(false);break;
+        case (0xED<<3)|5: _M6502_LABEL(0xED,5) assert(false);break;
+        case (0xED<<3)|6: _M6502_LABEL(0xED,6) assert(false);break;
+        case (0xED<<3)|7: _M6502_LABEL(0xED,7) assert(false);break;
     /* INC abs */
-        case (0xEE<<3)|0: _SA(c->PC++);break;
-        case (0xEE<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xEE<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xEE<<3)|3: c->AD=_GD();_WR();break;
-        case (0xEE<<3)|4: c->AD++;_NZ(c->AD);_SD(c->AD);_WR();break;
-        case (0xEE<<3)|5: _FETCH();break;
-        case (0xEE<<3)|6: assert(false);break;
-        case (0xEE<<3)|7: assert(false);break;
+        case (0xEE<<3)|0: _M6502_LABEL(0xEE,0) _SA(c->PC++);break;
+        case (0xEE<<3)|1: _M6502_LABEL(0xEE,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xEE<<3)|2: _M6502_LABEL(0xEE,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xEE<<3)|3: _M6502_LABEL(0xEE,3) c->AD=_GD();_WR();break;
+        case (0xEE<<3)|4: _M6502_LABEL(0xEE,4) c->AD++;_NZ(c->AD);_SD(c->AD);_WR();break;
+        case (0xEE<<3)|5: _M6502_LABEL(0xEE,5) _FETCH();break;
+        case (0xEE<<3)|6: _M6502_LABEL(0xEE,6) assert(false);break;
+        case (0xEE<<3)|7: _M6502_LABEL(0xEE,7) assert(false);break;
     /* ISB abs (undoc) */
-        case (0xEF<<3)|0: _SA(c->PC++);break;
-        case (0xEF<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xEF<<3)|2: _SA((_GD()<<8)|c->AD);break;
-        case (0xEF<<3)|3: c->AD=_GD();_WR();break;
-        case (0xEF<<3)|4: c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
-        case (0xEF<<3)|5: _FETCH();break;
-        case (0xEF<<3)|6: assert(false);break;
-        case (0xEF<<3)|7: assert(false);break;
+        case (0xEF<<3)|0: _M6502_LABEL(0xEF,0) _SA(c->PC++);break;
+        case (0xEF<<3)|1: _M6502_LABEL(0xEF,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xEF<<3)|2: _M6502_LABEL(0xEF,2) _SA((_GD()<<8)|c->AD);break;
+        case (0xEF<<3)|3: _M6502_LABEL(0xEF,3) c->AD=_GD();_WR();break;
+        case (0xEF<<3)|4: _M6502_LABEL(0xEF,4) c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
+        case (0xEF<<3)|5: _M6502_LABEL(0xEF,5) _FETCH();break;
+        case (0xEF<<3)|6: _M6502_LABEL(0xEF,6) assert(false);break;
+        case (0xEF<<3)|7: _M6502_LABEL(0xEF,7) assert(false);break;
     /* BEQ # */
-        case (0xF0<<3)|0: _SA(c->PC++);break;
-        case (0xF0<<3)|1: _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x2)!=0x2){_FETCH();};break;
-        case (0xF0<<3)|2: _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
-        case (0xF0<<3)|3: c->PC=c->AD;_FETCH();break;
-        case (0xF0<<3)|4: assert(false);break;
-        case (0xF0<<3)|5: assert(false);break;
-        case (0xF0<<3)|6: assert(false);break;
-        case (0xF0<<3)|7: assert(false);break;
+        case (0xF0<<3)|0: _M6502_LABEL(0xF0,0) _SA(c->PC++);break;
+        case (0xF0<<3)|1: _M6502_LABEL(0xF0,1) _SA(c->PC);c->AD=c->PC+(int8_t)_GD();if((c->P&0x2)!=0x2){_FETCH();};break;
+        case (0xF0<<3)|2: _M6502_LABEL(0xF0,2) _SA((c->PC&0xFF00)|(c->AD&0x00FF));if((c->AD&0xFF00)==(c->PC&0xFF00)){c->PC=c->AD;c->irq_pip>>=1;c->nmi_pip>>=1;_FETCH();};break;
+        case (0xF0<<3)|3: _M6502_LABEL(0xF0,3) c->PC=c->AD;_FETCH();break;
+        case (0xF0<<3)|4: _M6502_LABEL(0xF0,4) assert(false);break;
+        case (0xF0<<3)|5: _M6502_LABEL(0xF0,5) assert(false);break;
+        case (0xF0<<3)|6: _M6502_LABEL(0xF0,6) assert(false);break;
+        case (0xF0<<3)|7: _M6502_LABEL(0xF0,7) assert(false);break;
     /* SBC (zp),Y */
-        case (0xF1<<3)|0: _SA(c->PC++);break;
-        case (0xF1<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xF1<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xF1<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0xF1<<3)|4: _SA(c->AD+c->Y);break;
-        case (0xF1<<3)|5: _m6502_sbc(c,_GD());_FETCH();break;
-        case (0xF1<<3)|6: assert(false);break;
-        case (0xF1<<3)|7: assert(false);break;
+        case (0xF1<<3)|0: _M6502_LABEL(0xF1,0) _SA(c->PC++);break;
+        case (0xF1<<3)|1: _M6502_LABEL(0xF1,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xF1<<3)|2: _M6502_LABEL(0xF1,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xF1<<3)|3: _M6502_LABEL(0xF1,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0xF1<<3)|4: _M6502_LABEL(0xF1,4) _SA(c->AD+c->Y);break;
+        case (0xF1<<3)|5: _M6502_LABEL(0xF1,5) _m6502_sbc(c,_GD());_FETCH();break;
+        case (0xF1<<3)|6: _M6502_LABEL(0xF1,6) assert(false);break;
+        case (0xF1<<3)|7: _M6502_LABEL(0xF1,7) assert(false);break;
     /* JAM INVALID (undoc) */
-        case (0xF2<<3)|0: _SA(c->PC);break;
-        case (0xF2<<3)|1: _SAD(0xFFFF,0xFF);c->IR--;break;
-        case (0xF2<<3)|2: assert(false);break;
-        case (0xF2<<3)|3: assert(false);break;
-        case (0xF2<<3)|4: assert(false);break;
-        case (0xF2<<3)|5: assert(false);break;
-        case (0xF2<<3)|6: assert(false);break;
-        case (0xF2<<3)|7: assert(false);break;
+        case (0xF2<<3)|0: _M6502_LABEL(0xF2,0) _SA(c->PC);break;
+        case (0xF2<<3)|1: _M6502_LABEL(0xF2,1) _SAD(0xFFFF,0xFF);c->IR--;break;
+        case (0xF2<<3)|2: _M6502_LABEL(0xF2,2) assert(false);break;
+        case (0xF2<<3)|3: _M6502_LABEL(0xF2,3) assert(false);break;
+        case (0xF2<<3)|4: _M6502_LABEL(0xF2,4) assert(false);break;
+        case (0xF2<<3)|5: _M6502_LABEL(0xF2,5) assert(false);break;
+        case (0xF2<<3)|6: _M6502_LABEL(0xF2,6) assert(false);break;
+        case (0xF2<<3)|7: _M6502_LABEL(0xF2,7) assert(false);break;
     /* ISB (zp),Y (undoc) */
-        case (0xF3<<3)|0: _SA(c->PC++);break;
-        case (0xF3<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xF3<<3)|2: _SA((c->AD+1)&0xFF);c->AD=_GD();break;
-        case (0xF3<<3)|3: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0xF3<<3)|4: _SA(c->AD+c->Y);break;
-        case (0xF3<<3)|5: c->AD=_GD();_WR();break;
-        case (0xF3<<3)|6: c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
-        case (0xF3<<3)|7: _FETCH();break;
+        case (0xF3<<3)|0: _M6502_LABEL(0xF3,0) _SA(c->PC++);break;
+        case (0xF3<<3)|1: _M6502_LABEL(0xF3,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xF3<<3)|2: _M6502_LABEL(0xF3,2) _SA((c->AD+1)&0xFF);c->AD=_GD();break;
+        case (0xF3<<3)|3: _M6502_LABEL(0xF3,3) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0xF3<<3)|4: _M6502_LABEL(0xF3,4) _SA(c->AD+c->Y);break;
+        case (0xF3<<3)|5: _M6502_LABEL(0xF3,5) c->AD=_GD();_WR();break;
+        case (0xF3<<3)|6: _M6502_LABEL(0xF3,6) c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
+        case (0xF3<<3)|7: _M6502_LABEL(0xF3,7) _FETCH();break;
     /* NOP zp,X (undoc) */
-        case (0xF4<<3)|0: _SA(c->PC++);break;
-        case (0xF4<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xF4<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0xF4<<3)|3: _FETCH();break;
-        case (0xF4<<3)|4: assert(false);break;
-        case (0xF4<<3)|5: assert(false);break;
-        case (0xF4<<3)|6: assert(false);break;
-        case (0xF4<<3)|7: assert(false);break;
+        case (0xF4<<3)|0: _M6502_LABEL(0xF4,0) _SA(c->PC++);break;
+        case (0xF4<<3)|1: _M6502_LABEL(0xF4,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xF4<<3)|2: _M6502_LABEL(0xF4,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0xF4<<3)|3: _M6502_LABEL(0xF4,3) _FETCH();break;
+        case (0xF4<<3)|4: _M6502_LABEL(0xF4,4) assert(false);break;
+        case (0xF4<<3)|5: _M6502_LABEL(0xF4,5) assert(false);break;
+        case (0xF4<<3)|6: _M6502_LABEL(0xF4,6) assert(false);break;
+        case (0xF4<<3)|7: _M6502_LABEL(0xF4,7) assert(false);break;
     /* SBC zp,X */
-        case (0xF5<<3)|0: _SA(c->PC++);break;
-        case (0xF5<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xF5<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0xF5<<3)|3: _m6502_sbc(c,_GD());_FETCH();break;
-        case (0xF5<<3)|4: assert(false);break;
-        case (0xF5<<3)|5: assert(false);break;
-        case (0xF5<<3)|6: assert(false);break;
-        case (0xF5<<3)|7: assert(false);break;
+        case (0xF5<<3)|0: _M6502_LABEL(0xF5,0) _SA(c->PC++);break;
+        case (0xF5<<3)|1: _M6502_LABEL(0xF5,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xF5<<3)|2: _M6502_LABEL(0xF5,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0xF5<<3)|3: _M6502_LABEL(0xF5,3) _m6502_sbc(c,_GD());_FETCH();break;
+        case (0xF5<<3)|4: _M6502_LABEL(0xF5,4) assert(false);break;
+        case (0xF5<<3)|5: _M6502_LABEL(0xF5,5) assert(false);break;
+        case (0xF5<<3)|6: _M6502_LABEL(0xF5,6) assert(false);break;
+        case (0xF5<<3)|7: _M6502_LABEL(0xF5,7) assert(false);break;
     /* INC zp,X */
-        case (0xF6<<3)|0: _SA(c->PC++);break;
-        case (0xF6<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xF6<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0xF6<<3)|3: c->AD=_GD();_WR();break;
-        case (0xF6<<3)|4: c->AD++;_NZ(c->AD);_SD(c->AD);_WR();break;
-        case (0xF6<<3)|5: _FETCH();break;
-        case (0xF6<<3)|6: assert(false);break;
-        case (0xF6<<3)|7: assert(false);break;
+        case (0xF6<<3)|0: _M6502_LABEL(0xF6,0) _SA(c->PC++);break;
+        case (0xF6<<3)|1: _M6502_LABEL(0xF6,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xF6<<3)|2: _M6502_LABEL(0xF6,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0xF6<<3)|3: _M6502_LABEL(0xF6,3) c->AD=_GD();_WR();break;
+        case (0xF6<<3)|4: _M6502_LABEL(0xF6,4) c->AD++;_NZ(c->AD);_SD(c->AD);_WR();break;
+        case (0xF6<<3)|5: _M6502_LABEL(0xF6,5) _FETCH();break;
+        case (0xF6<<3)|6: _M6502_LABEL(0xF6,6) assert(false);break;
+        case (0xF6<<3)|7: _M6502_LABEL(0xF6,7) assert(false);break;
     /* ISB zp,X (undoc) */
-        case (0xF7<<3)|0: _SA(c->PC++);break;
-        case (0xF7<<3)|1: c->AD=_GD();_SA(c->AD);break;
-        case (0xF7<<3)|2: _SA((c->AD+c->X)&0x00FF);break;
-        case (0xF7<<3)|3: c->AD=_GD();_WR();break;
-        case (0xF7<<3)|4: c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
-        case (0xF7<<3)|5: _FETCH();break;
-        case (0xF7<<3)|6: assert(false);break;
-        case (0xF7<<3)|7: assert(false);break;
+        case (0xF7<<3)|0: _M6502_LABEL(0xF7,0) _SA(c->PC++);break;
+        case (0xF7<<3)|1: _M6502_LABEL(0xF7,1) c->AD=_GD();_SA(c->AD);break;
+        case (0xF7<<3)|2: _M6502_LABEL(0xF7,2) _SA((c->AD+c->X)&0x00FF);break;
+        case (0xF7<<3)|3: _M6502_LABEL(0xF7,3) c->AD=_GD();_WR();break;
+        case (0xF7<<3)|4: _M6502_LABEL(0xF7,4) c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
+        case (0xF7<<3)|5: _M6502_LABEL(0xF7,5) _FETCH();break;
+        case (0xF7<<3)|6: _M6502_LABEL(0xF7,6) assert(false);break;
+        case (0xF7<<3)|7: _M6502_LABEL(0xF7,7) assert(false);break;
     /* SED  */
-        case (0xF8<<3)|0: _SA(c->PC);break;
-        case (0xF8<<3)|1: c->P|=0x8;_FETCH();break;
-        case (0xF8<<3)|2: assert(false);break;
-        case (0xF8<<3)|3: assert(false);break;
-        case (0xF8<<3)|4: assert(false);break;
-        case (0xF8<<3)|5: assert(false);break;
-        case (0xF8<<3)|6: assert(false);break;
-        case (0xF8<<3)|7: assert(false);break;
+        case (0xF8<<3)|0: _M6502_LABEL(0xF8,0) _SA(c->PC);break;
+        case (0xF8<<3)|1: _M6502_LABEL(0xF8,1) c->P|=0x8;_FETCH();break;
+        case (0xF8<<3)|2: _M6502_LABEL(0xF8,2) assert(false);break;
+        case (0xF8<<3)|3: _M6502_LABEL(0xF8,3) assert(false);break;
+        case (0xF8<<3)|4: _M6502_LABEL(0xF8,4) assert(false);break;
+        case (0xF8<<3)|5: _M6502_LABEL(0xF8,5) assert(false);break;
+        case (0xF8<<3)|6: _M6502_LABEL(0xF8,6) assert(false);break;
+        case (0xF8<<3)|7: _M6502_LABEL(0xF8,7) assert(false);break;
     /* SBC abs,Y */
-        case (0xF9<<3)|0: _SA(c->PC++);break;
-        case (0xF9<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xF9<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
-        case (0xF9<<3)|3: _SA(c->AD+c->Y);break;
-        case (0xF9<<3)|4: _m6502_sbc(c,_GD());_FETCH();break;
-        case (0xF9<<3)|5: assert(false);break;
-        case (0xF9<<3)|6: assert(false);break;
-        case (0xF9<<3)|7: assert(false);break;
+        case (0xF9<<3)|0: _M6502_LABEL(0xF9,0) _SA(c->PC++);break;
+        case (0xF9<<3)|1: _M6502_LABEL(0xF9,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xF9<<3)|2: _M6502_LABEL(0xF9,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->Y)>>8)))&1;break;
+        case (0xF9<<3)|3: _M6502_LABEL(0xF9,3) _SA(c->AD+c->Y);break;
+        case (0xF9<<3)|4: _M6502_LABEL(0xF9,4) _m6502_sbc(c,_GD());_FETCH();break;
+        case (0xF9<<3)|5: _M6502_LABEL(0xF9,5) assert(false);break;
+        case (0xF9<<3)|6: _M6502_LABEL(0xF9,6) assert(false);break;
+        case (0xF9<<3)|7: _M6502_LABEL(0xF9,7) assert(false);break;
     /* NOP  (undoc) */
-        case (0xFA<<3)|0: _SA(c->PC);break;
-        case (0xFA<<3)|1: _FETCH();break;
-        case (0xFA<<3)|2: assert(false);break;
-        case (0xFA<<3)|3: assert(false);break;
-        case (0xFA<<3)|4: assert(false);break;
-        case (0xFA<<3)|5: assert(false);break;
-        case (0xFA<<3)|6: assert(false);break;
-        case (0xFA<<3)|7: assert(false);break;
+        case (0xFA<<3)|0: _M6502_LABEL(0xFA,0) _SA(c->PC);break;
+        case (0xFA<<3)|1: _M6502_LABEL(0xFA,1) _FETCH();break;
+        case (0xFA<<3)|2: _M6502_LABEL(0xFA,2) assert(false);break;
+        case (0xFA<<3)|3: _M6502_LABEL(0xFA,3) assert(false);break;
+        case (0xFA<<3)|4: _M6502_LABEL(0xFA,4) assert(false);break;
+        case (0xFA<<3)|5: _M6502_LABEL(0xFA,5) assert(false);break;
+        case (0xFA<<3)|6: _M6502_LABEL(0xFA,6) assert(false);break;
+        case (0xFA<<3)|7: _M6502_LABEL(0xFA,7) assert(false);break;
     /* ISB abs,Y (undoc) */
-        case (0xFB<<3)|0: _SA(c->PC++);break;
-        case (0xFB<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xFB<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
-        case (0xFB<<3)|3: _SA(c->AD+c->Y);break;
-        case (0xFB<<3)|4: c->AD=_GD();_WR();break;
-        case (0xFB<<3)|5: c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
-        case (0xFB<<3)|6: _FETCH();break;
-        case (0xFB<<3)|7: assert(false);break;
+        case (0xFB<<3)|0: _M6502_LABEL(0xFB,0) _SA(c->PC++);break;
+        case (0xFB<<3)|1: _M6502_LABEL(0xFB,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xFB<<3)|2: _M6502_LABEL(0xFB,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->Y)&0xFF));break;
+        case (0xFB<<3)|3: _M6502_LABEL(0xFB,3) _SA(c->AD+c->Y);break;
+        case (0xFB<<3)|4: _M6502_LABEL(0xFB,4) c->AD=_GD();_WR();break;
+        case (0xFB<<3)|5: _M6502_LABEL(0xFB,5) c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
+        case (0xFB<<3)|6: _M6502_LABEL(0xFB,6) _FETCH();break;
+        case (0xFB<<3)|7: _M6502_LABEL(0xFB,7) assert(false);break;
     /* NOP abs,X (undoc) */
-        case (0xFC<<3)|0: _SA(c->PC++);break;
-        case (0xFC<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xFC<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0xFC<<3)|3: _SA(c->AD+c->X);break;
-        case (0xFC<<3)|4: _FETCH();break;
-        case (0xFC<<3)|5: assert(false);break;
-        case (0xFC<<3)|6: assert(false);break;
-        case (0xFC<<3)|7: assert(false);break;
+        case (0xFC<<3)|0: _M6502_LABEL(0xFC,0) _SA(c->PC++);break;
+        case (0xFC<<3)|1: _M6502_LABEL(0xFC,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xFC<<3)|2: _M6502_LABEL(0xFC,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0xFC<<3)|3: _M6502_LABEL(0xFC,3) _SA(c->AD+c->X);break;
+        case (0xFC<<3)|4: _M6502_LABEL(0xFC,4) _FETCH();break;
+        case (0xFC<<3)|5: _M6502_LABEL(0xFC,5) assert(false);break;
+        case (0xFC<<3)|6: _M6502_LABEL(0xFC,6) assert(false);break;
+        case (0xFC<<3)|7: _M6502_LABEL(0xFC,7) assert(false);break;
     /* SBC abs,X */
-        case (0xFD<<3)|0: _SA(c->PC++);break;
-        case (0xFD<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xFD<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
-        case (0xFD<<3)|3: _SA(c->AD+c->X);break;
-        case (0xFD<<3)|4: _m6502_sbc(c,_GD());_FETCH();break;
-        case (0xFD<<3)|5: assert(false);break;
-        case (0xFD<<3)|6: assert(false);break;
-        case (0xFD<<3)|7: assert(false);break;
+        case (0xFD<<3)|0: _M6502_LABEL(0xFD,0) _SA(c->PC++);break;
+        case (0xFD<<3)|1: _M6502_LABEL(0xFD,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xFD<<3)|2: _M6502_LABEL(0xFD,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));c->IR+=(~((c->AD>>8)-((c->AD+c->X)>>8)))&1;break;
+        case (0xFD<<3)|3: _M6502_LABEL(0xFD,3) _SA(c->AD+c->X);break;
+        case (0xFD<<3)|4: _M6502_LABEL(0xFD,4) _m6502_sbc(c,_GD());_FETCH();break;
+        case (0xFD<<3)|5: _M6502_LABEL(0xFD,5) assert(false);break;
+        case (0xFD<<3)|6: _M6502_LABEL(0xFD,6) assert(false);break;
+        case (0xFD<<3)|7: _M6502_LABEL(0xFD,7) assert(false);break;
     /* INC abs,X */
-        case (0xFE<<3)|0: _SA(c->PC++);break;
-        case (0xFE<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xFE<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0xFE<<3)|3: _SA(c->AD+c->X);break;
-        case (0xFE<<3)|4: c->AD=_GD();_WR();break;
-        case (0xFE<<3)|5: c->AD++;_NZ(c->AD);_SD(c->AD);_WR();break;
-        case (0xFE<<3)|6: _FETCH();break;
-        case (0xFE<<3)|7: assert(false);break;
+        case (0xFE<<3)|0: _M6502_LABEL(0xFE,0) _SA(c->PC++);break;
+        case (0xFE<<3)|1: _M6502_LABEL(0xFE,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xFE<<3)|2: _M6502_LABEL(0xFE,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0xFE<<3)|3: _M6502_LABEL(0xFE,3) _SA(c->AD+c->X);break;
+        case (0xFE<<3)|4: _M6502_LABEL(0xFE,4) c->AD=_GD();_WR();break;
+        case (0xFE<<3)|5: _M6502_LABEL(0xFE,5) c->AD++;_NZ(c->AD);_SD(c->AD);_WR();break;
+        case (0xFE<<3)|6: _M6502_LABEL(0xFE,6) _FETCH();break;
+        case (0xFE<<3)|7: _M6502_LABEL(0xFE,7) assert(false);break;
     /* ISB abs,X (undoc) */
-        case (0xFF<<3)|0: _SA(c->PC++);break;
-        case (0xFF<<3)|1: _SA(c->PC++);c->AD=_GD();break;
-        case (0xFF<<3)|2: c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
-        case (0xFF<<3)|3: _SA(c->AD+c->X);break;
-        case (0xFF<<3)|4: c->AD=_GD();_WR();break;
-        case (0xFF<<3)|5: c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
-        case (0xFF<<3)|6: _FETCH();break;
-        case (0xFF<<3)|7: assert(false);break;
+        case (0xFF<<3)|0: _M6502_LABEL(0xFF,0) _SA(c->PC++);break;
+        case (0xFF<<3)|1: _M6502_LABEL(0xFF,1) _SA(c->PC++);c->AD=_GD();break;
+        case (0xFF<<3)|2: _M6502_LABEL(0xFF,2) c->AD|=_GD()<<8;_SA((c->AD&0xFF00)|((c->AD+c->X)&0xFF));break;
+        case (0xFF<<3)|3: _M6502_LABEL(0xFF,3) _SA(c->AD+c->X);break;
+        case (0xFF<<3)|4: _M6502_LABEL(0xFF,4) c->AD=_GD();_WR();break;
+        case (0xFF<<3)|5: _M6502_LABEL(0xFF,5) c->AD++;_SD(c->AD);_m6502_sbc(c,c->AD);_WR();break;
+        case (0xFF<<3)|6: _M6502_LABEL(0xFF,6) _FETCH();break;
+        case (0xFF<<3)|7: _M6502_LABEL(0xFF,7) assert(false);break;
     // %>
         default: _M6502_UNREACHABLE;
     }
@@ -3094,6 +3410,9 @@ uint64_t m6502_tick(m6502_t* c, uint64_t pins) {
 #pragma warning(pop)
 #endif
 
+#undef _M6502_LABEL
+#undef _M6502_JUMP_TABLE_OP
+#undef _M6502_JUMP_OFS
 #undef _SA
 #undef _SAD
 #undef _FETCH
@@ -3104,4 +3423,6 @@ uint64_t m6502_tick(m6502_t* c, uint64_t pins) {
 #undef _RD
 #undef _WR
 #undef _NZ
+
+#include "_m6502_decoder.h"
 #endif /* CHIPS_IMPL */
@@ -0,0 +1,540 @@
+#pragma once
+/*#
+    # m6502dr.h
+
+    Pre-decoded basic block tier for the m6502.h CPU emulator.
+
+    Do this:
+    ~~~C
+    #define CHIPS_IMPL
+    ~~~
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Optionally provide the following macros with your own implementation
+    ~~~C
+    CHIPS_ASSERT(c)
+    ~~~
+
+    You need to include the following headers before including m6502dr.h:
+
+    - m6502.h
+    - mem.h
+
+    ## Overview
+
+    m6502dr.h trades bus-cycle exactness for speed: straight-line runs of
+    documented 6502 instructions which only touch plain memory are
+    translated once into blocks of pre-decoded operations (opcode, operand
+    and base cycle count) and are then executed directly on host memory
+    without going through the cycle-stepped m6502_tick() state machine.
+
+    m6502_exec_dr() runs blocks until the tick budget is used up or until
+    the next instruction can't be handled by the translated code, and
+    returns the number of clock cycles the executed instructions would have
+    taken. The system emulation is responsible for ticking the rest of
+    the system forward by that many cycles afterwards, and for falling back
+    to m6502_tick() when m6502_exec_dr() returns 0.
+
+    Which memory is 'plain' is decided by the CPU-visible page table of a
+    mem_t instance, call m6502dr_map() after each memory bank switch, and
+    m6502dr_unmap() for address ranges which are decoded as I/O by the
+    system emulation. The 6510 IO port at addresses 0 and 1 is never
+    accessed by translated code.
+
+    Instructions which aren't translated (and end a block):
+
+    - all undocumented opcodes
+    - BRK, RTI and PLP
+    - any instruction which would access I/O (including dummy reads of
+      indexed addressing modes), this is checked before the instruction
+      has any side effects, so execution can continue with m6502_tick()
+      at the same instruction
+
+    CLI ends the current m6502_exec_dr() call so that a pending interrupt
+    can be serviced.
+
+    ## Self-modifying code
+
+    The address space is split into 64-byte lines, each with a write
+    generation counter. Blocks translated from RAM remember the generation
+    of the (at most 2) lines they were decoded from, and are retranslated
+    if the generation has changed. Translated code bumps the generation of
+    lines it writes to and leaves the current block; all other writes to
+    RAM (for instance by the cycle-stepped CPU or by DMA) must be announced
+    with m6502dr_write(), or the whole cache must be dropped with
+    m6502dr_invalidate() after bulk memory updates.
+
+    The write tracking assumes that each RAM byte is only writable through
+    one CPU address (no mirrored RAM), which is true for the C64.
+
+    ## Caveats
+
+    - interrupts are only recognized between m6502_exec_dr() calls, so the
+      caller should keep the tick budget small
+    - RDY (e.g. VIC-II badlines) doesn't stall translated code
+    - peripherals observe RAM writes up to one tick budget early
+
+#*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// number of cached blocks (must be a power of 2)
+#define M6502DR_NUM_BLOCKS (1024)
+// max number of instructions in a block
+#define M6502DR_MAX_OPS (16)
+// write tracking granularity (64 bytes)
+#define M6502DR_LINE_SHIFT (6)
+#define M6502DR_NUM_LINES (1<<(16-M6502DR_LINE_SHIFT))
+
+// a pre-decoded instruction
+typedef struct {
+    uint16_t pc;        // address of the opcode byte
+    uint16_t operand;   // 8- or 16-bit operand
+    uint8_t opcode;
+    uint8_t cycles;     // base cycle count without page-crossing penalties
+} m6502dr_op_t;
+
+// a translated block
+typedef struct {
+    const uint8_t* src; // host address of the first opcode byte, 0 if unused
+    uint32_t gen[2];    // line write generations at translation time
+    uint16_t line[2];   // lines the block was decoded from
+    uint16_t pc;
+    uint8_t ram;        // true if decoded from RAM (needs generation check)
+    uint8_t num_ops;    // 0 if the first instruction can't be translated
+    m6502dr_op_t ops[M6502DR_MAX_OPS];
+} m6502dr_block_t;
+
+// translation cache state
+typedef struct {
+    const uint8_t* rd[256];     // host read pointers per 256-byte page, 0 for I/O
+    uint8_t* wr[256];           // host write pointers per 256-byte page, 0 for I/O
+    uint8_t ram[256];           // true if a page is RAM (rd == wr)
+    uint8_t code[M6502DR_NUM_LINES];    // true if a line contains translated code
+    uint32_t gen[M6502DR_NUM_LINES];    // write generation counters
+    uint64_t num_translations;  // statistics
+    uint64_t num_ticks;
+    m6502dr_block_t blocks[M6502DR_NUM_BLOCKS];
+} m6502dr_t;
+
+// initialize an empty translation cache
+void m6502dr_init(m6502dr_t* dr);
+// update the plain-memory map from the CPU-visible page table of a mem_t
+void m6502dr_map(m6502dr_t* dr, mem_t* mem);
+// exclude an address range (e.g. memory-mapped I/O) from translation
+void m6502dr_unmap(m6502dr_t* dr, uint16_t addr, uint32_t size);
+// drop all translated blocks
+void m6502dr_invalidate(m6502dr_t* dr);
+// run translated code at an instruction boundary, returns executed cycles (0 if nothing was executed)
+uint32_t m6502_exec_dr(m6502dr_t* dr, m6502_t* cpu, uint32_t num_ticks);
+// prepare m6502dr_t snapshot for saving
+void m6502dr_snapshot_onsave(m6502dr_t* snapshot);
+// fixup m6502dr_t snapshot after loading (m6502dr_map() must be called afterwards)
+void m6502dr_snapshot_onload(m6502dr_t* snapshot);
+
+// announce a memory write which didn't go through translated code
+static inline void m6502dr_write(m6502dr_t* dr, uint16_t addr) {
+    const uint16_t line = addr >> M6502DR_LINE_SHIFT;
+    if (dr->code[line]) {
+        dr->code[line] = 0;
+        dr->gen[line]++;
+    }
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#ifdef CHIPS_IMPL
+#include <string.h>
+#ifndef CHIPS_ASSERT
+    #include <assert.h>
+    #define CHIPS_ASSERT(c) assert(c)
+#endif
+
+// base cycle counts of translatable opcodes, 0 if not translated
+static const uint8_t _m6502dr_cycles[256] = {
+    0,6,0,0,0,3,5,0,3,2,2,0,0,4,6,0,
+    2,5,0,0,0,4,6,0,2,4,0,0,0,4,7,0,
+    6,6,0,0,3,3,5,0,0,2,2,0,4,4,6,0,
+    2,5,0,0,0,4,6,0,2,4,0,0,0,4,7,0,
+    0,6,0,0,0,3,5,0,3,2,2,0,3,4,6,0,
+    2,5,0,0,0,4,6,0,2,4,0,0,0,4,7,0,
+    6,6,0,0,0,3,5,0,4,2,2,0,5,4,6,0,
+    2,5,0,0,0,4,6,0,2,4,0,0,0,4,7,0,
+    0,6,0,0,3,3,3,0,2,0,2,0,4,4,4,0,
+    2,6,0,0,4,4,4,0,2,5,2,0,0,5,0,0,
+    2,6,2,0,3,3,3,0,2,2,2,0,4,4,4,0,
+    2,5,0,0,4,4,4,0,2,4,2,0,4,4,4,0,
+    2,6,0,0,3,3,5,0,2,2,2,0,4,4,6,0,
+    2,5,0,0,0,4,6,0,2,4,0,0,0,4,7,0,
+    2,6,0,0,3,3,5,0,2,2,2,0,4,4,6,0,
+    2,5,0,0,0,4,6,0,2,4,0,0,0,4,7,0,
+};
+
+// instruction lengths of translatable opcodes
+static const uint8_t _m6502dr_len[256] = {
+    0,2,0,0,0,2,2,0,1,2,1,0,0,3,3,0,
+    2,2,0,0,0,2,2,0,1,3,0,0,0,3,3,0,
+    3,2,0,0,2,2,2,0,0,2,1,0,3,3,3,0,
+    2,2,0,0,0,2,2,0,1,3,0,0,0,3,3,0,
+    0,2,0,0,0,2,2,0,1,2,1,0,3,3,3,0,
+    2,2,0,0,0,2,2,0,1,3,0,0,0,3,3,0,
+    1,2,0,0,0,2,2,0,1,2,1,0,3,3,3,0,
+    2,2,0,0,0,2,2,0,1,3,0,0,0,3,3,0,
+    0,2,0,0,2,2,2,0,1,0,1,0,3,3,3,0,
+    2,2,0,0,2,2,2,0,1,3,1,0,0,3,0,0,
+    2,2,2,0,2,2,2,0,1,2,1,0,3,3,3,0,
+    2,2,0,0,2,2,2,0,1,3,1,0,3,3,3,0,
+    2,2,0,0,2,2,2,0,1,2,1,0,3,3,3,0,
+    2,2,0,0,0,2,2,0,1,3,0,0,0,3,3,0,
+    2,2,0,0,2,2,2,0,1,2,1,0,3,3,3,0,
+    2,2,0,0,0,2,2,0,1,3,0,0,0,3,3,0,
+};
+
+void m6502dr_init(m6502dr_t* dr) {
+    CHIPS_ASSERT(dr);
+    memset(dr, 0, sizeof(m6502dr_t));
+}
+
+void m6502dr_map(m6502dr_t* dr, mem_t* mem) {
+    CHIPS_ASSERT(dr && mem);
+    for (int page = 0; page < 256; page++) {
+        const mem_page_t* mp = &mem->page_table[page >> (MEM_PAGE_SHIFT - 8)];
+        const uint32_t offset = (page << 8) & MEM_PAGE_MASK;
+        dr->rd[page] = mp->read_ptr + offset;
+        dr->wr[page] = mp->write_ptr + offset;
+        dr->ram[page] = mp->read_ptr == mp->write_ptr;
+    }
+}
+
+void m6502dr_unmap(m6502dr_t* dr, uint16_t addr, uint32_t size) {
+    CHIPS_ASSERT(dr && ((addr & 0xFF) == 0) && ((addr + size) <= 0x10000));
+    for (uint32_t page = addr >> 8; page < ((addr + size) >> 8); page++) {
+        dr->rd[page] = 0;
+        dr->wr[page] = 0;
+        dr->ram[page] = 0;
+    }
+}
+
+void m6502dr_invalidate(m6502dr_t* dr) {
+    CHIPS_ASSERT(dr);
+    memset(dr->code, 0, sizeof(dr->code));
+    memset(dr->blocks, 0, sizeof(dr->blocks));
+}
+
+void m6502dr_snapshot_onsave(m6502dr_t* snapshot) {
+    CHIPS_ASSERT(snapshot);
+    m6502dr_init(snapshot);
+}
+
+void m6502dr_snapshot_onload(m6502dr_t* snapshot) {
+    CHIPS_ASSERT(snapshot);
+    m6502dr_init(snapshot);
+}
+
+static inline uint32_t _m6502dr_hash(uint16_t pc) {
+    return (pc ^ (pc >> 10) ^ (pc >> 13)) & (M6502DR_NUM_BLOCKS - 1);
+}
+
+// decode a new block at pc, this also caches untranslatable entry points as empty blocks
+static const m6502dr_block_t* _m6502dr_translate(m6502dr_t* dr, m6502dr_block_t* blk, uint16_t pc, const uint8_t* src) {
+    const uint8_t* page = src - (pc & 0xFF);
+    blk->src = src;
+    blk->pc = pc;
+    blk->ram = dr->ram[pc >> 8];
+    blk->num_ops = 0;
+    blk->line[0] = blk->line[1] = pc >> M6502DR_LINE_SHIFT;
+    uint16_t addr = pc;
+    // a block never leaves the 256-byte page it starts in
+    while ((blk->num_ops < M6502DR_MAX_OPS) && (addr >= 2) && ((addr >> 8) == (pc >> 8))) {
+        const uint32_t lo = addr & 0xFF;
+        const uint8_t opcode = page[lo];
+        const uint32_t len = _m6502dr_len[opcode];
+        if ((0 == len) || ((lo + len) > 256)) {
+            break;
+        }
+        const uint16_t line = (addr + len - 1) >> M6502DR_LINE_SHIFT;
+        if (line > (blk->line[0] + 1)) {
+            break;
+        }
+        blk->line[1] = line;
+        m6502dr_op_t* op = &blk->ops[blk->num_ops++];
+        op->pc = addr;
+        op->opcode = opcode;
+        op->cycles = _m6502dr_cycles[opcode];
+        op->operand = (len > 1) ? page[lo + 1] : 0;
+        if (len > 2) {
+            op->operand |= page[lo + 2] << 8;
+        }
+        addr += len;
+        // control flow instructions and CLI end a block
+        if (((opcode & 0x1F) == 0x10) || (opcode == 0x4C) || (opcode == 0x6C) ||
+            (opcode == 0x20) || (opcode == 0x60) || (opcode == 0x58))
+        {
+            break;
+        }
+    }
+    if (blk->ram) {
+        for (int i = 0; i < 2; i++) {
+            blk->gen[i] = dr->gen[blk->line[i]];
+            dr->code[blk->line[i]] = 1;
+        }
+    }
+    dr->num_translations++;
+    return blk;
+}
+
+static inline const m6502dr_block_t* _m6502dr_lookup(m6502dr_t* dr, uint16_t pc) {
+    const uint8_t* page = dr->rd[pc >> 8];
+    if (0 == page) {
+        return 0;
+    }
+    const uint8_t* src = page + (pc & 0xFF);
+    m6502dr_block_t* blk = &dr->blocks[_m6502dr_hash(pc)];
+    if ((blk->src == src) && (blk->pc == pc)) {
+        if (!blk->ram || ((blk->gen[0] == dr->gen[blk->line[0]]) && (blk->gen[1] == dr->gen[blk->line[1]]))) {
+            return blk;
+        }
+    }
+    return _m6502dr_translate(dr, blk, pc, src);
+}
+
+/* helper macros for m6502_exec_dr(), instructions leave through _done
+   without side effects if any access (including dummy reads) would
+   touch I/O or the 6510 port
+*/
+#define _NZ(v) c.P=((c.P&~(M6502_NF|M6502_ZF))|(((v)&0xFF)?((v)&M6502_NF):M6502_ZF))
+#define _CHK(a) if ((0 == dr->rd[(uint16_t)(a)>>8]) || ((uint16_t)(a) < 2)) { goto _done; }
+#define _RD(v,a) { const uint16_t _a=(a); _CHK(_a); v=dr->rd[_a>>8][_a&0xFF]; }
+#define _WR(a,v) { const uint16_t _a=(a); dr->wr[_a>>8][_a&0xFF]=(v); if (dr->code[_a>>M6502DR_LINE_SHIFT]) { m6502dr_write(dr,_a); smc=true; } }
+#define _PUSH(v) _WR(0x0100|c.S--,v)
+#define _PULL(v) v=dr->rd[1][++c.S]
+#define _STACK() _CHK(0x0100)
+#define _ZP() ea=op->operand
+#define _ZPX() ea=(op->operand+c.X)&0xFF
+#define _ZPY() ea=(op->operand+c.Y)&0xFF
+#define _ABS() ea=op->operand
+#define _IDX_R(base,i) ea=(base)+(i); if ((ea^(base))&0xFF00) { _CHK(((base)&0xFF00)|(ea&0xFF)); cycles++; }
+#define _IDX_W(base,i) ea=(base)+(i); _CHK(((base)&0xFF00)|(ea&0xFF))
+#define _IZ(base,z) { uint8_t _l,_h; _RD(_l,(z)&0xFF); _RD(_h,((z)+1)&0xFF); base=(_h<<8)|_l; }
+#define _BR(cond) if (cond) { const uint16_t _t=next+(int8_t)op->operand; cycles+=((_t^next)&0xFF00)?2:1; next=_t; }
+
+// addressing mode groups of the ALU instructions (the low 5 opcode bits)
+#define _ALU_EA_R() \
+    switch (op->opcode & 0x1F) { \
+        case 0x01: _IZ(base,op->operand+c.X); ea=base; break; \
+        case 0x05: _ZP(); break; \
+        case 0x0D: _ABS(); break; \
+        case 0x11: _IZ(base,op->operand); _IDX_R(base,c.Y); break; \
+        case 0x15: _ZPX(); break; \
+        case 0x19: _IDX_R(op->operand,c.Y); break; \
+        case 0x1D: _IDX_R(op->operand,c.X); break; \
+        default: _M6502_UNREACHABLE; \
+    }
+#define _ALU_RD(v) if ((op->opcode & 0x1F) == 0x09) { v=(uint8_t)op->operand; } else { _ALU_EA_R(); _RD(v,ea); }
+#define _ALU_EA_W() \
+    switch (op->opcode & 0x1F) { \
+        case 0x01: _IZ(base,op->operand+c.X); ea=base; break; \
+        case 0x05: _ZP(); break; \
+        case 0x0D: _ABS(); break; \
+        case 0x11: _IZ(base,op->operand); _IDX_W(base,c.Y); break; \
+        case 0x15: _ZPX(); break; \
+        case 0x19: _IDX_W(op->operand,c.Y); break; \
+        case 0x1D: _IDX_W(op->operand,c.X); break; \
+        default: _M6502_UNREACHABLE; \
+    }
+// read-modify-write addressing modes (zp, zp,X, abs, abs,X)
+#define _RMW_EA() \
+    switch (op->opcode & 0x1F) { \
+        case 0x06: _ZP(); break; \
+        case 0x0E: _ABS(); break; \
+        case 0x16: _ZPX(); break; \
+        case 0x1E: _IDX_W(op->operand,c.X); break; \
+        default: _M6502_UNREACHABLE; \
+    }
+#define _RMW(expr) { _RMW_EA(); _RD(v,ea); v=expr; _WR(ea,v); }
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4244)   /* conversion from 'uint16_t' to 'uint8_t', possible loss of data */
+#endif
+
+uint32_t m6502_exec_dr(m6502dr_t* dr, m6502_t* cpu, uint32_t num_ticks) {
+    CHIPS_ASSERT(dr && cpu);
+    // only the registers are used, so that the ALU helpers from m6502.h can be reused
+    m6502_t c;
+    c.A = cpu->A; c.X = cpu->X; c.Y = cpu->Y; c.S = cpu->S; c.P = cpu->P;
+    c.bcd_enabled = cpu->bcd_enabled;
+    uint16_t pc = cpu->PC;
+    uint32_t ticks = 0;
+    while (ticks < num_ticks) {
+        const m6502dr_block_t* blk = _m6502dr_lookup(dr, pc);
+        if ((0 == blk) || (0 == blk->num_ops)) {
+            break;
+        }
+        bool smc = false;
+        for (const m6502dr_op_t* op = blk->ops; op < &blk->ops[blk->num_ops]; op++) {
+            uint16_t ea, base;
+            uint8_t v;
+            uint32_t cycles = op->cycles;
+            uint16_t next = op->pc + _m6502dr_len[op->opcode];
+            switch (op->opcode) {
+                // ORA, AND, EOR, ADC, LDA, CMP, SBC
+                case 0x01: case 0x05: case 0x09: case 0x0D: case 0x11: case 0x15: case 0x19: case 0x1D:
+                    _ALU_RD(v); c.A|=v; _NZ(c.A); break;
+                case 0x21: case 0x25: case 0x29: case 0x2D: case 0x31: case 0x35: case 0x39: case 0x3D:
+                    _ALU_RD(v); c.A&=v; _NZ(c.A); break;
+                case 0x41: case 0x45: case 0x49: case 0x4D: case 0x51: case 0x55: case 0x59: case 0x5D:
+                    _ALU_RD(v); c.A^=v; _NZ(c.A); break;
+                case 0x61: case 0x65: case 0x69: case 0x6D: case 0x71: case 0x75: case 0x79: case 0x7D:
+                    _ALU_RD(v); _m6502_adc(&c,v); break;
+                case 0xA1: case 0xA5: case 0xA9: case 0xAD: case 0xB1: case 0xB5: case 0xB9: case 0xBD:
+                    _ALU_RD(v); c.A=v; _NZ(c.A); break;
+                case 0xC1: case 0xC5: case 0xC9: case 0xCD: case 0xD1: case 0xD5: case 0xD9: case 0xDD:
+                    _ALU_RD(v); _m6502_cmp(&c,c.A,v); break;
+                case 0xE1: case 0xE5: case 0xE9: case 0xED: case 0xF1: case 0xF5: case 0xF9: case 0xFD:
+                    _ALU_RD(v); _m6502_sbc(&c,v); break;
+                // STA
+                case 0x81: case 0x85: case 0x8D: case 0x91: case 0x95: case 0x99: case 0x9D:
+                    _ALU_EA_W(); _CHK(ea); _WR(ea,c.A); break;
+                // LDX, LDY
+                case 0xA2: c.X=op->operand; _NZ(c.X); break;
+                case 0xA6: _ZP(); _RD(c.X,ea); _NZ(c.X); break;
+                case 0xB6: _ZPY(); _RD(c.X,ea); _NZ(c.X); break;
+                case 0xAE: _ABS(); _RD(c.X,ea); _NZ(c.X); break;
+                case 0xBE: _IDX_R(op->operand,c.Y); _RD(c.X,ea); _NZ(c.X); break;
+                case 0xA0: c.Y=op->operand; _NZ(c.Y); break;
+                case 0xA4: _ZP(); _RD(c.Y,ea); _NZ(c.Y); break;
+                case 0xB4: _ZPX(); _RD(c.Y,ea); _NZ(c.Y); break;
+                case 0xAC: _ABS(); _RD(c.Y,ea); _NZ(c.Y); break;
+                case 0xBC: _IDX_R(op->operand,c.X); _RD(c.Y,ea); _NZ(c.Y); break;
+                // STX, STY
+                case 0x86: _ZP(); _CHK(ea); _WR(ea,c.X); break;
+                case 0x96: _ZPY(); _CHK(ea); _WR(ea,c.X); break;
+                case 0x8E: _ABS(); _CHK(ea); _WR(ea,c.X); break;
+                case 0x84: _ZP(); _CHK(ea); _WR(ea,c.Y); break;
+                case 0x94: _ZPX(); _CHK(ea); _WR(ea,c.Y); break;
+                case 0x8C: _ABS(); _CHK(ea); _WR(ea,c.Y); break;
+                // CPX, CPY, BIT
+                case 0xE0: _m6502_cmp(&c,c.X,op->operand); break;
+                case 0xE4: _ZP(); _RD(v,ea); _m6502_cmp(&c,c.X,v); break;
+                case 0xEC: _ABS(); _RD(v,ea); _m6502_cmp(&c,c.X,v); break;
+                case 0xC0: _m6502_cmp(&c,c.Y,op->operand); break;
+                case 0xC4: _ZP(); _RD(v,ea); _m6502_cmp(&c,c.Y,v); break;
+                case 0xCC: _ABS(); _RD(v,ea); _m6502_cmp(&c,c.Y,v); break;
+                case 0x24: _ZP(); _RD(v,ea); _m6502_bit(&c,v); break;
+                case 0x2C: _ABS(); _RD(v,ea); _m6502_bit(&c,v); break;
+                // shifts and rotates
+                case 0x0A: c.A=_m6502_asl(&c,c.A); break;
+                case 0x4A: c.A=_m6502_lsr(&c,c.A); break;
+                case 0x2A: c.A=_m6502_rol(&c,c.A); break;
+                case 0x6A: c.A=_m6502_ror(&c,c.A); break;
+                case 0x06: case 0x0E: case 0x16: case 0x1E: _RMW(_m6502_asl(&c,v)); break;
+                case 0x46: case 0x4E: case 0x56: case 0x5E: _RMW(_m6502_lsr(&c,v)); break;
+                case 0x26: case 0x2E: case 0x36: case 0x3E: _RMW(_m6502_rol(&c,v)); break;
+                case 0x66: case 0x6E: case 0x76: case 0x7E: _RMW(_m6502_ror(&c,v)); break;
+                // INC, DEC
+                case 0xE6: case 0xEE: case 0xF6: case 0xFE: _RMW(v+1); _NZ(v); break;
+                case 0xC6: case 0xCE: case 0xD6: case 0xDE: _RMW(v-1); _NZ(v); break;
+                case 0xE8: c.X++; _NZ(c.X); break;
+                case 0xC8: c.Y++; _NZ(c.Y); break;
+                case 0xCA: c.X--; _NZ(c.X); break;
+                case 0x88: c.Y--; _NZ(c.Y); break;
+                // transfers
+                case 0xAA: c.X=c.A; _NZ(c.X); break;
+                case 0x8A: c.A=c.X; _NZ(c.A); break;
+                case 0xA8: c.Y=c.A; _NZ(c.Y); break;
+                case 0x98: c.A=c.Y; _NZ(c.A); break;
+                case 0xBA: c.X=c.S; _NZ(c.X); break;
+                case 0x9A: c.S=c.X; break;
+                // flags
+                case 0x18: c.P&=~M6502_CF; break;
+                case 0x38: c.P|=M6502_CF; break;
+                case 0x58: c.P&=~M6502_IF; break;
+                case 0x78: c.P|=M6502_IF; break;
+                case 0xB8: c.P&=~M6502_VF; break;
+                case 0xD8: c.P&=~M6502_DF; break;
+                case 0xF8: c.P|=M6502_DF; break;
+                case 0xEA: break;
+                // stack
+                case 0x48: _STACK(); _PUSH(c.A); break;
+                case 0x08: _STACK(); _PUSH(c.P|M6502_XF); break;
+                case 0x68: _STACK(); _PULL(c.A); _NZ(c.A); break;
+                // branches
+                case 0x10: _BR(!(c.P&M6502_NF)); break;
+                case 0x30: _BR(c.P&M6502_NF); break;
+                case 0x50: _BR(!(c.P&M6502_VF)); break;
+                case 0x70: _BR(c.P&M6502_VF); break;
+                case 0x90: _BR(!(c.P&M6502_CF)); break;
+                case 0xB0: _BR(c.P&M6502_CF); break;
+                case 0xD0: _BR(!(c.P&M6502_ZF)); break;
+                case 0xF0: _BR(c.P&M6502_ZF); break;
+                // jumps
+                case 0x4C: next=op->operand; break;
+                case 0x6C: {
+                    // the indirect jump vector doesn't cross a page boundary
+                    uint8_t l, h;
+                    _RD(l,op->operand);
+                    _RD(h,(op->operand&0xFF00)|((op->operand+1)&0xFF));
+                    next=(h<<8)|l;
+                } break;
+                case 0x20: _STACK(); _PUSH((op->pc+2)>>8); _PUSH(op->pc+2); next=op->operand; break;
+                case 0x60: {
+                    uint8_t l, h;
+                    _STACK(); _PULL(l); _PULL(h);
+                    next=((h<<8)|l)+1;
+                } break;
+                default: _M6502_UNREACHABLE;
+            }
+            pc = next;
+            ticks += cycles;
+            if ((op->opcode == 0x58) || (ticks >= num_ticks)) {
+                // CLI: return so that a pending interrupt can be detected
+                num_ticks = ticks;
+                break;
+            }
+            if (smc) {
+                // the write may have invalidated this block
+                break;
+            }
+        }
+    }
+_done:
+    cpu->A = c.A; cpu->X = c.X; cpu->Y = c.Y; cpu->S = c.S; cpu->P = c.P;
+    cpu->PC = pc;
+    dr->num_ticks += ticks;
+    return ticks;
+}
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#undef _NZ
+#undef _CHK
+#undef _RD
+#undef _WR
+#undef _PUSH
+#undef _PULL
+#undef _STACK
+#undef _ZP
+#undef _ZPX
+#undef _ZPY
+#undef _ABS
+#undef _IDX_R
+#undef _IDX_W
+#undef _IZ
+#undef _BR
+#undef _ALU_EA_R
+#undef _ALU_RD
+#undef _ALU_EA_W
+#undef _RMW_EA
+#undef _RMW
+#endif /* CHIPS_IMPL */
@@ -272,6 +272,10 @@ void m6526_init(m6526_t* c);
 void m6526_reset(m6526_t* c);
 // tick the m6526_t instance
 uint64_t m6526_tick(m6526_t* c, uint64_t pins);
+// number of upcoming ticks which only count down the timers (0 if anything else would happen)
+uint32_t m6526_idle_ticks(const m6526_t* c);
+// fast-forward an idle m6526_t instance by num_ticks (at most m6526_idle_ticks())
+void m6526_skip(m6526_t* c, uint32_t num_ticks);
 
 #ifdef __cplusplus
 } // extern "C"
@@ -346,7 +350,7 @@ static inline void _m6526_read_port_pins(m6526_t* c, uint64_t pins) {
     c->pb.inp = M6526_GET_PB(pins);
 }
 
-static inline uint8_t _m6526_merge_pb67(m6526_t* c, uint8_t data) {
+static inline uint8_t _m6526_merge_pb67(const m6526_t* c, uint8_t data) {
     /* merge timer state bits into data byte */
     if (M6526_PBON(c->ta.cr)) {
         data &= ~(1<<6);
@@ -683,4 +687,61 @@ uint64_t m6526_tick(m6526_t* c, uint64_t pins) {
     return pins;
 }
 
+/*  A timer is idle when the delay-pipelines are in the state which the
+    next _m6526_tick_pipeline() reproduces, and the counter doesn't reach
+    zero. The counter is then the only thing that changes per tick.
+*/
+static uint32_t _m6526_timer_idle_ticks(const m6526_timer_t* t, bool active) {
+    uint32_t pip = active ? ((1<<(M6526_PIP_TIMER_COUNT+0))|(1<<(M6526_PIP_TIMER_COUNT+1))) : 0;
+    if (M6526_RUNMODE_ONESHOT(t->cr)) {
+        pip |= (1<<M6526_PIP_TIMER_ONESHOT);
+    }
+    if (t->t_out || M6526_FORCE_LOAD(t->cr) || (t->pip != pip)) {
+        return 0;
+    }
+    if (!active) {
+        return UINT32_MAX;
+    }
+    return (t->counter > 0) ? (t->counter - 1) : 0;
+}
+
+/*  The caller must keep the port and FLAG inputs unchanged and must not
+    access registers while skipping, the output pins (including IRQ)
+    remain those of the last m6526_tick().
+*/
+uint32_t m6526_idle_ticks(const m6526_t* c) {
+    CHIPS_ASSERT(c);
+    /* port output must be up to date with the port registers */
+    if (c->pa.pins != (c->pa.reg | (c->pa.inp & ~c->pa.ddr))) {
+        return 0;
+    }
+    if (c->pb.pins != _m6526_merge_pb67(c, c->pb.reg | (c->pb.inp & ~c->pb.ddr))) {
+        return 0;
+    }
+    /* interrupt state must be settled */
+    const uint32_t irq_pip = (c->intr.icr & c->intr.imr) ? (1<<M6526_PIP_IRQ) : 0;
+    if ((c->intr.imr != c->intr.imr1) || (c->intr.pip != irq_pip)) {
+        return 0;
+    }
+    if (irq_pip && (0 == (c->intr.icr & (1<<7)))) {
+        return 0;
+    }
+    /* timer B counting timer A underflows is idle as long as timer A doesn't underflow */
+    const bool ta_active = M6526_TIMER_STARTED(c->ta.cr) && M6526_TA_INMODE_PHI2(c->ta.cr);
+    const bool tb_active = M6526_TIMER_STARTED(c->tb.cr) && M6526_TB_INMODE_PHI2(c->tb.cr);
+    const uint32_t ta_ticks = _m6526_timer_idle_ticks(&c->ta, ta_active);
+    const uint32_t tb_ticks = _m6526_timer_idle_ticks(&c->tb, tb_active);
+    return (ta_ticks < tb_ticks) ? ta_ticks : tb_ticks;
+}
+
+void m6526_skip(m6526_t* c, uint32_t num_ticks) {
+    CHIPS_ASSERT(c);
+    if (_M6526_PIP_TEST(c->ta.pip, M6526_PIP_TIMER_COUNT, 0)) {
+        c->ta.counter -= (uint16_t) num_ticks;
+    }
+    if (_M6526_PIP_TEST(c->tb.pip, M6526_PIP_TIMER_COUNT, 0)) {
+        c->tb.counter -= (uint16_t) num_ticks;
+    }
+}
+
 #endif /* CHIPS_IMPL */
@@ -235,8 +235,12 @@ typedef struct {
     uint16_t g_addr_or;     // OR-mask for g-accesses, computed from ECM bit
     uint16_t i_addr;        // address for i-accesses, 0x3FFF or 0x39FF (if ECM bit set)
     uint16_t p_addr_or;     // OR-mask for p-accesses
+    uint64_t ba_ticks;      // bit per tick (h_count) with BA set, from badline and sprite DMA state
+    uint64_t aec_ticks;     // bit per tick (h_count) with AEC set
     m6569_fetch_t fetch_cb; // memory-fetch callback
     void* user_data;        // optional user-data for fetch callback
+    const uint8_t* bank[4]; // optional host pointers to the 4 KByte pages of the 16 KByte bank, see m6569_set_bank()
+    const uint8_t* color_ram;   // 1 KByte color RAM (bits 0..3) for c-accesses through the bank pointers
 } m6569_memory_unit_t;
 
 // video matrix state
@@ -293,11 +297,22 @@ typedef struct {
     uint32_t outp[8];           // current shifter output (bit 31)
     uint32_t outp2[8];          // current shifter output at half frequency (bits 31 and 30)
     uint8_t colors[8][4];       // 0: unused, 1: multicolor0, 2: main color, 3: multicolor
+    uint64_t span;              // bit per tick (h_count) covered by a displayed sprite
+    uint8_t mcd_frames;         // frames left with exact sprite-data collisions after reading $D01F
 } m6569_sprite_unit_t;
 
+// line renderer state, the graphics sequencer input of each tick in the current raster line
+typedef struct {
+    uint8_t g_data[64];         // g-, i- or s-access data by tick (h_count)
+    uint16_t c_data[64];        // video matrix data by tick, 0 in idle state
+} m6569_line_unit_t;
+
 // the m6569 state structure
 typedef struct {
     bool debug_vis;             // toggle this to switch debug visualization on/off
+    bool timing_only;           // toggle this to stop decoding pixels into the framebuffer
+    bool lazy_collisions;       // toggle this to skip unobserved sprite-data collisions in timing-only mode
+    bool line_renderer;         // toggle this to render whole raster lines instead of 8 pixels per tick
     m6569_registers_t reg;
     m6569_crt_t crt;
     m6569_border_unit_t brd;
@@ -306,6 +321,7 @@ typedef struct {
     m6569_graphics_unit_t gunit;
     m6569_sprite_unit_t sunit;
     m6569_video_matrix_t vm;
+    m6569_line_unit_t lunit;
     uint64_t pins;
 } m6569_t;
 
@@ -315,6 +331,12 @@ void m6569_init(m6569_t* vic, const m6569_desc_t* desc);
 void m6569_reset(m6569_t* vic);
 // tick the m6569 instance
 uint64_t m6569_tick(m6569_t* vic, uint64_t pins);
+// number of upcoming ticks m6569_skip() can fast-forward (0 unless in timing-only mode without sprites)
+uint32_t m6569_idle_ticks(const m6569_t* vic);
+// fast-forward the m6569 instance by num_ticks without CPU accesses (at most m6569_idle_ticks())
+void m6569_skip(m6569_t* vic, uint32_t num_ticks);
+// fetch directly from host memory instead of fetch_cb (4x 4 KByte pages of the bank, 1 KByte color RAM), NULL pages to go back to fetch_cb
+void m6569_set_bank(m6569_t* vic, const uint8_t* const pages[4], const uint8_t* color_ram);
 // get the visible screen rect in pixels
 chips_rect_t m6569_screen(m6569_t* vic);
 // get the color palette
@@ -346,6 +368,75 @@ void m6569_snapshot_onload(m6569_t* snapshot, m6569_t* sys);
 #define _M6569_UNREACHABLE
 #endif
 
+/* bit expansion table for the no-sprite pixel fast path, each bit of the
+   index (MSB first) becomes one 0xFF or 0x00 byte in memory order
+*/
+static uint64_t _m6569_expand[256];
+
+static void _m6569_init_expand_table(void) {
+    for (int i = 0; i < 256; i++) {
+        uint8_t bytes[8];
+        for (int b = 0; b < 8; b++) {
+            bytes[b] = (i & (0x80 >> b)) ? 0xFF : 0x00;
+        }
+        memcpy(&_m6569_expand[i], bytes, sizeof(bytes));
+    }
+}
+
+/*--- bus tick masks ---------------------------------------------------------*/
+
+/* The BA and AEC pins only depend on the tick in the raster line, the
+   badline state and which sprites have DMA enabled. Instead of testing
+   this in every tick, the ticks are collected into two 64-bit masks
+   (bit n = h_count n) which are rebuilt when the badline state or the
+   sprite DMA state changes.
+*/
+#define _M6569_TICKS(first,last) (((2ULL<<(last))-1) & ~((1ULL<<(first))-1))
+// c-accesses in a badline
+#define _M6569_BADLINE_BA_TICKS (_M6569_TICKS(12,54))
+// AEC in the c/g-access range
+#define _M6569_CG_AEC_TICKS     (_M6569_TICKS(15,54))
+
+// BA is set 3 ticks before and during the p- and s-accesses of a sprite
+static const uint64_t _m6569_sprite_ba_ticks[8] = {
+    _M6569_TICKS(55,59),
+    _M6569_TICKS(57,61),
+    _M6569_TICKS(59,63),
+    _M6569_TICKS(61,63) | _M6569_TICKS(1,2),
+    _M6569_TICKS(63,63) | _M6569_TICKS(1,4),
+    _M6569_TICKS(2,6),
+    _M6569_TICKS(4,8),
+    _M6569_TICKS(6,10),
+};
+
+// AEC is set during the s-accesses of a sprite
+static const uint64_t _m6569_sprite_aec_ticks[8] = {
+    _M6569_TICKS(58,59),
+    _M6569_TICKS(60,61),
+    _M6569_TICKS(62,63),
+    _M6569_TICKS(1,2),
+    _M6569_TICKS(3,4),
+    _M6569_TICKS(5,6),
+    _M6569_TICKS(7,8),
+    _M6569_TICKS(9,10),
+};
+
+static void _m6569_update_bus_ticks(m6569_t* vic) {
+    uint64_t ba = vic->rs.badline ? _M6569_BADLINE_BA_TICKS : 0;
+    uint64_t aec = _M6569_CG_AEC_TICKS;
+    const uint8_t dma = vic->sunit.dma_enabled;
+    if (dma != 0) {
+        for (size_t i = 0; i < 8; i++) {
+            if (dma & (1<<i)) {
+                ba |= _m6569_sprite_ba_ticks[i];
+                aec |= _m6569_sprite_aec_ticks[i];
+            }
+        }
+    }
+    vic->mem.ba_ticks = ba;
+    vic->mem.aec_ticks = aec;
+}
+
 // valid register bits
 static const uint8_t _m6569_reg_mask[M6569_NUM_REGS] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,     // mob 0..3 xy
@@ -398,9 +489,11 @@ void m6569_init(m6569_t* vic, const m6569_desc_t* desc) {
     CHIPS_ASSERT(vic && desc);
     CHIPS_ASSERT(desc->framebuffer.ptr && (desc->framebuffer.size >= M6569_FRAMEBUFFER_SIZE_BYTES));
     memset(vic, 0, sizeof(*vic));
+    _m6569_init_expand_table();
     _m6569_init_crt(&vic->crt, desc);
     vic->mem.fetch_cb = desc->fetch_cb;
     vic->mem.user_data = desc->user_data;
+    _m6569_update_bus_ticks(vic);
 }
 
 /*--- reset ------------------------------------------------------------------*/
@@ -457,6 +550,7 @@ void m6569_reset(m6569_t* vic) {
     _m6569_reset_video_matrix_unit(&vic->vm);
     _m6569_reset_graphics_unit(&vic->gunit);
     _m6569_reset_sprite_unit(&vic->sunit);
+    _m6569_update_bus_ticks(vic);
 }
 
 /*--- register read/writes ---------------------------------------------------*/
@@ -518,6 +612,24 @@ static inline void _m6569_io_update_gunit_mode(m6569_graphics_unit_t* gu, uint8_
     gu->mode = ((ctrl_1&(M6569_CTRL1_ECM|M6569_CTRL1_BMM))|(ctrl_2&M6569_CTRL2_MCM))>>4;
 }
 
+/* recompute the ticks of the current line covered by displayed sprites,
+   needs to be called when disp_enabled or a sprite position changes,
+   outside of these ticks the sprite unit has no state to update
+*/
+static void _m6569_sunit_update_span(m6569_sprite_unit_t* su) {
+    uint64_t span = 0;
+    if (su->disp_enabled != 0) {
+        for (size_t i = 0; i < 8; i++) {
+            if ((su->disp_enabled & (1<<i)) && (su->h_first[i] < 64)) {
+                const uint64_t first = ~0ULL << su->h_first[i];
+                const uint64_t last = (su->h_last[i] >= 63) ? ~0ULL : ((2ULL << su->h_last[i]) - 1);
+                span |= first & last;
+            }
+        }
+    }
+    su->span = span;
+}
+
 // update sprite unit positions and sizes when updating registers
 static void _m6569_io_update_sunit(m6569_t* vic, size_t i, uint8_t mx, uint8_t my, uint8_t mx8, uint8_t mxe, uint8_t mye) {
     (void)my;   // FIXME: my is really unused?
@@ -529,6 +641,7 @@ static void _m6569_io_update_sunit(m6569_t* vic, size_t i, uint8_t mx, uint8_t m
     su->h_offset[i] = (xpos & 7);
     const uint16_t w = ((mxe & mask) ? 5 : 2) + ((su->h_offset[i] > 0) ? 1:0);
     su->h_last[i] = su->h_first[i] + w;
+    _m6569_sunit_update_span(su);
     /* 1. The expansion flip flop is set as long as the bit in MxYE in register
         $d017 corresponding to the sprite is cleared.
     */
@@ -555,6 +668,10 @@ static uint64_t _m6569_read(m6569_t* vic, uint64_t pins) {
             // registers 0x1E and 0x1F (mob collisions) are cleared on reading
             data = r->regs[r_addr];
             r->regs[r_addr] = 0;
+            if (r_addr == 0x1F) {
+                // software looks at sprite-data collisions, detect them exactly for a while
+                vic->sunit.mcd_frames = 2;
+            }
             break;
         default:
             // unconnected bits are returned as 1
@@ -739,6 +856,20 @@ static inline void _m6569_gunit_tick(m6569_t* vic, uint8_t g_data) {
     vic->gunit.shift <<= 1;
 }
 
+/* Advance the graphics sequencer by 8 pixels without decoding them,
+   same end state as calling _m6569_gunit_tick() 8 times. The reload
+   happens at pixel 'count' (0..7), and after 8 pixels count is back
+   at its original value.
+*/
+static inline void _m6569_gunit_skip(m6569_t* vic, uint8_t g_data) {
+    const uint8_t k = vic->gunit.count;
+    const uint8_t s = (uint8_t)(vic->gunit.shift << k) | g_data;
+    vic->gunit.outp = (uint8_t)(s << (7 - k));
+    vic->gunit.outp2 = (k & 1) ? vic->gunit.outp : (uint8_t)(s << (6 - k));
+    vic->gunit.shift = (uint8_t)(vic->gunit.outp << 1);
+    vic->gunit.c_data = vic->gunit.enabled ? vic->vm.line[vic->vm.vmli] : 0;
+}
+
 /*
     graphics sequencer decoding functions for 1 pixel
 
@@ -858,6 +989,7 @@ static inline void _m6569_sunit_start(m6569_t* vic) {
     const uint8_t me = vic->reg.me;
     const uint8_t mye = vic->reg.mye;
     m6569_sprite_unit_t* su = &vic->sunit;
+    const uint8_t dma_enabled = su->dma_enabled;
     su->expand ^= mye;
     for (size_t i = 0; i < 8; i++) {
         const uint8_t mask = (1<<i);
@@ -867,8 +999,12 @@ static inline void _m6569_sunit_start(m6569_t* vic) {
             su->mc_base[i] = 0;
         }
     }
+    if (su->dma_enabled != dma_enabled) {
+        _m6569_update_bus_ticks(vic);
+    }
     // NOTE: the following behaviour differs from the recipe
     su->disp_enabled &= su->dma_enabled;
+    _m6569_sunit_update_span(su);
 }
 
 static inline void _m6569_sunit_update_mc_disp_enable(m6569_t* vic) {
@@ -886,6 +1022,7 @@ static inline void _m6569_sunit_update_mc_disp_enable(m6569_t* vic) {
             su->disp_enabled |= mask;
         }
     }
+    _m6569_sunit_update_span(su);
 }
 
 /*
@@ -933,27 +1070,15 @@ static inline void _m6569_sunit_dma_disp_disable(m6569_t* vic) {
             }
         }
     }
+    const uint8_t dma_enabled = su->dma_enabled;
     for (size_t i = 0; i < 8; i++) {
         if (su->mc_base[i] == 0x3F) {
             su->dma_enabled &= ~(1<<i);
         }
     }
-}
-
-// set the BA pin if one or multiple sprite's DMA is enabled
-static inline uint64_t _m6569_sunit_dma_ba(m6569_t* vic, uint8_t mask, uint64_t pins) {
-    if (vic->sunit.dma_enabled & mask) {
-        pins |= M6569_BA;
+    if (su->dma_enabled != dma_enabled) {
+        _m6569_update_bus_ticks(vic);
     }
-    return pins;
-}
-
-// set the AEC pin one or multiple sprite's DMA are enabled
-static inline uint64_t _m6569_sunit_dma_aec(m6569_t* vic, uint8_t mask, uint64_t pins) {
-    if (vic->sunit.dma_enabled & mask) {
-        pins |= M6569_AEC;
-    }
-    return pins;
 }
 
 static inline uint16_t _m6569_sunit_decode(m6569_t* vic, uint8_t hpos) {
@@ -1066,18 +1191,93 @@ static inline uint8_t _m6569_color_multiplex(uint16_t bmc, uint16_t sc, uint8_t
     return c;
 }
 
+/*  Fast path for 8 pixels without sprites when the graphics sequencer
+    reloads at the first pixel (xscroll == 0 after the first g_access),
+    so that all 8 pixels come from the current g_data and c_data. The
+    pixels are built 8 at a time with byte masks from _m6569_expand
+    and written with one 64-bit store. Produces the same output and
+    sequencer state as the per-pixel loop in _m6569_decode_pixels().
+*/
+#define _M6569_BYTES(c) (0x0101010101010101ULL * (uint8_t)(c))
+
+static inline uint64_t _m6569_pixels_hires(uint8_t bits, uint8_t fg, uint8_t bg) {
+    const uint64_t m = _m6569_expand[bits];
+    return (_M6569_BYTES(fg) & m) | (_M6569_BYTES(bg) & ~m);
+}
+
+static inline uint64_t _m6569_pixels_multi(uint8_t bits, uint8_t c0, uint8_t c1, uint8_t c2, uint8_t c3) {
+    // expand each bit of the 2-bit pixel pairs to both pixels of the pair
+    const uint8_t hi = bits & 0xAA;
+    const uint8_t lo = bits & 0x55;
+    const uint64_t h = _m6569_expand[hi | (hi >> 1)];
+    const uint64_t l = _m6569_expand[lo | (lo << 1)];
+    return (_M6569_BYTES(c0) & ~h & ~l) | (_M6569_BYTES(c1) & ~h & l) |
+           (_M6569_BYTES(c2) & h & ~l)  | (_M6569_BYTES(c3) & h & l);
+}
+
+/*  8 pixels of graphics data in display mode 0..7, *fg receives the
+    foreground pixels as byte mask (top 8 bits set in the per-pixel
+    decoders), used for sprite priority and sprite-data collisions
+*/
+static inline uint64_t _m6569_pixels_mode(uint8_t mode, uint8_t bits, uint16_t c, const uint16_t* bg, uint64_t* fg) {
+    const uint8_t hi = bits & 0xAA;
+    switch (mode) {
+        case 0:
+            *fg = _m6569_expand[bits];
+            return _m6569_pixels_hires(bits, (c>>8) & 0xF, bg[0]);
+        case 1:
+            if (c & (1<<11)) {
+                *fg = _m6569_expand[hi | (hi >> 1)];
+                return _m6569_pixels_multi(bits, bg[0], bg[1], bg[2], (c>>8) & 0x7);
+            } else {
+                *fg = _m6569_expand[bits];
+                return _m6569_pixels_hires(bits, (c>>8) & 0x7, bg[0]);
+            }
+        case 2:
+            *fg = _m6569_expand[bits];
+            return _m6569_pixels_hires(bits, (c>>4) & 0xF, c & 0xF);
+        case 3:
+            *fg = _m6569_expand[hi | (hi >> 1)];
+            return _m6569_pixels_multi(bits, bg[0], (c>>4) & 0xF, c & 0xF, (c>>8) & 0xF);
+        case 4:
+            // background colors 2 and 3 count as foreground
+            *fg = (bg[(c>>6) & 3] & 0xFF00) ? ~0ULL : _m6569_expand[bits];
+            return _m6569_pixels_hires(bits, (c>>8) & 0xF, bg[(c>>6) & 3]);
+        default:
+            // illegal modes output black
+            *fg = 0;
+            return 0;
+    }
+}
+
+static inline void _m6569_decode_pixels_fast(m6569_t* vic, uint8_t g_data, uint8_t* dst) {
+    const uint8_t bits = vic->gunit.shift | g_data;
+    _m6569_gunit_skip(vic, g_data);
+    uint64_t fg;
+    const uint64_t pixels = _m6569_pixels_mode(vic->gunit.mode, bits, vic->gunit.c_data, vic->gunit.bg, &fg);
+    memcpy(dst, &pixels, sizeof(pixels));
+}
+
+// reset the per-line sprite shifter counters at the first tick of a sprite
+static inline void _m6569_sunit_restart(m6569_t* vic, uint8_t hpos) {
+    m6569_sprite_unit_t* su = &vic->sunit;
+    for (size_t i = 0; i < 8; i++) {
+        if ((su->disp_enabled & (1<<i)) && (hpos == su->h_first[i])) {
+            su->delay_count[i] = su->h_offset[i];
+            su->outp2_count[i] = 0;
+            su->xexp_count[i] = 0;
+        }
+    }
+}
+
 // decode the next 8 pixels
 static inline void _m6569_decode_pixels(m6569_t* vic, uint8_t g_data, uint8_t* dst) {
     const uint8_t hpos = vic->rs.h_count;
     m6569_sprite_unit_t* su = &vic->sunit;
-    if (su->disp_enabled != 0) {
-        for (size_t i = 0; i < 8; i++) {
-            if ((su->disp_enabled & (1<<i)) && (hpos == su->h_first[i])) {
-                su->delay_count[i] = su->h_offset[i];
-                su->outp2_count[i] = 0;
-                su->xexp_count[i] = 0;
-            }
-        }
+    // true if a displayed sprite covers this tick, otherwise the sprite unit is bypassed
+    const bool sprites = 0 != ((su->span >> hpos) & 1);
+    if (sprites) {
+        _m6569_sunit_restart(vic, hpos);
     }
 
     /*
@@ -1106,12 +1306,25 @@ static inline void _m6569_decode_pixels(m6569_t* vic, uint8_t g_data, uint8_t* d
     */
     bool brd = vic->brd.vert | vic->brd.main;
     uint8_t brd_color = vic->brd.main ? vic->brd.bc : vic->gunit.bg[0];
+    if (brd && !sprites) {
+        /* solid border span (upper/lower border, vblank or side border), no
+           sprite can produce a pixel or a collision, so only the graphics
+           sequencer state needs to be carried forward
+        */
+        memset(dst, brd_color, M6569_PIXELS_PER_TICK);
+        _m6569_gunit_skip(vic, g_data);
+        return;
+    }
+    if (!sprites && (vic->gunit.count == 0)) {
+        _m6569_decode_pixels_fast(vic, g_data, dst);
+        return;
+    }
     const uint8_t mdp = vic->reg.mdp;
     const uint8_t mode = vic->gunit.mode;
     uint16_t bmc = 0;
     for (size_t i = 0; i < 8; i++) {
         // lower 8 bit sprite color, top 8 bit 'coverage mask'
-        uint16_t sc = _m6569_sunit_decode(vic, hpos);
+        uint16_t sc = sprites ? _m6569_sunit_decode(vic, hpos) : 0;
         _m6569_gunit_tick(vic, g_data);
         // bmc: lower 8 bit color, top 8 bit set (foregreound) or cleared (background)
         switch (mode) {
@@ -1128,6 +1341,155 @@ static inline void _m6569_decode_pixels(m6569_t* vic, uint8_t g_data, uint8_t* d
     }
 }
 
+/*  True if sprite-data collisions must be detected. With lazy_collisions
+    they are skipped unless the IMBC interrupt is enabled or $D01F was read
+    in the current or previous frame. A program that starts polling $D01F
+    may miss collisions in its first read, after that the polling keeps
+    the detection on. Sprite-sprite collisions come from the sprite unit
+    itself and are always exact.
+*/
+static inline bool _m6569_mcd_exact(const m6569_t* vic) {
+    return !vic->lazy_collisions || (vic->reg.int_mask & M6569_INT_EMBC) || (vic->sunit.mcd_frames != 0);
+}
+
+/*  Timing-only replacement for _m6569_decode_pixels(), nothing is written
+    to the framebuffer. Pixels only have a CPU-visible effect through the
+    sprite collision registers, so the full decoder only runs in ticks
+    covered by a displayed sprite, otherwise just the graphics sequencer
+    state is carried forward. If sprite-data collisions are not needed,
+    only the sprite unit runs for sprite-sprite collisions.
+*/
+static inline void _m6569_decode_timing(m6569_t* vic, uint8_t g_data) {
+    const uint8_t hpos = vic->rs.h_count;
+    if ((vic->sunit.span >> hpos) & 1) {
+        if (_m6569_mcd_exact(vic)) {
+            uint8_t dst[M6569_PIXELS_PER_TICK];
+            _m6569_decode_pixels(vic, g_data, dst);
+        } else {
+            _m6569_sunit_restart(vic, hpos);
+            for (size_t i = 0; i < M6569_PIXELS_PER_TICK; i++) {
+                _m6569_sunit_decode(vic, hpos);
+            }
+            _m6569_gunit_skip(vic, g_data);
+        }
+    } else {
+        _m6569_gunit_skip(vic, g_data);
+    }
+}
+
+/*  Line renderer, the alternative to _m6569_decode_pixels(). Each tick
+    only records the graphics sequencer input (g_data and c_data), and the
+    whole visible CRT line is rendered in tick 55 with the last g-access,
+    before the sprite display flags are updated for the next line. Display
+    mode, colors, xscroll, the 38/40 column border and the sprite registers
+    are sampled once per line, so mid-line raster effects (color splits,
+    opened side borders, sprite changes within a line) are not shown.
+    Sprite collisions are detected per line. BA, AEC and the raster
+    interrupt are unaffected.
+*/
+#define _M6569_LINE_RENDER_TICK (55)
+#define _M6569_LINE_PIXELS (64 * M6569_PIXELS_PER_TICK)
+#define _M6569_MIN(a,b) (((a)<(b))?(a):(b))
+#define _M6569_MAX(a,b) (((a)>(b))?(a):(b))
+
+static inline void _m6569_line_capture(m6569_t* vic, uint8_t g_data) {
+    const uint8_t hpos = vic->rs.h_count;
+    vic->lunit.g_data[hpos] = g_data;
+    vic->lunit.c_data[hpos] = vic->gunit.enabled ? vic->vm.line[vic->vm.vmli] : 0;
+}
+
+static void _m6569_render_line(m6569_t* vic) {
+    const m6569_crt_t* crt = &vic->crt;
+    if ((crt->y < crt->vis_y0) || (crt->y >= crt->vis_y1)) {
+        return;
+    }
+    /* pixels are addressed by line position lx = h_count * 8 + pixel, the
+       framebuffer x of a line position is lx + x0 (crt.x = h_count - 4)
+    */
+    uint8_t* dst = crt->fb + (crt->y - crt->vis_y0) * M6569_FRAMEBUFFER_WIDTH;
+    const int x0 = -(4 + crt->vis_x0) * M6569_PIXELS_PER_TICK;
+    const int vis_first = -x0;
+    const int vis_last = _M6569_MIN(_M6569_LINE_PIXELS, crt->vis_w * M6569_PIXELS_PER_TICK - x0);
+    memset(dst, vic->brd.bc, crt->vis_w * M6569_PIXELS_PER_TICK);
+
+    // graphics between the main border comparisons, delayed by xscroll pixels
+    const int xs = vic->reg.ctrl_2 & M6569_CTRL2_XSCROLL;
+    const bool gfx = !vic->brd.vert;
+    const int gfx_first = vic->brd.left * M6569_PIXELS_PER_TICK;
+    const int gfx_last = vic->brd.right * M6569_PIXELS_PER_TICK;
+    uint64_t pixels[64];
+    uint64_t fg[64];
+    const uint8_t* fg_bytes = (const uint8_t*) fg;
+    if (gfx) {
+        for (int h = vic->brd.left - 1; h < vic->brd.right; h++) {
+            pixels[h] = _m6569_pixels_mode(vic->gunit.mode, vic->lunit.g_data[h], vic->lunit.c_data[h], vic->gunit.bg, &fg[h]);
+        }
+        const int first = _M6569_MAX(gfx_first, vis_first);
+        const int last = _M6569_MIN(gfx_last, vis_last);
+        if (first < last) {
+            memcpy(dst + x0 + first, (const uint8_t*)pixels + first - xs, (size_t)(last - first));
+        }
+    }
+
+    // sprites, lower sprite numbers have priority, the border overlays sprites
+    const m6569_sprite_unit_t* su = &vic->sunit;
+    if (su->disp_enabled == 0) {
+        return;
+    }
+    uint8_t occupied[_M6569_LINE_PIXELS];
+    uint8_t colors[_M6569_LINE_PIXELS];
+    memset(occupied, 0, sizeof(occupied));
+    const uint8_t mxe = vic->reg.mxe;
+    const uint8_t mmc = vic->reg.mmc;
+    for (int i = 7; i >= 0; i--) {
+        const uint8_t mask = 1 << i;
+        if (!(su->disp_enabled & mask) || (su->h_first[i] > 63)) {
+            continue;
+        }
+        // the 24 sprite data bits, the shift register is not clocked by the line renderer
+        const uint32_t data = su->shift[i] >> 8;
+        const int xexp = (mxe & mask) ? 1 : 0;
+        const int first = su->h_first[i] * M6569_PIXELS_PER_TICK + su->h_offset[i];
+        const int last = _M6569_MIN(first + (24 << xexp), vis_last);
+        for (int lx = _M6569_MAX(first, vis_first); lx < last; lx++) {
+            const int b = (lx - first) >> xexp;
+            const uint8_t ci = (mmc & mask) ? ((data >> (22 - (b & ~1))) & 3) : (((data >> (23 - b)) & 1) << 1);
+            if (ci != 0) {
+                occupied[lx] |= mask;
+                colors[lx] = su->colors[i][ci];
+            }
+        }
+    }
+    const uint8_t mdp = vic->reg.mdp;
+    uint8_t mcm = 0;
+    uint8_t mcd = 0;
+    for (int lx = vis_first; lx < vis_last; lx++) {
+        const uint8_t o = occupied[lx];
+        if (o != 0) {
+            if (o & (o - 1)) {
+                mcm |= o;
+            }
+            if (gfx && (lx >= gfx_first) && (lx < gfx_last)) {
+                const bool fg_pixel = 0 != fg_bytes[lx - xs];
+                if (fg_pixel) {
+                    mcd |= o;
+                }
+                if (!(fg_pixel && (o & mdp))) {
+                    dst[x0 + lx] = colors[lx];
+                }
+            }
+        }
+    }
+    if (mcm) {
+        vic->reg.mcm |= mcm;
+        vic->reg.int_latch |= M6569_INT_IMMC;
+    }
+    if (mcd) {
+        vic->reg.mcd |= mcd;
+        vic->reg.int_latch |= M6569_INT_IMBC;
+    }
+}
+
 /* decode the next 8 pixels as debug visualization */
 static void _m6569_decode_pixels_debug(m6569_t* vic, uint8_t g_data, bool ba_pin, uint8_t* dst) {
     _m6569_decode_pixels(vic, g_data, dst);
@@ -1185,6 +1547,9 @@ static inline void _m6569_rs_next_rasterline(m6569_t* vic) {
     if (vic->rs.v_count == (M6569_VTOTAL-1)) {
         vic->rs.v_count = 0;
         vic->rs.vc_base = 0;
+        if (vic->sunit.mcd_frames != 0) {
+            vic->sunit.mcd_frames--;
+        }
     } else {
         vic->rs.v_count++;
     }
@@ -1215,6 +1580,7 @@ static inline void _m6569_rs_check_irq(m6569_t* vic) {
 
 */
 static inline void _m6569_rs_update_badline(m6569_t* vic) {
+    bool badline = false;
     if (_M6569_RAST_RANGE(48, 247)) {
         // DEN bit must have been set in raster line $30
         if (_M6569_RAST(48) && (vic->reg.ctrl_1 & M6569_CTRL1_DEN)) {
@@ -1224,12 +1590,15 @@ static inline void _m6569_rs_update_badline(m6569_t* vic) {
             are identical with YSCROLL
         */
         bool yscroll_match = ((vic->rs.v_count & 7) == (vic->reg.ctrl_1 & 7));
-        vic->rs.badline = vic->rs.frame_badlines_enabled && yscroll_match;
+        badline = vic->rs.frame_badlines_enabled && yscroll_match;
     } else {
         vic->rs.frame_badlines_enabled = false;
-        vic->rs.badline = false;
     }
-    if (vic->rs.badline) {
+    if (badline != vic->rs.badline) {
+        vic->rs.badline = badline;
+        _m6569_update_bus_ticks(vic);
+    }
+    if (badline) {
         vic->rs.display_state = true;
     }
 }
@@ -1331,17 +1700,38 @@ static inline void _m6569_bunit_end(m6569_t* vic) {
     }
 }
 
-/* memory access functions */
+/*  memory access functions
+
+    With m6569_set_bank() the 14-bit VIC address is an index into one of
+    the four 4 KByte bank pages, so a fetch is an array load instead of a
+    call through fetch_cb. Only c-accesses need the color RAM nibble.
+*/
+static inline uint8_t _m6569_fetch(m6569_t* vic, uint16_t addr) {
+    if (vic->mem.bank[0]) {
+        return vic->mem.bank[(addr >> 12) & 3][addr & 0x0FFF];
+    } else {
+        return (uint8_t) vic->mem.fetch_cb(addr, vic->mem.user_data);
+    }
+}
+
+static inline uint16_t _m6569_fetch_c(m6569_t* vic, uint16_t addr) {
+    if (vic->mem.bank[0]) {
+        return ((vic->mem.color_ram[addr & 0x03FF] & 0x0F) << 8) | vic->mem.bank[(addr >> 12) & 3][addr & 0x0FFF];
+    } else {
+        return vic->mem.fetch_cb(addr, vic->mem.user_data) & 0x0FFF;
+    }
+}
+
 static inline void _m6569_c_access(m6569_t* vic) {
     if (vic->rs.badline) {
         /* addr=|VM13|VM12|VM11|VM10|VC9|VC8|VC7|VC6|VC5|VC4|VC3|VC2|VC1|VC0| */
         uint16_t addr = vic->rs.vc | vic->mem.c_addr_or;
-        vic->vm.line[vic->vm.vmli] = vic->mem.fetch_cb(addr, vic->mem.user_data) & 0x0FFF;
+        vic->vm.line[vic->vm.vmli] = _m6569_fetch_c(vic, addr);
     }
 }
 
 static inline uint8_t _m6569_i_access(m6569_t* vic) {
-    return (uint8_t) vic->mem.fetch_cb(vic->mem.i_addr, vic->mem.user_data);
+    return _m6569_fetch(vic, vic->mem.i_addr);
 }
 
 static inline uint8_t _m6569_g_i_access(m6569_t* vic) {
@@ -1359,7 +1749,7 @@ static inline uint8_t _m6569_g_i_access(m6569_t* vic) {
         }
         vic->rs.next_vc = (vic->rs.vc + 1) & 0x3FF;          // VC is a 10-bit counter
         vic->vm.next_vmli = (vic->vm.vmli + 1) & 0x3F;  // VMLI is a 6-bit counter
-        return (uint8_t) vic->mem.fetch_cb(addr, vic->mem.user_data);
+        return _m6569_fetch(vic, addr);
     } else {
         return _m6569_i_access(vic);
     }
@@ -1367,7 +1757,7 @@ static inline uint8_t _m6569_g_i_access(m6569_t* vic) {
 
 static inline void _m6569_p_access(m6569_t* vic, uint32_t p_index) {
     uint16_t addr = vic->mem.p_addr_or + p_index;
-    vic->sunit.p_data[p_index] = (uint8_t) vic->mem.fetch_cb(addr, vic->mem.user_data);
+    vic->sunit.p_data[p_index] = _m6569_fetch(vic, addr);
 }
 
 static inline void _m6569_s_access(m6569_t* vic, uint32_t s_index) {
@@ -1375,7 +1765,7 @@ static inline void _m6569_s_access(m6569_t* vic, uint32_t s_index) {
     m6569_sprite_unit_t* su = &vic->sunit;
     if (su->dma_enabled & (1<<s_index)) {
         uint16_t addr = (su->p_data[s_index]<<6) | su->mc[s_index];
-        uint8_t s_data = (uint8_t) vic->mem.fetch_cb(addr, vic->mem.user_data);
+        uint8_t s_data = _m6569_fetch(vic, addr);
         su->shift[s_index] = (su->shift[s_index]<<8) | (s_data<<8);
         su->mc[s_index] = (su->mc[s_index] + 1) & 0x3F;
     }
@@ -1386,7 +1776,7 @@ static inline uint8_t _m6569_s_i_access(m6569_t* vic, uint32_t s_index) {
     m6569_sprite_unit_t* su = &vic->sunit;
     if (su->dma_enabled & (1<<s_index)) {
         uint16_t addr = (su->p_data[s_index]<<6) | su->mc[s_index];
-        uint8_t s_data = (uint8_t) vic->mem.fetch_cb(addr, vic->mem.user_data);
+        uint8_t s_data = _m6569_fetch(vic, addr);
         su->shift[s_index] = (su->shift[s_index]<<8) | (s_data<<8);
         su->mc[s_index] = (su->mc[s_index] + 1) & 0x3F;
         return 0;
@@ -1395,19 +1785,6 @@ static inline uint8_t _m6569_s_i_access(m6569_t* vic, uint32_t s_index) {
     }
 }
 
-// set BA pin if badline flag is set
-static inline uint64_t _m6569_ba(m6569_t* vic, uint64_t pins) {
-    if (vic->rs.badline) {
-        pins |= M6569_BA;
-    }
-    return pins;
-}
-
-// set AEC pin
-static inline uint64_t _m6569_aec(uint64_t pins) {
-    return pins | M6569_AEC;
-}
-
 // internal tick function
 static uint64_t _m6569_tick(m6569_t* vic, uint64_t pins) {
     pins &= ~M6569_BA;
@@ -1415,89 +1792,56 @@ static uint64_t _m6569_tick(m6569_t* vic, uint64_t pins) {
     _m6569_rs_update_badline(vic);
 
     // a raster line is 63 ticks, and each line goes through a fixed 'program'
-    vic->rs.h_count++;
+    const uint8_t h_count = ++vic->rs.h_count;
     vic->crt.x++;
-    switch (vic->rs.h_count) {
+    switch (h_count) {
         case 1:
             _m6569_p_access(vic, 3);
             _m6569_s_access(vic, 3);
-            pins = _m6569_sunit_dma_aec(vic, (1<<3), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<3)|(1<<4), pins);
             break;
         case 2:
             g_data = _m6569_s_i_access(vic, 3);
             _m6569_s_access(vic, 3);
-            pins = _m6569_sunit_dma_aec(vic, (1<<3), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<3)|(1<<4)|(1<<5), pins);
             break;
         case 3:
             _m6569_p_access(vic, 4);
             _m6569_s_access(vic, 4);
-            pins = _m6569_sunit_dma_aec(vic, (1<<4), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<4)|(1<<5), pins);
             break;
         case 4:
             _m6569_crt_next_crtline(vic);
             g_data = _m6569_s_i_access(vic, 4);
             _m6569_s_access(vic, 4);
-            pins = _m6569_sunit_dma_aec(vic, (1<<4), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<4)|(1<<5)|(1<<6), pins);
             break;
         case 5:
             _m6569_p_access(vic, 5);
             _m6569_s_access(vic, 5);
-            pins = _m6569_sunit_dma_aec(vic, (1<<5), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<5)|(1<<6), pins);
             break;
         case 6:
             g_data = _m6569_s_i_access(vic, 5);
             _m6569_s_access(vic, 5);
-            pins = _m6569_sunit_dma_aec(vic, (1<<5), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<5)|(1<<6)|(1<<7), pins);
             break;
         case 7:
             _m6569_p_access(vic, 6);
             _m6569_s_access(vic, 6);
-            pins = _m6569_sunit_dma_aec(vic, (1<<6), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<6)|(1<<7), pins);
             break;
         case 8:
             g_data = _m6569_s_i_access(vic, 6);
             _m6569_s_access(vic, 6);
-            pins = _m6569_sunit_dma_aec(vic, (1<<6), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<6)|(1<<7), pins);
             break;
         case 9:
             _m6569_p_access(vic, 7);
             _m6569_s_access(vic, 7);
-            pins = _m6569_sunit_dma_aec(vic, (1<<7), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<7), pins);
             break;
         case 10:
             g_data = _m6569_s_i_access(vic, 7);
             _m6569_s_access(vic, 7);
-            pins = _m6569_sunit_dma_aec(vic, (1<<7), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<7), pins);
-            break;
-        case 11:
             break;
-        case 12:
-            pins = _m6569_ba(vic, pins);
-            break;
-        case 13:
-            pins = _m6569_ba(vic, pins);
+        case 11: case 12: case 13: case 15:
             break;
         case 14:
-            pins = _m6569_ba(vic, pins);
             _m6569_rs_rewind_vc_vmli_rc(vic);
             break;
-        case 15:
-            pins = _m6569_ba(vic, pins);
-            pins = _m6569_aec(pins);
-            break;
         case 16:
-            pins = _m6569_ba(vic, pins);
-            pins = _m6569_aec(pins);
             vic->gunit.enabled = vic->rs.display_state;
             _m6569_gunit_rewind(vic);
             _m6569_sunit_update_mcbase(vic);
@@ -1506,8 +1850,6 @@ static uint64_t _m6569_tick(m6569_t* vic, uint64_t pins) {
             _m6569_bunit_left(vic, 16);
             break;
         case 17:
-            pins = _m6569_ba(vic, pins);
-            pins = _m6569_aec(pins);
             vic->gunit.enabled = vic->rs.display_state;
             _m6569_sunit_dma_disp_disable(vic);
             _m6569_c_access(vic);
@@ -1519,8 +1861,6 @@ static uint64_t _m6569_tick(m6569_t* vic, uint64_t pins) {
         case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
         case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48: case 49:
         case 50: case 51: case 52: case 53: case 54:
-            pins = _m6569_ba(vic, pins);
-            pins = _m6569_aec(pins);
             vic->gunit.enabled = vic->rs.display_state;
             _m6569_c_access(vic);
             g_data = _m6569_g_i_access(vic);
@@ -1529,63 +1869,51 @@ static uint64_t _m6569_tick(m6569_t* vic, uint64_t pins) {
             vic->gunit.enabled = vic->rs.display_state;
             _m6569_c_access(vic);
             g_data = _m6569_g_i_access(vic);
-            pins = _m6569_sunit_dma_ba(vic, (1<<0), pins);
             _m6569_bunit_right(vic, 55);
             break;
         case 56:
             vic->gunit.enabled = false;
             _m6569_sunit_start(vic);
             g_data = _m6569_i_access(vic);
-            pins = _m6569_sunit_dma_ba(vic, (1<<0), pins);
             _m6569_bunit_right(vic, 56);
             break;
         case 57:
             g_data = _m6569_i_access(vic);
-            pins = _m6569_sunit_dma_ba(vic, (1<<0)|(1<<1), pins);
             break;
         case 58:
             _m6569_rs_update_display_state(vic);
             _m6569_sunit_update_mc_disp_enable(vic);
             _m6569_p_access(vic, 0);
             _m6569_s_access(vic, 0);
-            pins = _m6569_sunit_dma_aec(vic, (1<<0), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<0)|(1<<1), pins);
             break;
         case 59:
             g_data = _m6569_s_i_access(vic, 0);
             _m6569_s_access(vic, 0);
-            pins = _m6569_sunit_dma_aec(vic, (1<<0), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<0)|(1<<1)|(1<<2), pins);
             break;
         case 60:
             _m6569_p_access(vic, 1);
             _m6569_s_access(vic, 1);
-            pins = _m6569_sunit_dma_aec(vic, (1<<1), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<1)|(1<<2), pins);
             break;
         case 61:
             g_data = _m6569_s_i_access(vic, 1);
             _m6569_s_access(vic, 1);
-            pins = _m6569_sunit_dma_aec(vic, (1<<1), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<1)|(1<<2)|(1<<3), pins);
             break;
         case 62:
             _m6569_p_access(vic, 2);
             _m6569_s_access(vic, 2);
-            pins = _m6569_sunit_dma_aec(vic, (1<<2), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<2)|(1<<3), pins);
             break;
         case 63:    /* HTOTAL */
             _m6569_rs_next_rasterline(vic);
             _m6569_rs_check_irq(vic);
             g_data = _m6569_s_i_access(vic, 2);
             _m6569_s_access(vic, 2);
-            pins = _m6569_sunit_dma_aec(vic, (1<<2), pins);
-            pins = _m6569_sunit_dma_ba(vic, (1<<2)|(1<<3)|(1<<4), pins);
             _m6569_bunit_end(vic);
             break;
         default: _M6569_UNREACHABLE;
     }
+    //-- BA and AEC from the per-line bus tick masks
+    pins |= ((vic->mem.ba_ticks >> h_count) & 1) << M6569_PIN_BA;
+    pins |= ((vic->mem.aec_ticks >> h_count) & 1) << M6569_PIN_AEC;
     //-- main interrupt bit
     if (vic->reg.int_latch & vic->reg.int_mask & 0x0F) {
         vic->reg.int_latch |= M6569_INT_IRQ;
@@ -1603,13 +1931,23 @@ static uint64_t _m6569_tick(m6569_t* vic, uint64_t pins) {
         uint8_t* dst = vic->crt.fb + (y * M6569_FRAMEBUFFER_WIDTH) + (x * M6569_PIXELS_PER_TICK);
         _m6569_decode_pixels_debug(vic, g_data, 0 != (pins & M6569_BA), dst);
     }
+    else if (vic->line_renderer && !vic->timing_only) {
+        _m6569_line_capture(vic, g_data);
+        if (h_count == _M6569_LINE_RENDER_TICK) {
+            _m6569_render_line(vic);
+        }
+    }
     else if ((vic->crt.x >= vic->crt.vis_x0) && (vic->crt.x < vic->crt.vis_x1) &&
              (vic->crt.y >= vic->crt.vis_y0) && (vic->crt.y < vic->crt.vis_y1))
     {
-        const size_t x = vic->crt.x - vic->crt.vis_x0;
-        const size_t y = vic->crt.y - vic->crt.vis_y0;
-        uint8_t* dst = vic->crt.fb + (y * M6569_FRAMEBUFFER_WIDTH) + (x * M6569_PIXELS_PER_TICK);
-        _m6569_decode_pixels(vic, g_data, dst);
+        if (vic->timing_only) {
+            _m6569_decode_timing(vic, g_data);
+        } else {
+            const size_t x = vic->crt.x - vic->crt.vis_x0;
+            const size_t y = vic->crt.y - vic->crt.vis_y0;
+            uint8_t* dst = vic->crt.fb + (y * M6569_FRAMEBUFFER_WIDTH) + (x * M6569_PIXELS_PER_TICK);
+            _m6569_decode_pixels(vic, g_data, dst);
+        }
     }
     vic->rs.vc = vic->rs.next_vc;
     vic->vm.vmli = vic->vm.next_vmli;
@@ -1633,6 +1971,163 @@ uint64_t m6569_tick(m6569_t* vic, uint64_t pins) {
     return pins;
 }
 
+/*  Fast-forwarding for idle CPU phases (see m6569_skip())
+
+    In timing-only mode, without sprites and without register accesses,
+    a raster line only advances the raster, border and sprite counters,
+    fills the video matrix line on badlines and carries the graphics
+    sequencer state forward. _m6569_skip_line() does all that for the 63
+    ticks from tick 16 of a line to tick 15 of the next in one go, tick
+    16 is where the graphics sequencer is rewound. Partial lines are
+    ticked normally.
+
+    After a rewind, each _m6569_gunit_skip() shifts the previous pixels
+    out completely, so the graphics sequencer state at the end of the
+    line only depends on the last visible tick.
+*/
+static inline bool _m6569_skip_crt_row_visible(const m6569_crt_t* crt, uint16_t y) {
+    return (y >= crt->vis_y0) && (y < crt->vis_y1);
+}
+
+// the last tick in the order 16..63, 1..15 decoded by _m6569_decode_timing(), 0 if none
+static uint8_t _m6569_skip_last_visible_tick(const m6569_t* vic, uint16_t y0, uint16_t y1) {
+    const m6569_crt_t* crt = &vic->crt;
+    // ticks 4..15 are CRT x 0..11 in row y1
+    if (_m6569_skip_crt_row_visible(crt, y1) && (crt->vis_x0 <= 11) && (crt->vis_x1 > 0)) {
+        return _M6569_MIN(crt->vis_x1 - 1, 11) + 4;
+    }
+    if (_m6569_skip_crt_row_visible(crt, y0)) {
+        // ticks 1..3 are CRT x 60..62 in row y0
+        if ((crt->vis_x0 <= 62) && (crt->vis_x1 > 60)) {
+            return _M6569_MIN(crt->vis_x1 - 1, 62) - 59;
+        }
+        // ticks 16..63 are CRT x 12..59 in row y0
+        if ((crt->vis_x0 <= 59) && (crt->vis_x1 > 12)) {
+            return _M6569_MIN(crt->vis_x1 - 1, 59) + 4;
+        }
+    }
+    return 0;
+}
+
+// true if a tick outside 16..55 does an i-access while no sprite DMA is active
+static inline bool _m6569_skip_i_tick(uint8_t h) {
+    return (h == 56) || (h == 57) || (h == 59) || (h == 61) || (h == 63) || ((h <= 10) && (0 == (h & 1)));
+}
+
+// graphics sequencer state after a _m6569_gunit_skip() that follows a rewind or another _m6569_gunit_skip()
+static inline void _m6569_skip_gunit_load(m6569_t* vic, uint8_t g_data, uint16_t c_data) {
+    const uint8_t k = vic->gunit.count;
+    vic->gunit.outp = (uint8_t)(g_data << (7 - k));
+    vic->gunit.outp2 = (k & 1) ? vic->gunit.outp : (uint8_t)(g_data << (6 - k));
+    vic->gunit.shift = (uint8_t)(vic->gunit.outp << 1);
+    vic->gunit.c_data = c_data;
+}
+
+static void _m6569_skip_line(m6569_t* vic) {
+    m6569_raster_unit_t* rs = &vic->rs;
+    const uint16_t y0 = vic->crt.y;
+    const uint16_t next_v_count = (rs->v_count == (M6569_VTOTAL-1)) ? 0 : (rs->v_count + 1);
+    const uint16_t y1 = (next_v_count == _M6569_VRETRACEPOS) ? 0 : (y0 + 1);
+    const uint8_t last_tick = _m6569_skip_last_visible_tick(vic, y0, y1);
+    uint8_t g_data = 0;
+    uint16_t c_data = 0;
+
+    // ticks 16..55, VC is at VCBASE and VMLI is 0 since tick 14
+    _m6569_rs_update_badline(vic);
+    const bool display = rs->display_state;
+    vic->gunit.enabled = display;
+    _m6569_gunit_rewind(vic);
+    _m6569_sunit_update_mcbase(vic);
+    _m6569_sunit_dma_disp_disable(vic);
+    _m6569_bunit_left(vic, 16);
+    _m6569_bunit_left(vic, 17);
+    if (display) {
+        const uint16_t vc = rs->vc;
+        if (rs->badline) {
+            for (uint16_t i = 0; i < 40; i++) {
+                vic->vm.line[i] = _m6569_fetch_c(vic, ((vc + i) & 0x3FF) | vic->mem.c_addr_or);
+            }
+        }
+        if ((last_tick >= 16) && (last_tick <= 55)) {
+            const uint8_t vmli = last_tick - 16;
+            uint16_t addr;
+            if (vic->reg.ctrl_1 & M6569_CTRL1_BMM) {
+                addr = (((vc + vmli) & 0x3FF)<<3) | rs->rc;
+                addr = (addr | (vic->mem.g_addr_or & (1<<13))) & vic->mem.g_addr_and;
+            } else {
+                addr = ((vic->vm.line[vmli]&0xFF)<<3) | rs->rc;
+                addr = (addr | vic->mem.g_addr_or) & vic->mem.g_addr_and;
+            }
+            g_data = _m6569_fetch(vic, addr);
+            c_data = vic->vm.line[vmli];
+        }
+        rs->vc = rs->next_vc = (vc + 40) & 0x3FF;
+        vic->vm.vmli = vic->vm.next_vmli = 40;
+    } else if ((last_tick >= 16) && (last_tick <= 55)) {
+        g_data = _m6569_i_access(vic);
+    }
+    if ((last_tick != 0) && ((last_tick < 16) || (last_tick > 55)) && _m6569_skip_i_tick(last_tick)) {
+        g_data = _m6569_i_access(vic);
+    }
+    _m6569_bunit_right(vic, 55);
+
+    // ticks 56..63
+    vic->gunit.enabled = false;
+    _m6569_sunit_start(vic);
+    _m6569_bunit_right(vic, 56);
+    _m6569_rs_update_display_state(vic);
+    _m6569_sunit_update_mc_disp_enable(vic);
+    for (uint32_t i = 0; i < 3; i++) {
+        _m6569_p_access(vic, i);
+    }
+    _m6569_rs_next_rasterline(vic);
+    _m6569_rs_check_irq(vic);
+    _m6569_bunit_end(vic);
+
+    // ticks 1..15 of the next line
+    _m6569_rs_update_badline(vic);
+    for (uint32_t i = 3; i < 8; i++) {
+        _m6569_p_access(vic, i);
+    }
+    _m6569_crt_next_crtline(vic);
+    _m6569_rs_rewind_vc_vmli_rc(vic);
+    if (last_tick != 0) {
+        _m6569_skip_gunit_load(vic, g_data, c_data);
+    }
+    rs->h_count = 15;
+    vic->crt.x = 11;
+}
+
+uint32_t m6569_idle_ticks(const m6569_t* vic) {
+    if (!vic->timing_only || vic->debug_vis || (0 != (vic->reg.me | vic->sunit.dma_enabled | vic->sunit.disp_enabled))) {
+        return 0;
+    }
+    // the raster interrupt is checked in tick 63 of the line before v_irqline
+    const uint32_t lines = (vic->rs.v_irqline + 2*M6569_VTOTAL - vic->rs.v_count - 1) % M6569_VTOTAL;
+    return lines * M6569_HTOTAL + (M6569_HTOTAL - vic->rs.h_count) - 1;
+}
+
+void m6569_skip(m6569_t* vic, uint32_t num_ticks) {
+    CHIPS_ASSERT(num_ticks <= m6569_idle_ticks(vic));
+    while (num_ticks > 0) {
+        if ((vic->rs.h_count == 15) && (num_ticks >= M6569_HTOTAL)) {
+            _m6569_skip_line(vic);
+            num_ticks -= M6569_HTOTAL;
+        } else {
+            _m6569_tick(vic, 0);
+            num_ticks--;
+        }
+    }
+}
+
+void m6569_set_bank(m6569_t* vic, const uint8_t* const pages[4], const uint8_t* color_ram) {
+    CHIPS_ASSERT(vic && (!pages || (pages[0] && pages[1] && pages[2] && pages[3] && color_ram)));
+    for (size_t i = 0; i < 4; i++) {
+        vic->mem.bank[i] = pages ? pages[i] : 0;
+    }
+    vic->mem.color_ram = color_ram;
+}
+
 chips_rect_t m6569_screen(m6569_t* vic) {
     CHIPS_ASSERT(vic);
     return (chips_rect_t){
@@ -1734,6 +2229,10 @@ void m6569_snapshot_onsave(m6569_t* snapshot) {
     CHIPS_ASSERT(snapshot);
     snapshot->mem.fetch_cb = 0;
     snapshot->mem.user_data = 0;
+    for (size_t i = 0; i < 4; i++) {
+        snapshot->mem.bank[i] = 0;
+    }
+    snapshot->mem.color_ram = 0;
     snapshot->crt.fb = 0;
 }
 
@@ -1741,6 +2240,10 @@ void m6569_snapshot_onload(m6569_t* snapshot, m6569_t* sys) {
     CHIPS_ASSERT(snapshot && sys);
     snapshot->mem.fetch_cb = sys->mem.fetch_cb;
     snapshot->mem.user_data = sys->mem.user_data;
+    for (size_t i = 0; i < 4; i++) {
+        snapshot->mem.bank[i] = sys->mem.bank[i];
+    }
+    snapshot->mem.color_ram = sys->mem.color_ram;
     snapshot->crt.fb = sys->crt.fb;
 }
 
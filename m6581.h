@@ -248,6 +248,12 @@ void m6581_init(m6581_t* sid, const m6581_desc_t* desc);
 void m6581_reset(m6581_t* sid);
 // tick a m6581_t instance
 uint64_t m6581_tick(m6581_t* sid, uint64_t pins);
+// tick a m6581_t instance without sound output (no filter, mixer or M6581_SAMPLE)
+uint64_t m6581_tick_silent(m6581_t* sid, uint64_t pins);
+// fast-forward a m6581_t instance by num_ticks without sound output, same result as m6581_tick_silent() without chip select
+void m6581_skip(m6581_t* sid, uint32_t num_ticks);
+// run up to num_ticks without chip select and write new samples to a buffer, stops when the buffer is full, returns number of ticks run
+uint32_t m6581_synth(m6581_t* sid, uint32_t num_ticks, float* samples, int max_samples, int* num_samples);
 
 #ifdef __cplusplus
 } // extern "C"
@@ -304,6 +310,13 @@ static const uint8_t _m6581_env_gen_dr_divisors[256] = {
 
 static float _m6581_cutoff_freq[2048];
 
+/* position of each state in the 15-bit envelope rate LFSR sequence starting
+   at 0x7FFF and the reverse mapping, used by m6581_skip()
+*/
+#define _M6581_ENV_LFSR_PERIOD (0x7FFF)
+static uint16_t _m6581_env_lfsr_index[1<<15];
+static uint16_t _m6581_env_lfsr_state[_M6581_ENV_LFSR_PERIOD];
+
 static void _m6581_init_voice(m6581_voice_t* v) {
     memset(v, 0, sizeof(*v));
     v->noise_shift = 0x007FFFFC;
@@ -319,6 +332,16 @@ static void _m6581_init_cutoff_table() {
     }
 }
 
+static void _m6581_init_env_lfsr_tables() {
+    uint32_t lfsr = 0x7FFF;
+    for (uint32_t i = 0; i < _M6581_ENV_LFSR_PERIOD; i++) {
+        _m6581_env_lfsr_index[lfsr] = i;
+        _m6581_env_lfsr_state[i] = lfsr;
+        const uint32_t feedback = ((lfsr >> 14) ^ (lfsr >> 13)) & 1;
+        lfsr = ((lfsr << 1) | feedback) & 0x7FFF;
+    }
+}
+
 static void _m6581_set_filter_cutoff(m6581_filter_t*);
 static void _m6581_set_resonance(m6581_filter_t*);
 
@@ -343,6 +366,7 @@ void m6581_init(m6581_t* sid, const m6581_desc_t* desc) {
         _m6581_init_voice(&sid->voice[i]);
     }
     _m6581_init_cutoff_table();
+    _m6581_init_env_lfsr_tables();
     _m6581_init_filter(&sid->filter, sid->sound_hz);
 }
 
@@ -498,23 +522,8 @@ static inline uint16_t _m6581_noise(m6581_voice_t* v) {
            (M6581_BIT(s,2)<<4);
 }
 
-static inline void _m6581_voice_tick(m6581_t* sid, int voice_index) {
+static inline void _m6581_wav_output(m6581_t* sid, int voice_index) {
     m6581_voice_t* v = &sid->voice[voice_index];
-
-    /* waveform generator */
-    if (0 == (v->ctrl & M6581_CTRL_TEST)) {
-        /* frequency accumulator */
-        uint32_t prev_accum = v->wav_accum;
-        v->wav_accum = (v->wav_accum + v->freq) & 0x00FFFFFF;
-        /* noise */
-        if ((v->wav_accum & 0x00080000) && !(prev_accum & 0x00080000)) {
-            uint32_t s = v->noise_shift;
-            uint32_t new_bit = ((s>>22)^(s>>17)) & 1;
-            v->noise_shift = ((s<<1)|new_bit) & 0x007FFFFF;
-        }
-        /* sync state */
-        v->sync = (v->wav_accum & 0x00800000) && !(prev_accum & 0x00800000);
-    }
     m6581_voice_t* v_sync = &sid->voice[(voice_index+2)%3];
     uint32_t sm;
     switch ((v->ctrl>>4) & 0x0F) {
@@ -530,8 +539,72 @@ static inline void _m6581_voice_tick(m6581_t* sid, int voice_index) {
         default: sm = 0; break;
     }
     v->wav_output = sm;
+}
+
+static inline void _m6581_noise_shift(m6581_voice_t* v) {
+    uint32_t s = v->noise_shift;
+    uint32_t new_bit = ((s>>22)^(s>>17)) & 1;
+    v->noise_shift = ((s<<1)|new_bit) & 0x007FFFFF;
+}
+
+/* the envelope rate counter has reached its period */
+static inline void _m6581_env_step(m6581_voice_t* v) {
+    v->env_counter = 0x7FFF;
+    if ((v->env_state == M6581_ENV_ATTACK) ||
+        (++v->env_exp_counter == _m6581_env_gen_dr_divisors[v->env_cur_level & 0xFF]))
+    {
+        v->env_exp_counter = 0;
+        switch (v->env_state) {
+            case M6581_ENV_ATTACK:
+                if (((++v->env_cur_level) & 0xFF) == 0xFF) {
+                    v->env_state = M6581_ENV_DECAY;
+                    v->env_counter_compare = v->env_decay_sub;
+                }
+                break;
+            case M6581_ENV_DECAY:
+                if (v->env_cur_level != v->env_sustain_level) {
+                    v->env_cur_level = (v->env_cur_level - 1) & 0xFF;
+                    if (0 == v->env_cur_level) {
+                        v->env_state = M6581_ENV_FROZEN;
+                    }
+                }
+                break;
+            case M6581_ENV_RELEASE:
+                v->env_cur_level = (v->env_cur_level - 1) & 0xFF;
+                if (0 == v->env_cur_level) {
+                    v->env_state = M6581_ENV_FROZEN;
+                }
+                break;
+            case M6581_ENV_FROZEN:
+                v->env_cur_level = 0;
+                break;
+        }
+    }
+}
+
+static inline void _m6581_voice_tick_wav(m6581_t* sid, int voice_index) {
+    m6581_voice_t* v = &sid->voice[voice_index];
+
+    /* waveform generator */
+    if (0 == (v->ctrl & M6581_CTRL_TEST)) {
+        /* frequency accumulator */
+        uint32_t prev_accum = v->wav_accum;
+        v->wav_accum = (v->wav_accum + v->freq) & 0x00FFFFFF;
+        /* noise */
+        if ((v->wav_accum & 0x00080000) && !(prev_accum & 0x00080000)) {
+            _m6581_noise_shift(v);
+        }
+        /* sync state */
+        v->sync = (v->wav_accum & 0x00800000) && !(prev_accum & 0x00800000);
+    }
+    _m6581_wav_output(sid, voice_index);
+}
+
+static inline void _m6581_voice_tick(m6581_t* sid, int voice_index) {
+    _m6581_voice_tick_wav(sid, voice_index);
 
     /* envelope generator */
+    m6581_voice_t* v = &sid->voice[voice_index];
     uint32_t lfsr = v->env_counter;
     if (lfsr != _m6581_rate_count_period[v->env_counter_compare & 0x0F]) {
         const uint32_t feedback = ((lfsr >> 14) ^ (lfsr >> 13)) & 1;
@@ -539,37 +612,7 @@ static inline void _m6581_voice_tick(m6581_t* sid, int voice_index) {
         v->env_counter = lfsr;
     }
     else {
-        v->env_counter = 0x7FFF;
-        if ((v->env_state == M6581_ENV_ATTACK) ||
-            (++v->env_exp_counter == _m6581_env_gen_dr_divisors[v->env_cur_level & 0xFF]))
-        {
-            v->env_exp_counter = 0;
-            switch (v->env_state) {
-                case M6581_ENV_ATTACK:
-                    if (((++v->env_cur_level) & 0xFF) == 0xFF) {
-                        v->env_state = M6581_ENV_DECAY;
-                        v->env_counter_compare = v->env_decay_sub;
-                    }
-                    break;
-                case M6581_ENV_DECAY:
-                    if (v->env_cur_level != v->env_sustain_level) {
-                        v->env_cur_level = (v->env_cur_level - 1) & 0xFF;
-                        if (0 == v->env_cur_level) {
-                            v->env_state = M6581_ENV_FROZEN;
-                        }
-                    }
-                    break;
-                case M6581_ENV_RELEASE:
-                    v->env_cur_level = (v->env_cur_level - 1) & 0xFF;
-                    if (0 == v->env_cur_level) {
-                        v->env_state = M6581_ENV_FROZEN;
-                    }
-                    break;
-                case M6581_ENV_FROZEN:
-                    v->env_cur_level = 0;
-                    break;
-            }
-        }
+        _m6581_env_step(v);
     }
 }
 
@@ -644,8 +687,8 @@ static inline int _m6581_filter_output(m6581_filter_t* f, int vi) {
     return vf * (1<<7);
 }
 
-/* tick the sound generation, return true when new sample ready */
-static uint64_t _m6581_tick(m6581_t* sid, uint64_t pins) {
+/* tick the wave and envelope generators, this is all that's visible to the CPU */
+static inline void _m6581_tick_voices(m6581_t* sid) {
     /* decay the last written register value */
     if (sid->bus_decay > 0) {
         if (--sid->bus_decay == 0) {
@@ -661,6 +704,11 @@ static uint64_t _m6581_tick(m6581_t* sid, uint64_t pins) {
     for (int i = 0; i < 3; i++) {
         _m6581_voice_sync(sid, i);
     }
+}
+
+/* tick voices, filter and mixer, return the mixed output */
+static inline int _m6581_tick_mix(m6581_t* sid) {
+    _m6581_tick_voices(sid);
     /* filter */
     int sum_filtered_outp = 0;
     int sum_outp = 0;
@@ -681,18 +729,28 @@ static uint64_t _m6581_tick(m6581_t* sid, uint64_t pins) {
         }
     }
     int accu = (sum_outp + _m6581_filter_output(&sid->filter, sum_filtered_outp) + M6581_DCMIXER) * sid->filter.volume;
-    int sample = accu / (1<<12);
+    return accu / (1<<12);
+}
+
+/* finish the current output sample */
+static inline void _m6581_sample(m6581_t* sid) {
+    sid->sample_counter += sid->sample_period;
+    float s = sid->sample_accum / sid->sample_accum_count;
+    sid->sample = sid->sample_mag * s;
+    sid->sample_accum = 0.0f;
+    sid->sample_accum_count = 0.0f;
+}
+
+/* tick the sound generation, return true when new sample ready */
+static uint64_t _m6581_tick(m6581_t* sid, uint64_t pins) {
+    int sample = _m6581_tick_mix(sid);
     sid->sample_accum += (sample / 16384.0f);
     sid->sample_accum_count += 1.0f;
 
     /* new sample? */
     sid->sample_counter -= M6581_FIXEDPOINT_SCALE;
     if (sid->sample_counter <= 0) {
-        sid->sample_counter += sid->sample_period;
-        float s = sid->sample_accum / sid->sample_accum_count;
-        sid->sample = sid->sample_mag * s;
-        sid->sample_accum = 0.0f;
-        sid->sample_accum_count = 0.0f;
+        _m6581_sample(sid);
         pins |= M6581_SAMPLE;
     }
     else {
@@ -814,14 +872,8 @@ static void _m6581_write(m6581_t* sid, uint64_t pins) {
     }
 }
 
-/* the all-in-one tick function */
-uint64_t m6581_tick(m6581_t* sid, uint64_t pins) {
-    CHIPS_ASSERT(sid);
-
-    /* first perform the regular per-tick actions */
-    pins = _m6581_tick(sid, pins);
-
-    /* register read/write */
+/* register read/write */
+static inline uint64_t _m6581_access(m6581_t* sid, uint64_t pins) {
     if (pins & M6581_CS) {
         if (pins & M6581_RW) {
             pins = _m6581_read(sid, pins);
@@ -834,4 +886,138 @@ uint64_t m6581_tick(m6581_t* sid, uint64_t pins) {
     return pins;
 }
 
+/* the all-in-one tick function */
+uint64_t m6581_tick(m6581_t* sid, uint64_t pins) {
+    CHIPS_ASSERT(sid);
+    /* first perform the regular per-tick actions */
+    pins = _m6581_tick(sid, pins);
+    return _m6581_access(sid, pins);
+}
+
+/* advance the waveform accumulator of a voice by num_ticks (no hard sync) */
+static void _m6581_wav_skip(m6581_t* sid, int voice_index, uint32_t num_ticks) {
+    m6581_voice_t* v = &sid->voice[voice_index];
+    if (0 == (v->ctrl & 0xF0)) {
+        /* without waveform the accumulator is halved each tick and
+           settles within a few dozen ticks, after that nothing changes
+        */
+        for (; num_ticks > 0; num_ticks--) {
+            const uint32_t prev_accum = v->wav_accum;
+            _m6581_voice_tick_wav(sid, voice_index);
+            if (prev_accum == v->wav_accum) {
+                break;
+            }
+        }
+    }
+    else if (0 == (v->ctrl & M6581_CTRL_TEST)) {
+        const uint64_t a0 = v->wav_accum;
+        const uint64_t a1 = a0 + (uint64_t)v->freq * num_ticks;
+        /* the noise generator is clocked by each rising edge of accumulator
+           bit 19, the 16-bit frequency can't skip over one
+        */
+        for (uint64_t i = ((a1 + 0x80000) >> 20) - ((a0 + 0x80000) >> 20); i > 0; i--) {
+            _m6581_noise_shift(v);
+        }
+        const uint32_t prev_accum = (uint32_t)(a1 - v->freq) & 0x00FFFFFF;
+        v->wav_accum = (uint32_t)a1 & 0x00FFFFFF;
+        v->sync = (v->wav_accum & 0x00800000) && !(prev_accum & 0x00800000);
+    }
+}
+
+/* advance the envelope generator of a voice by num_ticks */
+static void _m6581_env_skip(m6581_voice_t* v, uint32_t num_ticks) {
+    while (num_ticks > 0) {
+        const uint32_t counter = v->env_counter;
+        if (0 == counter) {
+            /* the rate counter LFSR is stuck at zero */
+            return;
+        }
+        /* number of counter steps until the tick which sees the period */
+        const uint32_t period = _m6581_rate_count_period[v->env_counter_compare & 0x0F];
+        const uint32_t pos = _m6581_env_lfsr_index[counter];
+        const uint32_t dist = (_m6581_env_lfsr_index[period] + _M6581_ENV_LFSR_PERIOD - pos) % _M6581_ENV_LFSR_PERIOD;
+        if (dist >= num_ticks) {
+            v->env_counter = _m6581_env_lfsr_state[(pos + num_ticks) % _M6581_ENV_LFSR_PERIOD];
+            return;
+        }
+        num_ticks -= dist + 1;
+        _m6581_env_step(v);
+    }
+}
+
+/*  The wave and envelope generators are advanced in closed form where
+    possible, only hard sync couples the voices tick by tick. The waveform
+    output is only updated at the end, this is what the CPU can read
+    back from OSC3.
+*/
+void m6581_skip(m6581_t* sid, uint32_t num_ticks) {
+    CHIPS_ASSERT(sid);
+    if ((sid->voice[0].ctrl | sid->voice[1].ctrl | sid->voice[2].ctrl) & M6581_CTRL_SYNC) {
+        for (uint32_t i = 0; i < num_ticks; i++) {
+            _m6581_tick_voices(sid);
+        }
+        return;
+    }
+    if (sid->bus_decay > 0) {
+        if (sid->bus_decay <= num_ticks) {
+            sid->bus_decay = 0;
+            sid->bus_value = 0;
+        }
+        else {
+            sid->bus_decay -= num_ticks;
+        }
+    }
+    for (int i = 0; i < 3; i++) {
+        _m6581_wav_skip(sid, i, num_ticks);
+    }
+    for (int i = 0; i < 3; i++) {
+        if (num_ticks > 0 && (sid->voice[i].ctrl & 0xF0)) {
+            _m6581_wav_output(sid, i);
+        }
+        _m6581_env_skip(&sid->voice[i], num_ticks);
+    }
+}
+
+/*  Synthesize a block of ticks between register accesses, the output of
+    all ticks belonging to one sample is summed up as integer and only
+    converted once per sample.
+*/
+uint32_t m6581_synth(m6581_t* sid, uint32_t num_ticks, float* samples, int max_samples, int* num_samples) {
+    CHIPS_ASSERT(sid && samples && num_samples);
+    uint32_t ticks = 0;
+    int n = 0;
+    while ((ticks < num_ticks) && (n < max_samples)) {
+        /* ticks until the next sample is complete */
+        uint32_t run = (sid->sample_counter + M6581_FIXEDPOINT_SCALE - 1) / M6581_FIXEDPOINT_SCALE;
+        if (run > (num_ticks - ticks)) {
+            run = num_ticks - ticks;
+        }
+        int accum = 0;
+        for (uint32_t i = 0; i < run; i++) {
+            accum += _m6581_tick_mix(sid);
+        }
+        sid->sample_accum += (accum / 16384.0f);
+        sid->sample_accum_count += (float) run;
+        sid->sample_counter -= (int)run * M6581_FIXEDPOINT_SCALE;
+        ticks += run;
+        if (sid->sample_counter <= 0) {
+            _m6581_sample(sid);
+            samples[n++] = sid->sample;
+        }
+    }
+    *num_samples = n;
+    return ticks;
+}
+
+/*  same as m6581_tick(), but skips the filter, mixer and sample output
+    when nobody listens, the oscillators and envelopes are still ticked
+    so that OSC3 and ENV3 read back the same values
+*/
+uint64_t m6581_tick_silent(m6581_t* sid, uint64_t pins) {
+    CHIPS_ASSERT(sid);
+    _m6581_tick_voices(sid);
+    pins &= ~M6581_SAMPLE;
+    return _m6581_access(sid, pins);
+}
+
 #endif /* CHIPS_IMPL */
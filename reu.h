@@ -0,0 +1,392 @@
+#pragma once
+/*#
+    # reu.h
+
+    Commodore 1700/1764/1750 RAM Expansion Unit (REC 8726 DMA controller).
+
+    Do this:
+    ~~~C
+    #define CHIPS_IMPL
+    ~~~
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Optionally provide the following macros with your own implementation
+    ~~~C
+    CHIPS_ASSERT(c)
+    ~~~
+        your own assert macro (default: assert(c))
+
+    ## Overview
+
+    The REU adds 128 KB (1700), 256 KB (1764) or 512 KB (1750) of RAM
+    which isn't directly visible to the CPU, but is copied to and from
+    C64 memory by a DMA controller at one byte per clock cycle. Sizes up
+    to 16 MB (like later third-party REUs) are supported as well, the
+    REU memory is provided by the host, for instance as a memory-mapped
+    file.
+
+    The registers appear in the IO2 area at DF00..DF0A and are mirrored
+    every 32 bytes up to DFFF:
+
+    - **DF00 status** (read only, reading clears bits 5..7 and the IRQ)
+        - bit 7: interrupt pending
+        - bit 6: end of block
+        - bit 5: verify error
+        - bit 4: 1 for 256 KB RAM chips (all sizes but 128 KB)
+    - **DF01 command**
+        - bit 7: execute
+        - bit 5: autoload, restore address and length registers after the transfer
+        - bit 4: 1 to start right away, 0 to start at the next CPU write to FF00
+        - bit 0..1: 00 stash (C64 to REU), 01 fetch (REU to C64), 10 swap, 11 verify
+    - **DF02/DF03** C64 address
+    - **DF04/DF05/DF06** REU address (bank in DF06)
+    - **DF07/DF08** transfer length (0 means 64 KB)
+    - **DF09 interrupt mask**, bit 7: enable, bit 6: on end of block,
+      bit 5: on verify error
+    - **DF0A address control**, bit 7: fix C64 address, bit 6: fix REU address
+
+    Writing the address and length registers also sets the shadow
+    registers used by autoload. After a transfer without autoload the
+    registers hold the address after the last transferred byte and a
+    length of 1.
+
+    ## DMA
+
+    While a transfer is running the REU is the bus master, the system
+    emulation calls reu_dma_pins() before each clock cycle to get the
+    address, data and RW pins of the C64 bus access (stash and verify
+    read, fetch writes, swap reads and then writes each byte), performs
+    the access like a CPU access, and hands the result to reu_dma_done().
+    The CPU must be stopped meanwhile (on the C64 through RDY), and the
+    system emulation should not use cycles in which the VIC-II needs the
+    bus.
+
+    A verify transfer stops at the first difference.
+#*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// the bus pins, same positions as in m6502.h
+#define REU_PIN_RW  (24)
+#define REU_RW      (1ULL<<REU_PIN_RW)
+
+// REU memory sizes
+#define REU_MIN_SIZE (128*1024)
+#define REU_MAX_SIZE (16*1024*1024)
+
+// status register bits
+#define REU_STATUS_IRQ      (1<<7)
+#define REU_STATUS_EOB      (1<<6)
+#define REU_STATUS_FAULT    (1<<5)
+#define REU_STATUS_SIZE     (1<<4)
+
+// command register bits
+#define REU_CMD_EXECUTE     (1<<7)
+#define REU_CMD_AUTOLOAD    (1<<5)
+#define REU_CMD_FF00        (1<<4)
+#define REU_CMD_TYPE        (3<<0)
+
+// transfer types
+#define REU_STASH   (0)
+#define REU_FETCH   (1)
+#define REU_SWAP    (2)
+#define REU_VERIFY  (3)
+
+// interrupt mask register bits
+#define REU_IMR_ENABLE      (1<<7)
+#define REU_IMR_EOB         (1<<6)
+#define REU_IMR_FAULT       (1<<5)
+
+// address control register bits
+#define REU_CTRL_FIX_C64    (1<<7)
+#define REU_CTRL_FIX_REU    (1<<6)
+
+// config params for reu_init()
+typedef struct {
+    // REU memory provided by the host, a power of 2 between REU_MIN_SIZE and REU_MAX_SIZE
+    chips_range_t mem;
+} reu_desc_t;
+
+// REU state
+typedef struct {
+    bool valid;         // true between reu_init() and reu_discard()
+    uint8_t* mem;       // REU memory (not part of snapshots)
+    uint32_t size;
+    uint32_t addr_mask; // REU address register bits, 19 up to 512 KB and 24 above
+    uint8_t status;
+    uint8_t command;
+    uint8_t imr;
+    uint8_t ctrl;
+    uint16_t c64_addr;
+    uint32_t reu_addr;
+    uint16_t length;
+    uint16_t shadow_c64_addr;
+    uint32_t shadow_reu_addr;
+    uint16_t shadow_length;
+    bool armed;         // transfer waits for a CPU write to FF00
+    bool dma;           // transfer in progress
+    bool swap_write;    // second cycle of a swapped byte
+    uint8_t swap_data;  // C64 byte read in the first cycle of a swap
+} reu_t;
+
+// initialize a reu_t instance
+void reu_init(reu_t* reu, const reu_desc_t* desc);
+// discard a reu_t instance
+void reu_discard(reu_t* reu);
+// reset the REU registers, the REU memory keeps its content
+void reu_reset(reu_t* reu);
+// read a register (addr: any address in DF00..DFFF)
+uint8_t reu_read(reu_t* reu, uint16_t addr);
+// write a register (addr: any address in DF00..DFFF)
+void reu_write(reu_t* reu, uint16_t addr, uint8_t data);
+// notify the REU of a CPU write to FF00, starts an armed transfer
+void reu_ff00(reu_t* reu);
+// return the C64 bus pins (address, data, RW) of the next DMA cycle
+uint64_t reu_dma_pins(reu_t* reu, uint64_t pins);
+// finish a DMA cycle, pins contain the read data
+void reu_dma_done(reu_t* reu, uint64_t pins);
+// return true if the REU interrupt line is active
+bool reu_irq(const reu_t* reu);
+// return true if the REU needs attention from the system tick (DMA, armed or IRQ)
+bool reu_busy(const reu_t* reu);
+// prepare reu_t snapshot for saving
+void reu_snapshot_onsave(reu_t* snapshot);
+// fixup reu_t snapshot after loading
+void reu_snapshot_onload(reu_t* snapshot, reu_t* sys);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/*-- IMPLEMENTATION ----------------------------------------------------------*/
+#ifdef CHIPS_IMPL
+#include <string.h> /* memset */
+#ifndef CHIPS_ASSERT
+    #include <assert.h>
+    #define CHIPS_ASSERT(c) assert(c)
+#endif
+
+void reu_init(reu_t* reu, const reu_desc_t* desc) {
+    CHIPS_ASSERT(reu && desc);
+    CHIPS_ASSERT(desc->mem.ptr);
+    CHIPS_ASSERT((desc->mem.size >= REU_MIN_SIZE) && (desc->mem.size <= REU_MAX_SIZE));
+    CHIPS_ASSERT(0 == (desc->mem.size & (desc->mem.size - 1)));
+    memset(reu, 0, sizeof(*reu));
+    reu->valid = true;
+    reu->mem = (uint8_t*) desc->mem.ptr;
+    reu->size = (uint32_t) desc->mem.size;
+    // the REC 8726 has 19 address bits, bigger REUs use all 8 bank bits
+    reu->addr_mask = (reu->size > 0x80000) ? 0xFFFFFF : 0x7FFFF;
+    reu_reset(reu);
+}
+
+void reu_discard(reu_t* reu) {
+    CHIPS_ASSERT(reu && reu->valid);
+    reu->valid = false;
+    reu->mem = 0;
+}
+
+void reu_reset(reu_t* reu) {
+    CHIPS_ASSERT(reu && reu->valid);
+    reu->status = (reu->size > REU_MIN_SIZE) ? REU_STATUS_SIZE : 0;
+    reu->command = REU_CMD_FF00;
+    reu->imr = 0;
+    reu->ctrl = 0;
+    reu->c64_addr = reu->shadow_c64_addr = 0;
+    reu->reu_addr = reu->shadow_reu_addr = 0;
+    reu->length = reu->shadow_length = 0xFFFF;
+    reu->armed = false;
+    reu->dma = false;
+    reu->swap_write = false;
+    reu->swap_data = 0;
+}
+
+static void _reu_start(reu_t* reu) {
+    reu->armed = false;
+    reu->dma = true;
+    reu->swap_write = false;
+}
+
+uint8_t reu_read(reu_t* reu, uint16_t addr) {
+    CHIPS_ASSERT(reu && reu->valid);
+    switch (addr & 0x1F) {
+        case 0x00: {
+            const uint8_t val = reu->status;
+            reu->status &= ~(REU_STATUS_IRQ|REU_STATUS_EOB|REU_STATUS_FAULT);
+            return val;
+        }
+        case 0x01: return reu->command;
+        case 0x02: return reu->c64_addr & 0xFF;
+        case 0x03: return reu->c64_addr >> 8;
+        case 0x04: return reu->reu_addr & 0xFF;
+        case 0x05: return (reu->reu_addr >> 8) & 0xFF;
+        // unconnected bank bits read as 1
+        case 0x06: return (reu->reu_addr >> 16) | ~(reu->addr_mask >> 16);
+        case 0x07: return reu->length & 0xFF;
+        case 0x08: return reu->length >> 8;
+        case 0x09: return reu->imr | 0x1F;
+        case 0x0A: return reu->ctrl | 0x3F;
+        default: return 0xFF;
+    }
+}
+
+void reu_write(reu_t* reu, uint16_t addr, uint8_t data) {
+    CHIPS_ASSERT(reu && reu->valid);
+    switch (addr & 0x1F) {
+        case 0x01:
+            reu->command = data;
+            if (data & REU_CMD_EXECUTE) {
+                if (data & REU_CMD_FF00) {
+                    _reu_start(reu);
+                }
+                else {
+                    reu->armed = true;
+                }
+            }
+            break;
+        case 0x02:
+            reu->c64_addr = reu->shadow_c64_addr = (reu->shadow_c64_addr & 0xFF00) | data;
+            break;
+        case 0x03:
+            reu->c64_addr = reu->shadow_c64_addr = (reu->shadow_c64_addr & 0x00FF) | (data << 8);
+            break;
+        case 0x04:
+            reu->reu_addr = reu->shadow_reu_addr = (reu->shadow_reu_addr & 0xFFFF00) | data;
+            break;
+        case 0x05:
+            reu->reu_addr = reu->shadow_reu_addr = (reu->shadow_reu_addr & 0xFF00FF) | (data << 8);
+            break;
+        case 0x06:
+            reu->reu_addr = reu->shadow_reu_addr = ((reu->shadow_reu_addr & 0x00FFFF) | (data << 16)) & reu->addr_mask;
+            break;
+        case 0x07:
+            reu->length = reu->shadow_length = (reu->shadow_length & 0xFF00) | data;
+            break;
+        case 0x08:
+            reu->length = reu->shadow_length = (reu->shadow_length & 0x00FF) | (data << 8);
+            break;
+        case 0x09:
+            reu->imr = data & 0xE0;
+            break;
+        case 0x0A:
+            reu->ctrl = data & 0xC0;
+            break;
+        default:
+            break;
+    }
+}
+
+void reu_ff00(reu_t* reu) {
+    CHIPS_ASSERT(reu && reu->valid);
+    if (reu->armed) {
+        _reu_start(reu);
+    }
+}
+
+// the REU memory is mirrored when the REU address space is bigger than the memory
+static inline uint8_t* _reu_mem(reu_t* reu) {
+    return &reu->mem[reu->reu_addr & (reu->size - 1)];
+}
+
+uint64_t reu_dma_pins(reu_t* reu, uint64_t pins) {
+    CHIPS_ASSERT(reu && reu->valid && reu->dma);
+    pins &= ~0xFFFFFFULL;
+    pins |= reu->c64_addr;
+    const uint8_t type = reu->command & REU_CMD_TYPE;
+    if ((type == REU_FETCH) || ((type == REU_SWAP) && reu->swap_write)) {
+        // write cycle
+        pins &= ~REU_RW;
+        pins |= ((uint64_t)*_reu_mem(reu)) << 16;
+    }
+    else {
+        pins |= REU_RW;
+    }
+    return pins;
+}
+
+static void _reu_interrupt(reu_t* reu) {
+    if ((reu->imr & REU_IMR_ENABLE) && (reu->imr & reu->status & (REU_STATUS_EOB|REU_STATUS_FAULT))) {
+        reu->status |= REU_STATUS_IRQ;
+    }
+}
+
+static void _reu_finish(reu_t* reu) {
+    reu->dma = false;
+    reu->command = (reu->command & ~REU_CMD_EXECUTE) | REU_CMD_FF00;
+    if (reu->command & REU_CMD_AUTOLOAD) {
+        reu->c64_addr = reu->shadow_c64_addr;
+        reu->reu_addr = reu->shadow_reu_addr;
+        reu->length = reu->shadow_length;
+    }
+    _reu_interrupt(reu);
+}
+
+void reu_dma_done(reu_t* reu, uint64_t pins) {
+    CHIPS_ASSERT(reu && reu->valid && reu->dma);
+    const uint8_t data = (uint8_t)(pins >> 16);
+    bool fault = false;
+    switch (reu->command & REU_CMD_TYPE) {
+        case REU_STASH:
+            *_reu_mem(reu) = data;
+            break;
+        case REU_FETCH:
+            break;
+        case REU_SWAP:
+            if (!reu->swap_write) {
+                // first cycle reads the C64 byte, the second one writes the REU byte
+                reu->swap_data = data;
+                reu->swap_write = true;
+                return;
+            }
+            *_reu_mem(reu) = reu->swap_data;
+            reu->swap_write = false;
+            break;
+        case REU_VERIFY:
+            fault = (data != *_reu_mem(reu));
+            break;
+    }
+    if (0 == (reu->ctrl & REU_CTRL_FIX_C64)) {
+        reu->c64_addr++;
+    }
+    if (0 == (reu->ctrl & REU_CTRL_FIX_REU)) {
+        reu->reu_addr = (reu->reu_addr + 1) & reu->addr_mask;
+    }
+    if (fault) {
+        reu->status |= REU_STATUS_FAULT;
+        _reu_finish(reu);
+    }
+    else if (reu->length == 1) {
+        reu->status |= REU_STATUS_EOB;
+        _reu_finish(reu);
+    }
+    else {
+        reu->length--;
+    }
+}
+
+bool reu_irq(const reu_t* reu) {
+    CHIPS_ASSERT(reu);
+    return 0 != (reu->status & REU_STATUS_IRQ);
+}
+
+bool reu_busy(const reu_t* reu) {
+    CHIPS_ASSERT(reu);
+    return reu->valid && (reu->dma || reu->armed || reu_irq(reu));
+}
+
+void reu_snapshot_onsave(reu_t* snapshot) {
+    CHIPS_ASSERT(snapshot);
+    snapshot->mem = 0;
+}
+
+void reu_snapshot_onload(reu_t* snapshot, reu_t* sys) {
+    CHIPS_ASSERT(snapshot && sys);
+    snapshot->mem = sys->mem;
+}
+#endif /* CHIPS_IMPL */
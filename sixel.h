@@ -28,6 +28,7 @@
 #include <stdarg.h>
 #include <sys/select.h>
 #include <sys/time.h>
+#include <time.h>
 #include <termios.h>
 
 /*
@@ -54,6 +55,7 @@ typedef enum {
     GFXMODE_SIXEL = 1,
     GFXMODE_KITTY = 2,
     GFXMODE_AUTO  = 3,
+    GFXMODE_NULL  = 4,    /* no output at all (benchmark only) */
 } gfx_mode_t;
 
 typedef struct {
@@ -63,6 +65,9 @@ typedef struct {
     uint8_t    prev_fb[GFX_FB_STRIDE * GFX_FB_H];  /* 504*270 = 136,080 bytes, stride-matched */
     char       out[1024 * 1024];                    /* 1 MB output buffer */
     int        out_len;
+    int        out_fd;    /* output file descriptor, normally STDOUT_FILENO */
+    long       out_usec;  /* accumulated time spent in write(), for statistics */
+    long long  out_bytes; /* accumulated number of bytes written */
 } gfx_state_t;
 
 /*
@@ -88,7 +93,12 @@ static const uint8_t _gfx_pal_b[16] = {
 
 static inline void _gfx_flush(gfx_state_t *st) {
     if (st->out_len > 0) {
-        write(STDOUT_FILENO, st->out, st->out_len);
+        struct timespec t0, t1;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &t0);
+        write(st->out_fd, st->out, st->out_len);
+        clock_gettime(CLOCK_MONOTONIC_RAW, &t1);
+        st->out_usec  += (t1.tv_sec - t0.tv_sec) * 1000000L + (t1.tv_nsec - t0.tv_nsec) / 1000L;
+        st->out_bytes += st->out_len;
         st->out_len = 0;
     }
 }
@@ -236,8 +246,9 @@ static void _gfx_present_sixel(gfx_state_t *st, const uint8_t *fb,
 */
 static void _gfx_kitty_send_strip(gfx_state_t *st, const uint8_t *fb,
                                    int py0, int strip_h, int cell_row) {
-    /* Strip RGBA buffer — max one cell height × full width */
-    static uint8_t rgba[64 * GFX_FB_W * 4];   /* 64px max cell_h */
+    /* Strip RGBA buffer — a whole frame, the full-frame fallback without
+       a known cell height sends all GFX_FB_H rows as one strip */
+    static uint8_t rgba[GFX_FB_H * GFX_FB_W * 4];
     char chunk_b64[_GFX_KITTY_CHUNK_B64 + 4];
 
     for (int r = 0; r < strip_h; r++) {
@@ -340,13 +351,15 @@ static const char *gfx_mode_name(gfx_mode_t m) {
         case GFXMODE_SIXEL: return "sixel";
         case GFXMODE_KITTY: return "kitty";
         case GFXMODE_AUTO:  return "auto";
-        default:            return "none";
+        case GFXMODE_NULL:  return "none";
+        default:            return "text";
     }
 }
 
 /*
     Parse --mode=VALUE argument.
-    Graphics values (auto/kitty/sixel/none) set *gfx_out.
+    Graphics values (auto/kitty/sixel/none) set *gfx_out, "none" disables
+    all output and is only meaningful together with --bench.
     Text values (narrow/wide) set *char_width_out (1 or 2).
     Returns true on any recognised --mode= argument.
 */
@@ -356,6 +369,7 @@ static bool gfx_parse_arg(const char *arg, gfx_mode_t *gfx_out, int *char_width_
     if      (strcmp(val, "auto")   == 0) *gfx_out = GFXMODE_AUTO;
     else if (strcmp(val, "sixel")  == 0) *gfx_out = GFXMODE_SIXEL;
     else if (strcmp(val, "kitty")  == 0) *gfx_out = GFXMODE_KITTY;
+    else if (strcmp(val, "none")   == 0) *gfx_out = GFXMODE_NULL;
     else if (strcmp(val, "narrow") == 0) { *gfx_out = GFXMODE_NONE; *char_width_out = 1; }
     else if (strcmp(val, "wide")   == 0) { *gfx_out = GFXMODE_NONE; *char_width_out = 2; }
     else return false;
@@ -482,14 +496,21 @@ static gfx_mode_t gfx_detect(void) {
     return GFXMODE_NONE;
 }
 
-/* Initialise graphics state.  Call once after mode is resolved.
-   Must be called with stdin already in raw non-blocking mode so the
-   CSI 16 t response can be read back. */
-static void gfx_init(gfx_state_t *st, gfx_mode_t mode) {
+/* Initialise graphics state writing to an arbitrary file descriptor,
+   without probing the terminal (used directly by the benchmark mode). */
+static void gfx_init_fd(gfx_state_t *st, gfx_mode_t mode, int out_fd) {
     memset(st, 0, sizeof(*st));
     st->mode        = mode;
     st->first_frame = true;
     st->cell_h      = 0;
+    st->out_fd      = out_fd;
+}
+
+/* Initialise graphics state.  Call once after mode is resolved.
+   Must be called with stdin already in raw non-blocking mode so the
+   CSI 16 t response can be read back. */
+static void gfx_init(gfx_state_t *st, gfx_mode_t mode) {
+    gfx_init_fd(st, mode, STDOUT_FILENO);
 
     if (mode == GFXMODE_KITTY) {
         /* Query terminal character cell size in pixels: CSI 16 t
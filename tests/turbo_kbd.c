@@ -0,0 +1,89 @@
+/*
+    turbo_kbd.c - keyboard input with --turbo
+
+    Types PRINT 12345 through the keyboard matrix with the tick and exec
+    CPU backends at several turbo factors and checks the printed result.
+    At 4x and above the KERNAL keyboard scan writes DC00 and reads DC01
+    in consecutive system ticks.
+
+    Build and run from the repository root:
+
+        gcc -O2 -I. -o turbo_kbd tests/turbo_kbd.c -lm && ./turbo_kbd
+*/
+#include <stdio.h>
+#include <string.h>
+#define CHIPS_IMPL
+#include "chips_common.h"
+#include "m6502.h"
+#include "m6526.h"
+#include "m6569.h"
+#include "m6581.h"
+#include "beeper.h"
+#include "kbd.h"
+#include "mem.h"
+#include "m6502dr.h"
+#include "clk.h"
+#include "c1530.h"
+#include "m6522.h"
+#include "c1541.h"
+#include "reu.h"
+#include "c64.h"
+#include "c64-roms.h"
+
+static c64_t c64;
+
+// run the given number of PAL frames
+static void run_frames(int num_frames) {
+    for (int i = 0; i < num_frames; i++) {
+        c64_exec(&c64, 20000);
+    }
+}
+
+// true if a screen line starts with the given text (screen codes of digits and space match ASCII)
+static bool screen_line_is(int line, const char *text) {
+    for (size_t i = 0; i < strlen(text); i++) {
+        if (c64.ram[0x0400 + line * 40 + i] != (uint8_t)text[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool type_and_check(c64_cpu_backend_t backend, uint32_t turbo) {
+    c64_init(&c64, &(c64_desc_t){
+        .cpu_backend = backend,
+        .cpu_turbo = turbo,
+        .sid_no_sound = true,
+        .roms = {
+            .chars = { .ptr=dump_c64_char_bin, .size=sizeof(dump_c64_char_bin) },
+            .basic = { .ptr=dump_c64_basic_bin, .size=sizeof(dump_c64_basic_bin) },
+            .kernal = { .ptr=dump_c64_kernalv3_bin, .size=sizeof(dump_c64_kernalv3_bin) }
+        }
+    });
+    run_frames(150);
+    for (const char *p = "PRINT 12345\r"; *p; p++) {
+        c64_key_down(&c64, *p);
+        run_frames(3);
+        c64_key_up(&c64, *p);
+        run_frames(3);
+    }
+    run_frames(10);
+    // READY. is on line 5, the command on line 6, the result on line 7
+    const bool ok = screen_line_is(7, " 12345");
+    c64_discard(&c64);
+    return ok;
+}
+
+int main(void) {
+    static const uint32_t turbo[] = { 1, 2, 4, 8, C64_MAX_CPU_TURBO };
+    static const c64_cpu_backend_t backend[] = { C64_CPUBACKEND_TICK, C64_CPUBACKEND_EXEC };
+    int failed = 0;
+    for (int b = 0; b < 2; b++) {
+        for (int t = 0; t < 5; t++) {
+            const bool ok = type_and_check(backend[b], turbo[t]);
+            printf("%s backend %s, turbo %ux\n", ok ? "ok    " : "FAILED", (b == 0) ? "tick" : "exec", turbo[t]);
+            failed += ok ? 0 : 1;
+        }
+    }
+    return failed ? 1 : 0;
+}